@@ -67,6 +67,11 @@ This information includes:
 /// This information is returned by the command \ref DAP_Info as part of <b>Capabilities</b>.
 #define DAP_SWD                 1               ///< SWD Mode:  1 = available, 0 = not available.
 
+/// Indicate that SWD packet fields are shifted by a hardware-assisted engine (SPI, timer-DMA, or PIO).
+/// When available, \ref SWD_SHIFT_OUT and \ref SWD_SHIFT_IN are used for the SWD transfers at all
+/// SWD clock frequencies accepted by \ref SWD_SHIFT_CLOCK. GPIO bit-banging is used otherwise.
+#define DAP_SWD_SHIFT           0               ///< SWD Shift Engine: 1 = available, 0 = not available.
+
 /// Indicate that JTAG communication mode is available at the Debug Port.
 /// This information is returned by the command \ref DAP_Info as part of <b>Capabilities</b>.
 #define DAP_JTAG                1               ///< JTAG Mode: 1 = available, 0 = not available.
@@ -111,6 +116,9 @@ This information includes:
 #define SWO_BUFFER_SIZE         4096U           ///< SWO Trace Buffer Size in bytes (must be 2^n).
 
 /// SWO Streaming Trace.
+/// Trace data is sent to the streaming endpoint in USB blocks of 512 bytes: one block is transferred
+/// while the next block is captured, which requires a \ref SWO_BUFFER_SIZE of at least 1024 bytes.
+/// When the Trace Buffer is full the trace data is lost and the status reports a buffer overrun.
 #define SWO_STREAM              0               ///< SWO Streaming Trace: 1 = available, 0 = not available.
 
 /// Clock frequency of the Test Domain Timer. Timer value is returned with \ref TIMESTAMP_GET.
@@ -190,6 +198,18 @@ of the same I/O port. The following SWDIO I/O Pin functions are provided:
  - \ref PIN_SWDIO_OUT_DISABLE to enable the input mode to the DAP hardware.
  - \ref PIN_SWDIO_IN to read from the SWDIO I/O pin with utmost possible speed.
  - \ref PIN_SWDIO_OUT to write to the SWDIO I/O pin with utmost possible speed.
+
+SWD Shift Engine Functions
+--------------------------
+When \ref DAP_SWD_SHIFT is 1, the SWD transfers shift whole packet fields (8-bit request,
+turnaround, 3-bit acknowledge, 32-bit data, and parity) through a hardware-assisted engine
+(for example SPI with SWDIO connected to MOSI and MISO, timer triggered DMA, or programmable I/O).
+The SWCLK and SWDIO timing is identical to GPIO bit-banging: SWDIO output changes while SWCLK is 
+high and SWDIO input is sampled before the rising edge of SWCLK. SWCLK is high when a field is 
+complete. The SWDIO direction is still set with \ref PIN_SWDIO_OUT_ENABLE and \ref PIN_SWDIO_OUT_DISABLE.
+ - \ref SWD_SHIFT_CLOCK to set the shift engine clock (returns 0 when GPIO bit-banging is used).
+ - \ref SWD_SHIFT_OUT to shift a field out on SWDIO.
+ - \ref SWD_SHIFT_IN to shift a field in from SWDIO.
 */
 
 
@@ -300,6 +320,38 @@ __STATIC_FORCEINLINE void     PIN_SWDIO_OUT_DISABLE (void) {
 }
 
 
+// SWD Shift Engine (used when DAP_SWD_SHIFT = 1) --------
+
+/** SWD Shift Engine: Setup clock (used in SWD mode only).
+Configure the shift engine for the requested SWCLK frequency. This function is called
+by \ref DAP_Setup and the command \ref DAP_SWJ_Clock.
+\param clock requested SWCLK frequency in Hz.
+\return 1 = clock supported by the shift engine, 0 = GPIO bit-banging is used for this clock.
+*/
+__STATIC_INLINE uint32_t SWD_SHIFT_CLOCK (uint32_t clock) {
+  return (0U);
+}
+
+/** SWD Shift Engine: Shift output field (used in SWD mode only).
+Generate \em count SWCLK cycles and output \em data on SWDIO (LSB first).
+The function returns when the last bit is transmitted.
+\param data  field data.
+\param count number of bits (0 .. 32).
+*/
+__STATIC_FORCEINLINE void SWD_SHIFT_OUT (uint32_t data, uint32_t count) {
+  ;
+}
+
+/** SWD Shift Engine: Shift input field (used in SWD mode only).
+Generate \em count SWCLK cycles and capture SWDIO (LSB first).
+\param count number of bits (0 .. 32).
+\return captured field (bit 0 is the first bit received).
+*/
+__STATIC_FORCEINLINE uint32_t SWD_SHIFT_IN (uint32_t count) {
+  return (0U);
+}
+
+
 // TDI Pin I/O ---------------------------------------------
 
 /** TDI I/O pin: Get Input.
@@ -200,7 +200,8 @@
 typedef struct {
   uint8_t     debug_port;                       // Debug Port
   uint8_t     fast_clock;                       // Fast Clock Flag
-  uint8_t     padding[2];
+  uint8_t    shift_clock;                       // SWD Shift Engine Clock Flag
+  uint8_t     padding[1];
   uint32_t   clock_delay;                       // Clock Delay
   uint32_t     timestamp;                       // Last captured Timestamp
   struct {                                      // Transfer Configuration
@@ -242,6 +243,7 @@ extern uint32_t JTAG_ReadIDCode (void);
 extern void     JTAG_WriteAbort (uint32_t data);
 extern uint8_t  JTAG_Transfer   (uint32_t request, uint32_t *data);
 extern uint8_t  SWD_Transfer    (uint32_t request, uint32_t *data);
+extern uint8_t  SWD_TransferBlock (uint32_t request, const uint8_t *wdata, uint8_t *rdata, uint32_t count, uint32_t *num);
 
 extern void     Delayms         (uint32_t delay);
 
@@ -275,6 +277,11 @@ extern uint32_t DAP_ExecuteCommand       (const uint8_t *request, uint8_t *respo
 
 extern void     DAP_Setup (void);
 
+// SWD Shift Engine (SWD_SHIFT_CLOCK, SWD_SHIFT_OUT, SWD_SHIFT_IN in DAP_config.h)
+#ifndef DAP_SWD_SHIFT
+#define DAP_SWD_SHIFT           0       // 1 = available, 0 = GPIO bit-banging only
+#endif
+
 // Configurable delay for clock generation
 #ifndef DELAY_SLOW_CYCLES
 #define DELAY_SLOW_CYCLES       3U      // Number of cycles for one iteration
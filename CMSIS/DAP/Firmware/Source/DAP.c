@@ -395,6 +395,10 @@ static uint32_t DAP_SWJ_Clock(const uint8_t *request, uint8_t *response) {
     DAP_Data.clock_delay = delay;
   }
 
+#if ((DAP_SWD != 0) && (DAP_SWD_SHIFT != 0))
+  DAP_Data.shift_clock = (uint8_t)SWD_SHIFT_CLOCK(clock);
+#endif
+
   *response = DAP_OK;
 #else
   *response = DAP_ERROR;
@@ -1270,8 +1274,6 @@ static uint32_t DAP_SWD_TransferBlock(const uint8_t *request, uint8_t *response)
   uint32_t  response_count;
   uint32_t  response_value;
   uint8_t  *response_head;
-  uint32_t  retry;
-  uint32_t  data;
 
   response_count = 0U;
   response_value = 0U;
@@ -1291,61 +1293,12 @@ static uint32_t DAP_SWD_TransferBlock(const uint8_t *request, uint8_t *response)
 
   request_value = *request++;
   if ((request_value & DAP_TRANSFER_RnW) != 0U) {
-    // Read register block
-    if ((request_value & DAP_TRANSFER_APnDP) != 0U) {
-      // Post AP read
-      retry = DAP_Data.transfer.retry_count;
-      do {
-        response_value = SWD_Transfer(request_value, NULL);
-      } while ((response_value == DAP_TRANSFER_WAIT) && retry-- && !DAP_TransferAbort);
-      if (response_value != DAP_TRANSFER_OK) {
-        goto end;
-      }
-    }
-    while (request_count--) {
-      // Read DP/AP register
-      if ((request_count == 0U) && ((request_value & DAP_TRANSFER_APnDP) != 0U)) {
-        // Last AP read
-        request_value = DP_RDBUFF | DAP_TRANSFER_RnW;
-      }
-      retry = DAP_Data.transfer.retry_count;
-      do {
-        response_value = SWD_Transfer(request_value, &data);
-      } while ((response_value == DAP_TRANSFER_WAIT) && retry-- && !DAP_TransferAbort);
-      if (response_value != DAP_TRANSFER_OK) {
-        goto end;
-      }
-      // Store data
-      *response++ = (uint8_t) data;
-      *response++ = (uint8_t)(data >>  8);
-      *response++ = (uint8_t)(data >> 16);
-      *response++ = (uint8_t)(data >> 24);
-      response_count++;
-    }
+    // Read register block (data stored directly into the response)
+    response_value = SWD_TransferBlock(request_value, NULL, response, request_count, &response_count);
+    response += response_count * 4U;
   } else {
-    // Write register block
-    while (request_count--) {
-      // Load data
-      data = (uint32_t)(*(request+0) <<  0) |
-             (uint32_t)(*(request+1) <<  8) |
-             (uint32_t)(*(request+2) << 16) |
-             (uint32_t)(*(request+3) << 24);
-      request += 4;
-      // Write DP/AP register
-      retry = DAP_Data.transfer.retry_count;
-      do {
-        response_value = SWD_Transfer(request_value, &data);
-      } while ((response_value == DAP_TRANSFER_WAIT) && retry-- && !DAP_TransferAbort);
-      if (response_value != DAP_TRANSFER_OK) {
-        goto end;
-      }
-      response_count++;
-    }
-    // Check last write
-    retry = DAP_Data.transfer.retry_count;
-    do {
-      response_value = SWD_Transfer(DP_RDBUFF | DAP_TRANSFER_RnW, NULL);
-    } while ((response_value == DAP_TRANSFER_WAIT) && retry-- && !DAP_TransferAbort);
+    // Write register block (data taken directly from the request)
+    response_value = SWD_TransferBlock(request_value, request, NULL, request_count, &response_count);
   }
 
 end:
@@ -1752,6 +1705,7 @@ void DAP_Setup(void) {
   // Default settings
   DAP_Data.debug_port  = 0U;
   DAP_Data.fast_clock  = 0U;
+  DAP_Data.shift_clock = 0U;
   DAP_Data.clock_delay = CLOCK_DELAY(DAP_DEFAULT_SWJ_CLOCK);
   DAP_Data.transfer.idle_cycles = 0U;
   DAP_Data.transfer.retry_count = 100U;
@@ -1766,4 +1720,8 @@ void DAP_Setup(void) {
 #endif
 
   DAP_SETUP();  // Device specific setup
+
+#if ((DAP_SWD != 0) && (DAP_SWD_SHIFT != 0))
+  DAP_Data.shift_clock = (uint8_t)SWD_SHIFT_CLOCK(DAP_DEFAULT_SWJ_CLOCK);
+#endif
 }
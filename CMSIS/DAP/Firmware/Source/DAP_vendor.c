@@ -28,6 +28,402 @@
 #include "DAP_config.h"
 #include "DAP.h"
 
+// Vendor Command IDs of the flash programming and verify accelerator
+#define ID_DAP_MemoryCRC32      ID_DAP_Vendor1
+#define ID_DAP_FlashSetup       ID_DAP_Vendor2
+#define ID_DAP_FlashCall        ID_DAP_Vendor3
+#define ID_DAP_FlashProgram     ID_DAP_Vendor4
+
+// Cortex-M Debug Core Registers
+#define DHCSR                   0xE000EDF0U     // Debug Halting Control and Status
+#define DCRSR                   0xE000EDF4U     // Debug Core Register Selector
+#define DCRDR                   0xE000EDF8U     // Debug Core Register Data
+
+#define DHCSR_DBGKEY            0xA05F0000U
+#define DHCSR_C_DEBUGEN         (1U<<0)
+#define DHCSR_S_REGRDY          (1U<<16)
+#define DHCSR_S_HALT            (1U<<17)
+#define DCRSR_REGWnR            (1U<<16)
+
+#define REG_R9                  9U
+#define REG_SP                  13U
+#define REG_LR                  14U
+#define REG_PC                  15U
+#define REG_xPSR                16U
+
+#define MEM_AP_TAR              0x04U           // MEM-AP Transfer Address
+#define MEM_AP_DRW              0x0CU           // MEM-AP Data Read/Write
+
+// Flash algorithm set by DAP_FlashSetup
+static struct {
+  uint32_t breakpoint;                  // Return address (BKPT instruction)
+  uint32_t static_base;                 // Static base (R9)
+  uint32_t stack_pointer;               // Stack pointer
+  uint32_t buffer;                      // Page buffer in target RAM
+  uint32_t program_page;                // ProgramPage function entry
+  uint32_t page_size;                   // Page size in bytes
+  uint32_t timeout;                     // Maximum DHCSR polls per function call
+} FlashAlgo;
+
+#if (DAP_JTAG != 0)
+static uint32_t VendorIR;               // JTAG IR of the last vendor transfer
+#endif
+
+// CRC32 (IEEE 802.3, reflected) table for 4-bit steps
+static const uint32_t CRC32_Table[16] = {
+  0x00000000U, 0x1DB71064U, 0x3B6E20C8U, 0x26D930ACU,
+  0x76DC4190U, 0x6B6B51F4U, 0x4DB26158U, 0x5005713CU,
+  0xEDB88320U, 0xF00F9344U, 0xD6D6A3E8U, 0xCB61B38CU,
+  0x9B64C2B0U, 0x86D3D2D4U, 0xA00AE278U, 0xBDBDF21CU
+};
+
+
+// Get 32-bit value from request (little-endian)
+//   request: pointer to request data
+//   return:  value
+static uint32_t Vendor_Get32 (const uint8_t *request) {
+  return ((uint32_t)(*(request+0) <<  0) |
+          (uint32_t)(*(request+1) <<  8) |
+          (uint32_t)(*(request+2) << 16) |
+          (uint32_t)(*(request+3) << 24));
+}
+
+// Put 32-bit value into response (little-endian)
+//   response: pointer to response data
+//   data:     value
+static void Vendor_Put32 (uint8_t *response, uint32_t data) {
+  *(response+0) = (uint8_t)(data >>  0);
+  *(response+1) = (uint8_t)(data >>  8);
+  *(response+2) = (uint8_t)(data >> 16);
+  *(response+3) = (uint8_t)(data >> 24);
+}
+
+
+// DP/AP register transfer on the active Debug Port with WAIT retries
+//   request: A[3:2] RnW APnDP
+//   data:    DATA[31:0]
+//   return:  ACK[2:0]
+static uint8_t Vendor_Transfer (uint32_t request, uint32_t *data) {
+  uint32_t retry;
+  uint8_t  ack;
+#if (DAP_JTAG != 0)
+  uint32_t ir;
+#endif
+
+  ack   = DAP_TRANSFER_ERROR;
+  retry = DAP_Data.transfer.retry_count;
+  do {
+#if (DAP_SWD != 0)
+    if (DAP_Data.debug_port == DAP_PORT_SWD) {
+      ack = SWD_Transfer(request, data);
+    }
+#endif
+#if (DAP_JTAG != 0)
+    if (DAP_Data.debug_port == DAP_PORT_JTAG) {
+      ir = ((request & DAP_TRANSFER_APnDP) != 0U) ? JTAG_APACC : JTAG_DPACC;
+      if (ir != VendorIR) {
+        VendorIR = ir;
+        JTAG_IR(ir);
+      }
+      ack = JTAG_Transfer(request, data);
+    }
+#endif
+  } while ((ack == DAP_TRANSFER_WAIT) && retry-- && !DAP_TransferAbort);
+
+  return (ack);
+}
+
+// Write target memory word through the MEM-AP
+//   addr:   word address
+//   data:   value
+//   return: ACK[2:0]
+static uint8_t Vendor_WriteMem (uint32_t addr, uint32_t data) {
+  uint8_t ack;
+
+  ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_TAR, &addr);
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_DRW, &data);
+  }
+  return (ack);
+}
+
+// Read target memory word through the MEM-AP
+//   addr:   word address
+//   data:   pointer to value
+//   return: ACK[2:0]
+static uint8_t Vendor_ReadMem (uint32_t addr, uint32_t *data) {
+  uint8_t ack;
+
+  ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_TAR, &addr);
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_DRW | DAP_TRANSFER_RnW, NULL);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_Transfer(DP_RDBUFF | DAP_TRANSFER_RnW, data);
+  }
+  return (ack);
+}
+
+// Get number of words up to the next TAR auto-increment boundary (1kB)
+//   addr:   word address
+//   count:  number of words requested
+//   return: number of words
+static uint32_t Vendor_BlockWords (uint32_t addr, uint32_t count) {
+  uint32_t n;
+
+  n = (0x400U - (addr & 0x3FFU)) >> 2;
+  return ((count < n) ? count : n);
+}
+
+// Write target memory block through the MEM-AP (32-bit, auto-increment)
+//   addr:   word address
+//   data:   data (4 bytes per word, little-endian)
+//   count:  number of words
+//   return: ACK[2:0]
+static uint8_t Vendor_WriteBlock (uint32_t addr, const uint8_t *data, uint32_t count) {
+  uint32_t val;
+  uint32_t n;
+  uint8_t  ack;
+
+  ack = DAP_TRANSFER_OK;
+  while ((count != 0U) && (ack == DAP_TRANSFER_OK)) {
+    n = Vendor_BlockWords(addr, count);
+    ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_TAR, &addr);
+    addr  += n << 2;
+    count -= n;
+    for (; n && (ack == DAP_TRANSFER_OK); n--) {
+      val = Vendor_Get32(data);
+      data += 4;
+      ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_DRW, &val);
+    }
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    // Check last write
+    ack = Vendor_Transfer(DP_RDBUFF | DAP_TRANSFER_RnW, NULL);
+  }
+  return (ack);
+}
+
+// Wait for S_REGRDY after a core register transfer
+//   return: ACK[2:0] (DAP_TRANSFER_ERROR on timeout)
+static uint8_t Vendor_WaitRegReady (void) {
+  uint32_t retry;
+  uint32_t val;
+  uint8_t  ack;
+
+  retry = DAP_Data.transfer.match_retry;
+  do {
+    ack = Vendor_ReadMem(DHCSR, &val);
+    if ((ack == DAP_TRANSFER_OK) && ((val & DHCSR_S_REGRDY) != 0U)) {
+      return (DAP_TRANSFER_OK);
+    }
+  } while ((ack == DAP_TRANSFER_OK) && retry-- && !DAP_TransferAbort);
+
+  return ((ack == DAP_TRANSFER_OK) ? DAP_TRANSFER_ERROR : ack);
+}
+
+// Write halted core register
+//   reg:    register selector (DCRSR REGSEL)
+//   data:   value
+//   return: ACK[2:0]
+static uint8_t Vendor_WriteCoreReg (uint32_t reg, uint32_t data) {
+  uint8_t ack;
+
+  ack = Vendor_WriteMem(DCRDR, data);
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteMem(DCRSR, DCRSR_REGWnR | reg);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WaitRegReady();
+  }
+  return (ack);
+}
+
+// Call function on the halted core and wait until it returns to the breakpoint
+//   entry:  function entry address
+//   args:   arguments R0..R3
+//   result: pointer to function result (R0)
+//   return: DAP_OK or DAP_ERROR
+static uint8_t Vendor_CallFunction (uint32_t entry, const uint32_t *args, uint32_t *result) {
+  uint32_t timeout;
+  uint32_t val;
+  uint32_t n;
+  uint8_t  ack;
+
+  ack = DAP_TRANSFER_OK;
+  for (n = 0U; (n < 4U) && (ack == DAP_TRANSFER_OK); n++) {
+    ack = Vendor_WriteCoreReg(n, args[n]);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteCoreReg(REG_R9, FlashAlgo.static_base);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteCoreReg(REG_SP, FlashAlgo.stack_pointer);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteCoreReg(REG_LR, FlashAlgo.breakpoint | 1U);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteCoreReg(REG_PC, entry);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteCoreReg(REG_xPSR, 0x01000000U);   // Thumb state
+  }
+
+  // Run until the function returns to the breakpoint
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteMem(DHCSR, DHCSR_DBGKEY | DHCSR_C_DEBUGEN);
+  }
+  timeout = FlashAlgo.timeout;
+  val = 0U;
+  while ((ack == DAP_TRANSFER_OK) && ((val & DHCSR_S_HALT) == 0U)) {
+    if ((timeout-- == 0U) || DAP_TransferAbort) {
+      return (DAP_ERROR);
+    }
+    ack = Vendor_ReadMem(DHCSR, &val);
+  }
+
+  // Read result
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WriteMem(DCRSR, 0U);
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_WaitRegReady();
+  }
+  if (ack == DAP_TRANSFER_OK) {
+    ack = Vendor_ReadMem(DCRDR, result);
+  }
+
+  return ((ack == DAP_TRANSFER_OK) ? DAP_OK : DAP_ERROR);
+}
+
+
+// Process Memory CRC32 command and prepare response
+//   request:  pointer to request data
+//   response: pointer to response data
+//   return:   number of bytes in response (lower 16 bits)
+//             number of bytes in request (upper 16 bits)
+static uint32_t DAP_MemoryCRC32 (const uint8_t *request, uint8_t *response) {
+  uint32_t addr;
+  uint32_t size;
+  uint32_t crc;
+  uint32_t val;
+  uint32_t n;
+  uint32_t bytes;
+  uint8_t  ack;
+
+  addr = Vendor_Get32(request+0);
+  size = Vendor_Get32(request+4);
+  crc  = 0xFFFFFFFFU;
+  ack  = ((addr & 3U) == 0U) ? DAP_TRANSFER_OK : DAP_TRANSFER_ERROR;
+
+  while ((size != 0U) && (ack == DAP_TRANSFER_OK)) {
+    n = Vendor_BlockWords(addr, (size + 3U) >> 2);
+    ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_TAR, &addr);
+    addr += n << 2;
+    if (ack == DAP_TRANSFER_OK) {
+      // Post AP read: each following read returns the previous result
+      ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_DRW | DAP_TRANSFER_RnW, NULL);
+    }
+    for (; n && (ack == DAP_TRANSFER_OK); n--) {
+      if (n == 1U) {
+        ack = Vendor_Transfer(DP_RDBUFF | DAP_TRANSFER_RnW, &val);
+      } else {
+        ack = Vendor_Transfer(DAP_TRANSFER_APnDP | MEM_AP_DRW | DAP_TRANSFER_RnW, &val);
+      }
+      bytes = (size < 4U) ? size : 4U;
+      size -= bytes;
+      for (; bytes; bytes--) {
+        crc ^= val & 0xFFU;
+        crc  = CRC32_Table[crc & 0x0FU] ^ (crc >> 4);
+        crc  = CRC32_Table[crc & 0x0FU] ^ (crc >> 4);
+        val >>= 8;
+      }
+    }
+  }
+
+  *response = (ack == DAP_TRANSFER_OK) ? DAP_OK : DAP_ERROR;
+  Vendor_Put32(response+1, ~crc);
+  return ((8U << 16) | 5U);
+}
+
+// Process Flash Setup command and prepare response
+//   request:  pointer to request data
+//   response: pointer to response data
+//   return:   number of bytes in response (lower 16 bits)
+//             number of bytes in request (upper 16 bits)
+static uint32_t DAP_FlashSetup (const uint8_t *request, uint8_t *response) {
+
+  FlashAlgo.breakpoint    = Vendor_Get32(request+0);
+  FlashAlgo.static_base   = Vendor_Get32(request+4);
+  FlashAlgo.stack_pointer = Vendor_Get32(request+8);
+  FlashAlgo.buffer        = Vendor_Get32(request+12);
+  FlashAlgo.program_page  = Vendor_Get32(request+16);
+  FlashAlgo.page_size     = Vendor_Get32(request+20);
+  FlashAlgo.timeout       = Vendor_Get32(request+24);
+
+  *response = (((FlashAlgo.buffer | FlashAlgo.page_size) & 3U) == 0U) ? DAP_OK : DAP_ERROR;
+  return ((28U << 16) | 1U);
+}
+
+// Process Flash Call command and prepare response
+//   request:  pointer to request data
+//   response: pointer to response data
+//   return:   number of bytes in response (lower 16 bits)
+//             number of bytes in request (upper 16 bits)
+static uint32_t DAP_FlashCall (const uint8_t *request, uint8_t *response) {
+  uint32_t args[4];
+  uint32_t result;
+  uint32_t n;
+
+  for (n = 0U; n < 4U; n++) {
+    args[n] = Vendor_Get32(request + 4U + (n * 4U));
+  }
+  result = 0U;
+  *response = Vendor_CallFunction(Vendor_Get32(request), args, &result);
+  Vendor_Put32(response+1, result);
+  return ((20U << 16) | 5U);
+}
+
+// Process Flash Program command and prepare response
+//   request:  pointer to request data
+//   response: pointer to response data
+//   return:   number of bytes in response (lower 16 bits)
+//             number of bytes in request (upper 16 bits)
+static uint32_t DAP_FlashProgram (const uint8_t *request, uint8_t *response) {
+  uint32_t args[4];
+  uint32_t offset;
+  uint32_t count;
+  uint32_t result;
+  uint8_t  status;
+
+  args[0] = Vendor_Get32(request);
+  offset  = (uint32_t)(*(request+4) << 0) |
+            (uint32_t)(*(request+5) << 8);
+  count   = (uint32_t)(*(request+6) << 0) |
+            (uint32_t)(*(request+7) << 8);
+  result  = 0U;
+
+  if ((((offset | count) & 3U) != 0U) || ((offset + count) > FlashAlgo.page_size)) {
+    status = DAP_ERROR;
+  } else if (Vendor_WriteBlock(FlashAlgo.buffer + offset, request+8, count >> 2) != DAP_TRANSFER_OK) {
+    status = DAP_ERROR;
+  } else if ((offset + count) == FlashAlgo.page_size) {
+    // Page buffer complete: ProgramPage(address, size, buffer)
+    args[1] = FlashAlgo.page_size;
+    args[2] = FlashAlgo.buffer;
+    args[3] = 0U;
+    status  = Vendor_CallFunction(FlashAlgo.program_page, args, &result);
+  } else {
+    status = DAP_OK;
+  }
+
+  *response = status;
+  Vendor_Put32(response+1, result);
+  return (((8U + count) << 16) | 5U);
+}
+
+
 //**************************************************************************************************
 /** 
 \defgroup DAP_Vendor_Adapt_gr Adapt Vendor Commands
@@ -37,6 +433,31 @@
 The file DAP_vendor.c provides template source code for extension of a Debug Unit with 
 Vendor Commands. Copy this file to the project folder of the Debug Unit and add the 
 file to the MDK-ARM project under the file group Configuration.
+
+The template implements a flash programming and verify accelerator that runs on the Debug Unit.
+A flash download then needs one command per page instead of separate commands to write the 
+page buffer, set the core registers, resume the core, poll for halt, and read back the result. 
+The commands access the target through the MEM-AP selected with DP SELECT and expect CSW set to 
+32-bit access with auto-increment. The flash algorithm (CMSIS-Pack FLM) is loaded into target RAM
+by the host and the core is halted.
+
+Vendor Command          | Request                                               | Response
+----------------------- | ----------------------------------------------------- | ------------------
+\b Vendor1: MemoryCRC32 | Address, Size                                         | Status, CRC32
+\b Vendor2: FlashSetup  | Breakpoint, StaticBase, Stack, Buffer, ProgramPage, PageSize, Timeout | Status
+\b Vendor3: FlashCall   | Entry, R0, R1, R2, R3                                 | Status, R0
+\b Vendor4: FlashProgram | Address, Offset (U16), Count (U16), Data[Count]       | Status, R0
+
+ - All values are 32-bit little-endian unless noted. Status is DAP_OK or DAP_ERROR.
+ - \b MemoryCRC32 returns the CRC32 (IEEE 802.3, as zlib crc32) of \em Size bytes at the word aligned \em Address.
+ - \b FlashSetup sets the return \em Breakpoint (address of a BKPT instruction), the static base (R9), the stack,
+   the page buffer in target RAM, the ProgramPage entry, the page size, and the maximum number of DHCSR polls
+   while a function runs.
+ - \b FlashCall runs a function of the flash algorithm (for example Init, EraseSector, or UnInit) and
+   returns its result.
+ - \b FlashProgram writes \em Data to the page buffer at \em Offset. When the page buffer is complete
+   (\em Offset + \em Count = page size), ProgramPage(Address, PageSize, Buffer) is called and its result
+   returned; otherwise R0 is 0.
 */
 
 /** Process DAP Vendor Command and prepare Response Data
@@ -50,6 +471,11 @@ uint32_t DAP_ProcessVendorCommand(const uint8_t *request, uint8_t *response) {
 
   *response++ = *request;        // copy Command ID
 
+  DAP_TransferAbort = 0U;
+#if (DAP_JTAG != 0)
+  VendorIR = 0U;
+#endif
+
   switch (*request++) {          // first byte in request is Command ID
     case ID_DAP_Vendor0:
 #if 0                            // example user command
@@ -61,10 +487,19 @@ uint32_t DAP_ProcessVendorCommand(const uint8_t *request, uint8_t *response) {
 #endif
       break;
 
-    case ID_DAP_Vendor1:  break;
-    case ID_DAP_Vendor2:  break;
-    case ID_DAP_Vendor3:  break;
-    case ID_DAP_Vendor4:  break;
+    case ID_DAP_MemoryCRC32:
+      num += DAP_MemoryCRC32(request, response);
+      break;
+    case ID_DAP_FlashSetup:
+      num += DAP_FlashSetup(request, response);
+      break;
+    case ID_DAP_FlashCall:
+      num += DAP_FlashCall(request, response);
+      break;
+    case ID_DAP_FlashProgram:
+      num += DAP_FlashProgram(request, response);
+      break;
+
     case ID_DAP_Vendor5:  break;
     case ID_DAP_Vendor6:  break;
     case ID_DAP_Vendor7:  break;
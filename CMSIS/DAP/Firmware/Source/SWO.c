@@ -65,6 +65,10 @@ static uint8_t USART_Ready = 0U;
 #define USB_BLOCK_SIZE          512U    /* USB Block Size */
 #define TRACE_BLOCK_SIZE        64U     /* Trace Block Size (2^n: 32...512) */
 
+#if ((SWO_STREAM != 0) && (SWO_BUFFER_SIZE < (2U * USB_BLOCK_SIZE)))
+#error "SWO Streaming Trace requires SWO_BUFFER_SIZE of at least 2 USB blocks!"
+#endif
+
 // Trace State
 static uint8_t  TraceTransport =  0U;       /* Trace Transport */
 static uint8_t  TraceMode      =  0U;       /* Trace Mode */
@@ -98,6 +102,8 @@ static void     SetTraceError  (uint8_t flag);
 extern osThreadId_t      SWO_ThreadId;
 static volatile uint8_t  TransferBusy = 0U; /* Transfer Busy Flag */
 static          uint32_t TransferSize;      /* Current Transfer Size */
+
+static uint32_t StreamTrace    (uint32_t flush);
 #endif
 
 
@@ -130,6 +136,12 @@ static void USART_Callback (uint32_t event) {
       pUSART->Receive(&TraceBuf[index_i], num);
     } else {
       TraceStatus = DAP_SWO_CAPTURE_ACTIVE | DAP_SWO_CAPTURE_PAUSED;
+#if (SWO_STREAM != 0)
+      if (TraceTransport == 2U) {
+        // Streaming cannot throttle the target: trace data is lost
+        SetTraceError(DAP_SWO_BUFFER_OVERRUN);
+      }
+#endif
     }
     TraceUpdate = 1U;
 #if (SWO_STREAM != 0)
@@ -736,21 +748,61 @@ uint32_t SWO_Data (const uint8_t *request, uint8_t *response) {
 
 #if (SWO_STREAM != 0)
 
+// Queue next trace block for the SWO streaming endpoint
+//   flush:  0 - queue complete USB blocks only, 1 - queue all available data
+//   return: 1 - transfer queued, 0 - no data to transfer
+// The trace buffer is double-buffered in USB blocks: one block is transferred
+// while the next block is captured. TransferBusy is set by the caller.
+static uint32_t StreamTrace (uint32_t flush) {
+  uint32_t count;
+  uint32_t index;
+  uint32_t i, n;
+
+  count = GetTraceCount();
+  if (count == 0U) {
+    return (0U);
+  }
+  index = TraceIndexO & (SWO_BUFFER_SIZE - 1U);
+  n = SWO_BUFFER_SIZE - index;
+  if (count > n) {
+    count = n;
+  }
+  if (flush == 0U) {
+    i = index & (USB_BLOCK_SIZE - 1U);
+    if (i == 0U) {
+      count &= ~(USB_BLOCK_SIZE - 1U);
+    } else {
+      n = USB_BLOCK_SIZE - i;
+      if (count >= n) {
+        count = n;
+      } else {
+        count = 0U;
+      }
+    }
+  }
+  if (count == 0U) {
+    return (0U);
+  }
+  TransferSize = count;
+  SWO_QueueTransfer(&TraceBuf[index], count);
+  return (1U);
+}
+
 // SWO Data Transfer complete callback
 void SWO_TransferComplete (void) {
   TraceIndexO += TransferSize;
-  TransferBusy = 0U;
   ResumeTrace();
-  osThreadFlagsSet(SWO_ThreadId, 1U);
+  // Continue with the next complete block without waiting for the SWO Thread
+  if (((TraceStatus & DAP_SWO_CAPTURE_ACTIVE) == 0U) || (StreamTrace(0U) == 0U)) {
+    TransferBusy = 0U;
+    osThreadFlagsSet(SWO_ThreadId, 1U);
+  }
 }
 
 // SWO Thread
 __NO_RETURN void SWO_Thread (void *argument) {
   uint32_t timeout;
   uint32_t flags;
-  uint32_t count;
-  uint32_t index;
-  uint32_t i, n;
   (void)   argument;
 
   timeout = osWaitForever;
@@ -764,31 +816,9 @@ __NO_RETURN void SWO_Thread (void *argument) {
       flags   = osFlagsErrorTimeout;
     }
     if (TransferBusy == 0U) {
-      count = GetTraceCount();
-      if (count != 0U) {
-        index = TraceIndexO & (SWO_BUFFER_SIZE - 1U);
-        n = SWO_BUFFER_SIZE - index;
-        if (count > n) {
-          count = n;
-        }
-        if (flags != osFlagsErrorTimeout) {
-          i = index & (USB_BLOCK_SIZE - 1U);
-          if (i == 0U) {
-            count &= ~(USB_BLOCK_SIZE - 1U);
-          } else {
-            n = USB_BLOCK_SIZE - i;
-            if (count >= n) {
-              count = n;
-            } else {
-              count = 0U;
-            }
-          }
-        }
-        if (count != 0U) {
-          TransferSize = count;
-          TransferBusy = 1U;
-          SWO_QueueTransfer(&TraceBuf[index], count);
-        }
+      TransferBusy = 1U;
+      if (StreamTrace((flags == osFlagsErrorTimeout) ? 1U : 0U) == 0U) {
+        TransferBusy = 0U;
       }
     }
   }
@@ -129,6 +129,43 @@ void SWD_Sequence (uint32_t info, const uint8_t *swdo, uint8_t *swdi) {
 #if (DAP_SWD != 0)
 
 
+// Calculate parity of 32-bit value
+__STATIC_FORCEINLINE uint32_t SW_Parity (uint32_t val) {
+  val ^= val >> 16;
+  val ^= val >> 8;
+  val ^= val >> 4;
+  val ^= val >> 2;
+  val ^= val >> 1;
+  return (val & 1U);
+}
+
+
+// SWD field shift with GPIO bit-banging
+//   data:   field data (LSB first)
+//   count:  number of bits (0..32)
+//   return: captured field (LSB first)
+#define SWD_ShiftFunction(speed)        /**/                                    \
+__STATIC_FORCEINLINE void SWD_ShiftOut##speed (uint32_t data, uint32_t count) { \
+  for (; count; count--) {                                                      \
+    SW_WRITE_BIT(data);                                                         \
+    data >>= 1;                                                                 \
+  }                                                                             \
+}                                                                               \
+                                                                                \
+__STATIC_FORCEINLINE uint32_t SWD_ShiftIn##speed (uint32_t count) {             \
+  uint32_t bit;                                                                 \
+  uint32_t val;                                                                 \
+  uint32_t n;                                                                   \
+                                                                                \
+  val = 0U;                                                                     \
+  for (n = 0U; n < count; n++) {                                                \
+    SW_READ_BIT(bit);                                                           \
+    val |= bit << n;                                                            \
+  }                                                                             \
+  return (val);                                                                 \
+}
+
+
 // SWD Transfer I/O
 //   request: A[3:2] RnW APnDP
 //   data:    DATA[31:0]
@@ -138,93 +175,50 @@ static uint8_t SWD_Transfer##speed (uint32_t request, uint32_t *data) {
   uint32_t ack;                                                                 \
   uint32_t bit;                                                                 \
   uint32_t val;                                                                 \
-  uint32_t parity;                                                              \
-                                                                                \
   uint32_t n;                                                                   \
                                                                                 \
-  /* Packet Request */                                                          \
-  parity = 0U;                                                                  \
-  SW_WRITE_BIT(1U);                     /* Start Bit */                         \
-  bit = request >> 0;                                                           \
-  SW_WRITE_BIT(bit);                    /* APnDP Bit */                         \
-  parity += bit;                                                                \
-  bit = request >> 1;                                                           \
-  SW_WRITE_BIT(bit);                    /* RnW Bit */                           \
-  parity += bit;                                                                \
-  bit = request >> 2;                                                           \
-  SW_WRITE_BIT(bit);                    /* A2 Bit */                            \
-  parity += bit;                                                                \
-  bit = request >> 3;                                                           \
-  SW_WRITE_BIT(bit);                    /* A3 Bit */                            \
-  parity += bit;                                                                \
-  SW_WRITE_BIT(parity);                 /* Parity Bit */                        \
-  SW_WRITE_BIT(0U);                     /* Stop Bit */                          \
-  SW_WRITE_BIT(1U);                     /* Park Bit */                          \
+  /* Packet Request: Start, APnDP, RnW, A2, A3, Parity, Stop, Park */           \
+  val = request & 0x0FU;                                                        \
+  SWD_ShiftOut##speed(0x81U | (val << 1) | (SW_Parity(val) << 5), 8U);          \
                                                                                 \
   /* Turnaround */                                                              \
   PIN_SWDIO_OUT_DISABLE();                                                      \
-  for (n = DAP_Data.swd_conf.turnaround; n; n--) {                              \
-    SW_CLOCK_CYCLE();                                                           \
-  }                                                                             \
+  (void)SWD_ShiftIn##speed(DAP_Data.swd_conf.turnaround);                       \
                                                                                 \
   /* Acknowledge response */                                                    \
-  SW_READ_BIT(bit);                                                             \
-  ack  = bit << 0;                                                              \
-  SW_READ_BIT(bit);                                                             \
-  ack |= bit << 1;                                                              \
-  SW_READ_BIT(bit);                                                             \
-  ack |= bit << 2;                                                              \
+  ack = SWD_ShiftIn##speed(3U);                                                 \
                                                                                 \
   if (ack == DAP_TRANSFER_OK) {         /* OK response */                       \
     /* Data transfer */                                                         \
     if (request & DAP_TRANSFER_RnW) {                                           \
       /* Read data */                                                           \
-      val = 0U;                                                                 \
-      parity = 0U;                                                              \
-      for (n = 32U; n; n--) {                                                   \
-        SW_READ_BIT(bit);               /* Read RDATA[0:31] */                  \
-        parity += bit;                                                          \
-        val >>= 1;                                                              \
-        val  |= bit << 31;                                                      \
-      }                                                                         \
-      SW_READ_BIT(bit);                 /* Read Parity */                       \
-      if ((parity ^ bit) & 1U) {                                                \
+      val = SWD_ShiftIn##speed(32U);    /* Read RDATA[0:31] */                  \
+      bit = SWD_ShiftIn##speed(1U);     /* Read Parity */                       \
+      if (SW_Parity(val) != bit) {                                              \
         ack = DAP_TRANSFER_ERROR;                                               \
       }                                                                         \
       if (data) { *data = val; }                                                \
       /* Turnaround */                                                          \
-      for (n = DAP_Data.swd_conf.turnaround; n; n--) {                          \
-        SW_CLOCK_CYCLE();                                                       \
-      }                                                                         \
+      (void)SWD_ShiftIn##speed(DAP_Data.swd_conf.turnaround);                   \
       PIN_SWDIO_OUT_ENABLE();                                                   \
     } else {                                                                    \
       /* Turnaround */                                                          \
-      for (n = DAP_Data.swd_conf.turnaround; n; n--) {                          \
-        SW_CLOCK_CYCLE();                                                       \
-      }                                                                         \
+      (void)SWD_ShiftIn##speed(DAP_Data.swd_conf.turnaround);                   \
       PIN_SWDIO_OUT_ENABLE();                                                   \
       /* Write data */                                                          \
       val = *data;                                                              \
-      parity = 0U;                                                              \
-      for (n = 32U; n; n--) {                                                   \
-        SW_WRITE_BIT(val);              /* Write WDATA[0:31] */                 \
-        parity += val;                                                          \
-        val >>= 1;                                                              \
-      }                                                                         \
-      SW_WRITE_BIT(parity);             /* Write Parity Bit */                  \
+      SWD_ShiftOut##speed(val, 32U);    /* Write WDATA[0:31] */                 \
+      SWD_ShiftOut##speed(SW_Parity(val), 1U);  /* Write Parity Bit */          \
     }                                                                           \
     /* Capture Timestamp */                                                     \
     if (request & DAP_TRANSFER_TIMESTAMP) {                                     \
       DAP_Data.timestamp = TIMESTAMP_GET();                                     \
     }                                                                           \
     /* Idle cycles */                                                           \
-    n = DAP_Data.transfer.idle_cycles;                                          \
-    if (n) {                                                                    \
-      PIN_SWDIO_OUT(0U);                                                        \
-      for (; n; n--) {                                                          \
-        SW_CLOCK_CYCLE();                                                       \
-      }                                                                         \
+    for (n = DAP_Data.transfer.idle_cycles; n > 32U; n -= 32U) {                \
+      SWD_ShiftOut##speed(0U, 32U);                                             \
     }                                                                           \
+    SWD_ShiftOut##speed(0U, n);                                                 \
     PIN_SWDIO_OUT(1U);                                                          \
     return ((uint8_t)ack);                                                      \
   }                                                                             \
@@ -232,42 +226,167 @@ static uint8_t SWD_Transfer##speed (uint32_t request, uint32_t *data) {
   if ((ack == DAP_TRANSFER_WAIT) || (ack == DAP_TRANSFER_FAULT)) {              \
     /* WAIT or FAULT response */                                                \
     if (DAP_Data.swd_conf.data_phase && ((request & DAP_TRANSFER_RnW) != 0U)) { \
-      for (n = 32U+1U; n; n--) {                                                \
-        SW_CLOCK_CYCLE();               /* Dummy Read RDATA[0:31] + Parity */   \
-      }                                                                         \
+      (void)SWD_ShiftIn##speed(32U);    /* Dummy Read RDATA[0:31] */            \
+      (void)SWD_ShiftIn##speed(1U);     /* Dummy Read Parity */                 \
     }                                                                           \
     /* Turnaround */                                                            \
-    for (n = DAP_Data.swd_conf.turnaround; n; n--) {                            \
-      SW_CLOCK_CYCLE();                                                         \
-    }                                                                           \
+    (void)SWD_ShiftIn##speed(DAP_Data.swd_conf.turnaround);                     \
     PIN_SWDIO_OUT_ENABLE();                                                     \
     if (DAP_Data.swd_conf.data_phase && ((request & DAP_TRANSFER_RnW) == 0U)) { \
-      PIN_SWDIO_OUT(0U);                                                        \
-      for (n = 32U+1U; n; n--) {                                                \
-        SW_CLOCK_CYCLE();               /* Dummy Write WDATA[0:31] + Parity */  \
-      }                                                                         \
+      SWD_ShiftOut##speed(0U, 32U);     /* Dummy Write WDATA[0:31] */           \
+      SWD_ShiftOut##speed(0U, 1U);      /* Dummy Write Parity */                \
     }                                                                           \
     PIN_SWDIO_OUT(1U);                                                          \
     return ((uint8_t)ack);                                                      \
   }                                                                             \
                                                                                 \
   /* Protocol error */                                                          \
-  for (n = DAP_Data.swd_conf.turnaround + 32U + 1U; n; n--) {                   \
-    SW_CLOCK_CYCLE();                   /* Back off data phase */               \
-  }                                                                             \
+  (void)SWD_ShiftIn##speed(DAP_Data.swd_conf.turnaround);                       \
+  (void)SWD_ShiftIn##speed(32U);        /* Back off data phase */               \
+  (void)SWD_ShiftIn##speed(1U);                                                 \
   PIN_SWDIO_OUT_ENABLE();                                                       \
   PIN_SWDIO_OUT(1U);                                                            \
   return ((uint8_t)ack);                                                        \
 }
 
 
+// SWD Transfer I/O with WAIT retries (after a WAIT response)
+//   request: A[3:2] RnW APnDP
+//   data:    DATA[31:0]
+//   return:  ACK[2:0]
+#define SWD_TransferRetryFunction(speed) /**/                                   \
+static uint8_t SWD_TransferRetry##speed (uint32_t request, uint32_t *data) {    \
+  uint32_t retry;                                                               \
+  uint8_t  ack;                                                                 \
+                                                                                \
+  ack = DAP_TRANSFER_WAIT;                                                      \
+  retry = DAP_Data.transfer.retry_count;                                        \
+  while (retry-- && !DAP_TransferAbort) {                                       \
+    ack = SWD_Transfer##speed(request, data);                                   \
+    if (ack != DAP_TRANSFER_WAIT) {                                             \
+      break;                                                                    \
+    }                                                                           \
+  }                                                                             \
+  return (ack);                                                                 \
+}
+
+
+// SWD Transfer Block I/O
+//   request: A[3:2] RnW APnDP (same register for all transfers)
+//   wdata:   write data (4 bytes per transfer, little-endian)
+//   rdata:   read data (4 bytes per transfer, little-endian)
+//   count:   number of transfers (1 .. 65535)
+//   num:     number of completed transfers
+//   return:  ACK[2:0]
+#define SWD_TransferBlockFunction(speed) /**/                                   \
+static uint8_t SWD_TransferBlock##speed (uint32_t request,                      \
+                                         const uint8_t *wdata, uint8_t *rdata,  \
+                                         uint32_t count, uint32_t *num) {       \
+  uint32_t ack;                                                                 \
+  uint32_t val;                                                                 \
+  uint32_t n;                                                                   \
+                                                                                \
+  n = 0U;                                                                       \
+  if ((request & DAP_TRANSFER_RnW) != 0U) {                                     \
+    /* Read register block */                                                   \
+    if ((request & DAP_TRANSFER_APnDP) != 0U) {                                 \
+      /* Post AP read: each following read returns the previous result */      \
+      ack = SWD_Transfer##speed(request, NULL);                                 \
+      if (ack == DAP_TRANSFER_WAIT) {                                           \
+        ack = SWD_TransferRetry##speed(request, NULL);                          \
+      }                                                                         \
+      if (ack != DAP_TRANSFER_OK) {                                             \
+        *num = 0U;                                                              \
+        return ((uint8_t)ack);                                                  \
+      }                                                                         \
+      count--;                                                                  \
+    }                                                                           \
+    /* Read DP/AP registers (AP read pipeline stays full) */                    \
+    for (; n < count; n++) {                                                    \
+      ack = SWD_Transfer##speed(request, &val);                                 \
+      if (ack != DAP_TRANSFER_OK) {                                             \
+        if (ack == DAP_TRANSFER_WAIT) {                                         \
+          ack = SWD_TransferRetry##speed(request, &val);                        \
+        }                                                                       \
+        if (ack != DAP_TRANSFER_OK) {                                           \
+          *num = n;                                                             \
+          return ((uint8_t)ack);                                                \
+        }                                                                       \
+      }                                                                         \
+      rdata[0] = (uint8_t) val;                                                 \
+      rdata[1] = (uint8_t)(val >>  8);                                          \
+      rdata[2] = (uint8_t)(val >> 16);                                          \
+      rdata[3] = (uint8_t)(val >> 24);                                          \
+      rdata += 4;                                                               \
+    }                                                                           \
+    if ((request & DAP_TRANSFER_APnDP) != 0U) {                                 \
+      /* Last AP read */                                                        \
+      request = DP_RDBUFF | DAP_TRANSFER_RnW;                                   \
+      ack = SWD_Transfer##speed(request, &val);                                 \
+      if (ack == DAP_TRANSFER_WAIT) {                                           \
+        ack = SWD_TransferRetry##speed(request, &val);                          \
+      }                                                                         \
+      if (ack == DAP_TRANSFER_OK) {                                             \
+        rdata[0] = (uint8_t) val;                                               \
+        rdata[1] = (uint8_t)(val >>  8);                                        \
+        rdata[2] = (uint8_t)(val >> 16);                                        \
+        rdata[3] = (uint8_t)(val >> 24);                                        \
+        n++;                                                                    \
+      }                                                                         \
+    }                                                                           \
+  } else {                                                                      \
+    /* Write register block */                                                  \
+    for (; n < count; n++) {                                                    \
+      val = (uint32_t)(wdata[0] <<  0) |                                        \
+            (uint32_t)(wdata[1] <<  8) |                                        \
+            (uint32_t)(wdata[2] << 16) |                                        \
+            (uint32_t)(wdata[3] << 24);                                         \
+      wdata += 4;                                                               \
+      ack = SWD_Transfer##speed(request, &val);                                 \
+      if (ack != DAP_TRANSFER_OK) {                                             \
+        if (ack == DAP_TRANSFER_WAIT) {                                         \
+          ack = SWD_TransferRetry##speed(request, &val);                        \
+        }                                                                       \
+        if (ack != DAP_TRANSFER_OK) {                                           \
+          *num = n;                                                             \
+          return ((uint8_t)ack);                                                \
+        }                                                                       \
+      }                                                                         \
+    }                                                                           \
+    /* Check last write */                                                      \
+    request = DP_RDBUFF | DAP_TRANSFER_RnW;                                     \
+    ack = SWD_Transfer##speed(request, NULL);                                   \
+    if (ack == DAP_TRANSFER_WAIT) {                                             \
+      ack = SWD_TransferRetry##speed(request, NULL);                            \
+    }                                                                           \
+  }                                                                             \
+  *num = n;                                                                     \
+  return ((uint8_t)ack);                                                        \
+}
+
+
 #undef  PIN_DELAY
 #define PIN_DELAY() PIN_DELAY_FAST()
+SWD_ShiftFunction(Fast)
 SWD_TransferFunction(Fast)
+SWD_TransferRetryFunction(Fast)
+SWD_TransferBlockFunction(Fast)
 
 #undef  PIN_DELAY
 #define PIN_DELAY() PIN_DELAY_SLOW(DAP_Data.clock_delay)
+SWD_ShiftFunction(Slow)
 SWD_TransferFunction(Slow)
+SWD_TransferRetryFunction(Slow)
+SWD_TransferBlockFunction(Slow)
+
+#if (DAP_SWD_SHIFT != 0)
+// SWD fields shifted by the hardware-assisted engine of the Debug Unit
+#define SWD_ShiftOutEngine SWD_SHIFT_OUT
+#define SWD_ShiftInEngine  SWD_SHIFT_IN
+SWD_TransferFunction(Engine)
+SWD_TransferRetryFunction(Engine)
+SWD_TransferBlockFunction(Engine)
+#endif
 
 
 // SWD Transfer I/O
@@ -275,6 +394,11 @@ SWD_TransferFunction(Slow)
 //   data:    DATA[31:0]
 //   return:  ACK[2:0]
 uint8_t  SWD_Transfer(uint32_t request, uint32_t *data) {
+#if (DAP_SWD_SHIFT != 0)
+  if (DAP_Data.shift_clock) {
+    return SWD_TransferEngine(request, data);
+  }
+#endif
   if (DAP_Data.fast_clock) {
     return SWD_TransferFast(request, data);
   } else {
@@ -283,4 +407,26 @@ uint8_t  SWD_Transfer(uint32_t request, uint32_t *data) {
 }
 
 
+// SWD Transfer Block I/O
+//   request: A[3:2] RnW APnDP (same register for all transfers)
+//   wdata:   write data (4 bytes per transfer, little-endian)
+//   rdata:   read data (4 bytes per transfer, little-endian)
+//   count:   number of transfers (1 .. 65535)
+//   num:     number of completed transfers
+//   return:  ACK[2:0]
+uint8_t  SWD_TransferBlock(uint32_t request, const uint8_t *wdata, uint8_t *rdata,
+                           uint32_t count, uint32_t *num) {
+#if (DAP_SWD_SHIFT != 0)
+  if (DAP_Data.shift_clock) {
+    return SWD_TransferBlockEngine(request, wdata, rdata, count, num);
+  }
+#endif
+  if (DAP_Data.fast_clock) {
+    return SWD_TransferBlockFast(request, wdata, rdata, count, num);
+  } else {
+    return SWD_TransferBlockSlow(request, wdata, rdata, count, num);
+  }
+}
+
+
 #endif  /* (DAP_SWD != 0) */
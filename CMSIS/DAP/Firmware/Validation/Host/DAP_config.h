@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2013-2017 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      CMSIS-DAP Configuration
+ * Title:        DAP_config.h CMSIS-DAP Configuration File (Host Simulation)
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef __DAP_CONFIG_H__
+#define __DAP_CONFIG_H__
+
+#include <string.h>
+#include <time.h>
+#include "cmsis_compiler.h"
+#include "TargetSim.h"
+
+
+//**************************************************************************************************
+// CMSIS-DAP Debug Unit Information
+//
+// The Debug Unit runs as a host process. The I/O pins drive the simulated
+// SWJ-DP target in TargetSim.c.
+
+/// Processor Clock of the Debug Unit (host busy-wait loop calibration).
+#define CPU_CLOCK               100000000U      ///< Specifies the CPU Clock in Hz.
+
+/// Number of processor cycles for I/O Port write operations.
+#define IO_PORT_WRITE_CYCLES    2U              ///< I/O Cycles: 2=default, 1=Cortex-M0+ fast I/0.
+
+/// Indicate that Serial Wire Debug (SWD) communication mode is available at the Debug Access Port.
+#define DAP_SWD                 1               ///< SWD Mode:  1 = available, 0 = not available.
+
+/// Indicate that SWD packet fields are shifted by a hardware-assisted engine.
+/// The simulated engine clocks whole fields into the target without pin delays
+/// (build with DAP_SWD_SHIFT=0 to test GPIO bit-banging only).
+#ifndef DAP_SWD_SHIFT
+#define DAP_SWD_SHIFT           1               ///< SWD Shift Engine: 1 = available, 0 = not available.
+#endif
+
+/// Indicate that JTAG communication mode is available at the Debug Port.
+#define DAP_JTAG                1               ///< JTAG Mode: 1 = available, 0 = not available.
+
+/// Configure maximum number of JTAG devices on the scan chain connected to the Debug Access Port.
+#define DAP_JTAG_DEV_CNT        8U              ///< Maximum number of JTAG devices on scan chain.
+
+/// Default communication mode on the Debug Access Port.
+#define DAP_DEFAULT_PORT        1U              ///< Default JTAG/SWJ Port Mode: 1 = SWD, 2 = JTAG.
+
+/// Default communication speed on the Debug Access Port for SWD and JTAG mode.
+#define DAP_DEFAULT_SWJ_CLOCK   1000000U        ///< Default SWD/JTAG clock frequency in Hz.
+
+/// Maximum Package Size for Command and Response data.
+#define DAP_PACKET_SIZE         512U            ///< Specifies Packet Size in bytes.
+
+/// Maximum Package Buffers for Command and Response data.
+#define DAP_PACKET_COUNT        8U              ///< Specifies number of packets buffered.
+
+/// Indicate that UART Serial Wire Output (SWO) trace is available.
+#define SWO_UART                0               ///< SWO UART:  1 = available, 0 = not available.
+
+/// Maximum SWO UART Baudrate.
+#define SWO_UART_MAX_BAUDRATE   10000000U       ///< SWO UART Maximum Baudrate in Hz.
+
+/// Indicate that Manchester Serial Wire Output (SWO) trace is available.
+#define SWO_MANCHESTER          0               ///< SWO Manchester:  1 = available, 0 = not available.
+
+/// SWO Trace Buffer Size.
+#define SWO_BUFFER_SIZE         4096U           ///< SWO Trace Buffer Size in bytes (must be 2^n).
+
+/// SWO Streaming Trace.
+#define SWO_STREAM              0               ///< SWO Streaming Trace: 1 = available, 0 = not available.
+
+/// Clock frequency of the Test Domain Timer. Timer value is returned with \ref TIMESTAMP_GET.
+#define TIMESTAMP_CLOCK         1000000U        ///< Timestamp clock in Hz (0 = timestamps not supported).
+
+/// Debug Unit is connected to fixed Target Device.
+#define TARGET_DEVICE_FIXED     1               ///< Target Device: 1 = known, 0 = unknown;
+
+#if TARGET_DEVICE_FIXED
+#define TARGET_DEVICE_VENDOR    "ARM"           ///< String indicating the Silicon Vendor
+#define TARGET_DEVICE_NAME      "TargetSim"     ///< String indicating the Target Device
+#endif
+
+/** Get Vendor ID string.
+\param str Pointer to buffer to store the string.
+\return String length.
+*/
+__STATIC_INLINE uint8_t DAP_GetVendorString (char *str) {
+  (void)str;
+  return (0U);
+}
+
+/** Get Product ID string.
+\param str Pointer to buffer to store the string.
+\return String length.
+*/
+__STATIC_INLINE uint8_t DAP_GetProductString (char *str) {
+  static const char product[] = "CMSIS-DAP Host Simulation";
+
+  memcpy(str, product, sizeof(product));
+  return ((uint8_t)sizeof(product));
+}
+
+/** Get Serial Number string.
+\param str Pointer to buffer to store the string.
+\return String length.
+*/
+__STATIC_INLINE uint8_t DAP_GetSerNumString (char *str) {
+  (void)str;
+  return (0U);
+}
+
+
+//**************************************************************************************************
+// CMSIS-DAP Hardware I/O Pin Access (simulated target pins)
+
+// Configure DAP I/O pins ------------------------------
+
+/** Setup JTAG I/O pins: TCK, TMS, TDI, TDO, nTRST, and nRESET.
+*/
+__STATIC_INLINE void PORT_JTAG_SETUP (void) {
+  TargetSim_Pins.port_on   = 1U;
+  TargetSim_Pins.swclk_tck = 1U;
+  TargetSim_Pins.swdio_tms = 1U;
+  TargetSim_Pins.swdio_oe  = 1U;
+  TargetSim_Pins.tdi       = 1U;
+  TargetSim_Pins.ntrst     = 1U;
+  TargetSim_Pins.nreset    = 1U;
+}
+
+/** Setup SWD I/O pins: SWCLK, SWDIO, and nRESET.
+*/
+__STATIC_INLINE void PORT_SWD_SETUP (void) {
+  TargetSim_Pins.port_on   = 1U;
+  TargetSim_Pins.swclk_tck = 1U;
+  TargetSim_Pins.swdio_tms = 1U;
+  TargetSim_Pins.swdio_oe  = 1U;
+  TargetSim_Pins.ntrst     = 1U;
+  TargetSim_Pins.nreset    = 1U;
+}
+
+/** Disable JTAG/SWD I/O Pins.
+*/
+__STATIC_INLINE void PORT_OFF (void) {
+  TargetSim_Pins.port_on   = 0U;
+  TargetSim_Pins.swdio_oe  = 0U;
+  TargetSim_Pins.ntrst     = 1U;
+  TargetSim_Pins.nreset    = 1U;
+}
+
+
+// SWCLK/TCK I/O pin -------------------------------------
+
+__STATIC_FORCEINLINE uint32_t PIN_SWCLK_TCK_IN  (void) {
+  return (TargetSim_Pins.swclk_tck);
+}
+
+/** SWCLK/TCK I/O pin: Set Output to High (clocks the simulated target).
+*/
+__STATIC_FORCEINLINE void     PIN_SWCLK_TCK_SET (void) {
+  if (TargetSim_Pins.swclk_tck == 0U) {
+    TargetSim_Pins.swclk_tck = 1U;
+    TargetSim_Clock();
+  }
+}
+
+__STATIC_FORCEINLINE void     PIN_SWCLK_TCK_CLR (void) {
+  TargetSim_Pins.swclk_tck = 0U;
+}
+
+
+// SWDIO/TMS Pin I/O --------------------------------------
+
+__STATIC_FORCEINLINE uint32_t PIN_SWDIO_TMS_IN  (void) {
+  return (TargetSim_SWDIO());
+}
+
+__STATIC_FORCEINLINE void     PIN_SWDIO_TMS_SET (void) {
+  TargetSim_Pins.swdio_tms = 1U;
+}
+
+__STATIC_FORCEINLINE void     PIN_SWDIO_TMS_CLR (void) {
+  TargetSim_Pins.swdio_tms = 0U;
+}
+
+__STATIC_FORCEINLINE uint32_t PIN_SWDIO_IN      (void) {
+  return (TargetSim_SWDIO());
+}
+
+__STATIC_FORCEINLINE void     PIN_SWDIO_OUT     (uint32_t bit) {
+  TargetSim_Pins.swdio_tms = (uint8_t)(bit & 1U);
+}
+
+__STATIC_FORCEINLINE void     PIN_SWDIO_OUT_ENABLE  (void) {
+  TargetSim_Pins.swdio_oe = 1U;
+}
+
+__STATIC_FORCEINLINE void     PIN_SWDIO_OUT_DISABLE (void) {
+  TargetSim_Pins.swdio_oe = 0U;
+}
+
+
+// SWD Shift Engine ----------------------------------------
+
+/** SWD Shift Engine: Setup clock (simulated engine supports 1 MHz and above).
+\param clock requested SWCLK frequency in Hz.
+\return 1 = clock supported by the shift engine, 0 = use GPIO bit-banging.
+*/
+__STATIC_INLINE uint32_t SWD_SHIFT_CLOCK (uint32_t clock) {
+  return ((clock >= 1000000U) ? 1U : 0U);
+}
+
+/** SWD Shift Engine: Shift output field on SWDIO (LSB first).
+\param data  field data.
+\param count number of bits (0..32).
+*/
+__STATIC_FORCEINLINE void SWD_SHIFT_OUT (uint32_t data, uint32_t count) {
+  TargetSim_Stat.shift_fields++;
+  for (; count; count--) {
+    TargetSim_Pins.swdio_tms = (uint8_t)(data & 1U);
+    TargetSim_Pins.swclk_tck = 1U;
+    TargetSim_Clock();
+    data >>= 1;
+  }
+}
+
+/** SWD Shift Engine: Shift input field from SWDIO (LSB first).
+\param count number of bits (0..32).
+\return captured field.
+*/
+__STATIC_FORCEINLINE uint32_t SWD_SHIFT_IN (uint32_t count) {
+  uint32_t val;
+  uint32_t n;
+
+  TargetSim_Stat.shift_fields++;
+  val = 0U;
+  for (n = 0U; n < count; n++) {
+    val |= TargetSim_SWDIO() << n;
+    TargetSim_Pins.swclk_tck = 1U;
+    TargetSim_Clock();
+  }
+  return (val);
+}
+
+
+// TDI Pin I/O ---------------------------------------------
+
+__STATIC_FORCEINLINE uint32_t PIN_TDI_IN  (void) {
+  return (TargetSim_Pins.tdi);
+}
+
+__STATIC_FORCEINLINE void     PIN_TDI_OUT (uint32_t bit) {
+  TargetSim_Pins.tdi = (uint8_t)(bit & 1U);
+}
+
+
+// TDO Pin I/O ---------------------------------------------
+
+__STATIC_FORCEINLINE uint32_t PIN_TDO_IN  (void) {
+  return (TargetSim_TDO());
+}
+
+
+// nTRST Pin I/O -------------------------------------------
+
+__STATIC_FORCEINLINE uint32_t PIN_nTRST_IN   (void) {
+  return (TargetSim_Pins.ntrst);
+}
+
+__STATIC_FORCEINLINE void     PIN_nTRST_OUT  (uint32_t bit) {
+  TargetSim_Pins.ntrst = (uint8_t)(bit & 1U);
+}
+
+// nRESET Pin I/O------------------------------------------
+
+__STATIC_FORCEINLINE uint32_t PIN_nRESET_IN  (void) {
+  return (TargetSim_Pins.nreset);
+}
+
+__STATIC_FORCEINLINE void     PIN_nRESET_OUT (uint32_t bit) {
+  TargetSim_Pins.nreset = (uint8_t)(bit & 1U);
+}
+
+
+//**************************************************************************************************
+// CMSIS-DAP Hardware Status LEDs
+
+__STATIC_INLINE void LED_CONNECTED_OUT (uint32_t bit) { (void)bit; }
+
+__STATIC_INLINE void LED_RUNNING_OUT (uint32_t bit) { (void)bit; }
+
+
+//**************************************************************************************************
+// CMSIS-DAP Timestamp
+
+/** Get timestamp of Test Domain Timer (host monotonic clock in microseconds).
+\return Current timestamp value.
+*/
+__STATIC_INLINE uint32_t TIMESTAMP_GET (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint32_t)(((uint64_t)ts.tv_sec * 1000000U) + ((uint64_t)ts.tv_nsec / 1000U)));
+}
+
+
+//**************************************************************************************************
+// CMSIS-DAP Initialization
+
+__STATIC_INLINE void DAP_SETUP (void) {
+  PORT_OFF();
+}
+
+__STATIC_INLINE uint8_t RESET_TARGET (void) {
+  return (0U);
+}
+
+
+#endif /* __DAP_CONFIG_H__ */
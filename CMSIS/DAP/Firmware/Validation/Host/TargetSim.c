@@ -0,0 +1,942 @@
+/*
+ * Copyright (c) 2013-2017 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      CMSIS-DAP Validation
+ * Title:        TargetSim.c Simulated SWJ-DP target with MEM-AP
+ *
+ *---------------------------------------------------------------------------*/
+
+// The simulated target implements an ADIv5 SWJ-DP with one AHB MEM-AP (APSEL 0)
+// backed by a RAM image. It is clocked by the rising edges of SWCLK/TCK and
+// samples the Debug Unit pins set by the pin functions of DAP_config.h:
+//  - SWJ-DP switching sequences (JTAG-to-SWD 0xE79E, SWD-to-JTAG 0xE73C).
+//  - SWD: line reset, packet request with parity check, turnaround, ACK,
+//    read data with parity, write data with parity check (WDATAERR).
+//  - JTAG: TAP controller with 4-bit IR (ABORT, DPACC, APACC, IDCODE, BYPASS).
+//  - DP: CTRL/STAT power-up handshake, sticky errors, SELECT, RDBUFF, RESEND.
+//  - MEM-AP: CSW size and address increment, TAR, DRW, BD0..BD3, IDR.
+//  - Core debug: DHCSR halt/run, DCRSR/DCRDR core register transfers. The core
+//    executes a host function set by TargetSim_SetCore when it is resumed.
+// AP accesses may be answered with a configurable number of WAIT responses.
+
+#include <string.h>
+#include "DAP.h"
+#include "TargetSim.h"
+
+
+// DP CTRL/STAT bits
+#define CTRL_ORUNDETECT         (1U<<0)
+#define CTRL_STICKYORUN         (1U<<1)
+#define CTRL_STICKYCMP          (1U<<4)
+#define CTRL_STICKYERR          (1U<<5)
+#define CTRL_READOK             (1U<<6)
+#define CTRL_WDATAERR           (1U<<7)
+#define CTRL_CDBGRSTREQ         (1U<<26)
+#define CTRL_CDBGPWRUPREQ       (1U<<28)
+#define CTRL_CDBGPWRUPACK       (1U<<29)
+#define CTRL_CSYSPWRUPREQ       (1U<<30)
+#define CTRL_WRITE_MASK         0x543FFF0DU     // Writable bits
+#define CTRL_ACK_MASK           (CTRL_CSYSPWRUPREQ | CTRL_CDBGPWRUPREQ | CTRL_CDBGRSTREQ)
+#define CTRL_STICKY             (CTRL_STICKYORUN | CTRL_STICKYCMP | CTRL_STICKYERR | CTRL_WDATAERR)
+
+// DP ABORT bits
+#define ABORT_DAPABORT          (1U<<0)
+#define ABORT_STKCMPCLR         (1U<<1)
+#define ABORT_STKERRCLR         (1U<<2)
+#define ABORT_WDERRCLR          (1U<<3)
+#define ABORT_ORUNERRCLR        (1U<<4)
+
+// MEM-AP registers
+#define AP_CSW                  0x00U
+#define AP_TAR                  0x04U
+#define AP_DRW                  0x0CU
+#define AP_BD0                  0x10U
+#define AP_BD3                  0x1CU
+#define AP_CFG                  0xF4U
+#define AP_BASE                 0xF8U
+#define AP_IDR                  0xFCU
+
+#define CSW_SIZE                0x07U
+#define CSW_ADDRINC             0x30U
+#define CSW_ADDRINC_SINGLE      0x10U
+#define CSW_DEVICEEN            0x40U
+#define CSW_WRITE_MASK          0xFF00FF37U
+
+// Cortex-M debug registers
+#define CORE_DHCSR              0xE000EDF0U
+#define CORE_DCRSR              0xE000EDF4U
+#define CORE_DCRDR              0xE000EDF8U
+#define DHCSR_DBGKEY            0xA05F0000U
+#define DHCSR_C_MASK            0x0000000FU
+#define DHCSR_C_HALT            (1U<<1)
+#define DHCSR_S_REGRDY          (1U<<16)
+#define DHCSR_S_HALT            (1U<<17)
+#define DCRSR_REGWnR            (1U<<16)
+#define CORE_REGS               17U             // R0..R15, xPSR
+
+// SWD protocol states
+#define SWD_IDLE                0U
+#define SWD_REQUEST             1U
+#define SWD_TRN_ACK             2U
+#define SWD_ACK                 3U
+#define SWD_RDATA               4U
+#define SWD_TRN_WDATA           5U
+#define SWD_WDATA               6U
+
+// JTAG TAP controller states
+#define TAP_RESET               0U
+#define TAP_IDLE                1U
+#define TAP_SELECT_DR           2U
+#define TAP_CAPTURE_DR          3U
+#define TAP_SHIFT_DR            4U
+#define TAP_EXIT1_DR            5U
+#define TAP_PAUSE_DR            6U
+#define TAP_EXIT2_DR            7U
+#define TAP_UPDATE_DR           8U
+#define TAP_SELECT_IR           9U
+#define TAP_CAPTURE_IR          10U
+#define TAP_SHIFT_IR            11U
+#define TAP_EXIT1_IR            12U
+#define TAP_PAUSE_IR            13U
+#define TAP_EXIT2_IR            14U
+#define TAP_UPDATE_IR           15U
+
+// JTAG ACK (DR bits [2:0])
+#define JTAG_ACK_OK_FAULT       0x02U
+#define JTAG_ACK_WAIT           0x01U
+
+// TAP next state for TMS=0 and TMS=1
+static const uint8_t TapNext[16][2] = {
+  { TAP_IDLE,       TAP_RESET      },   // Test-Logic-Reset
+  { TAP_IDLE,       TAP_SELECT_DR  },   // Run-Test/Idle
+  { TAP_CAPTURE_DR, TAP_SELECT_IR  },   // Select-DR-Scan
+  { TAP_SHIFT_DR,   TAP_EXIT1_DR   },   // Capture-DR
+  { TAP_SHIFT_DR,   TAP_EXIT1_DR   },   // Shift-DR
+  { TAP_PAUSE_DR,   TAP_UPDATE_DR  },   // Exit1-DR
+  { TAP_PAUSE_DR,   TAP_EXIT2_DR   },   // Pause-DR
+  { TAP_SHIFT_DR,   TAP_UPDATE_DR  },   // Exit2-DR
+  { TAP_IDLE,       TAP_SELECT_DR  },   // Update-DR
+  { TAP_CAPTURE_IR, TAP_RESET      },   // Select-IR-Scan
+  { TAP_SHIFT_IR,   TAP_EXIT1_IR   },   // Capture-IR
+  { TAP_SHIFT_IR,   TAP_EXIT1_IR   },   // Shift-IR
+  { TAP_PAUSE_IR,   TAP_UPDATE_IR  },   // Exit1-IR
+  { TAP_PAUSE_IR,   TAP_EXIT2_IR   },   // Pause-IR
+  { TAP_SHIFT_IR,   TAP_UPDATE_IR  },   // Exit2-IR
+  { TAP_IDLE,       TAP_SELECT_DR  }    // Update-IR
+};
+
+
+TargetSim_Pins_t TargetSim_Pins;
+TargetSim_Stat_t TargetSim_Stat;
+
+// Target memory
+static uint8_t  *Ram;
+static uint32_t  RamBase;
+static uint32_t  RamSize;
+
+// SWJ-DP
+static uint32_t  Mode;                          // Wire mode
+static uint32_t  Ones;                          // Consecutive high SWDIO/TMS bits
+static uint32_t  SeqBits;                       // Last 16 SWDIO/TMS bits
+static uint32_t  SeqCount;                      // Bits since last 50 high bits
+
+// DP
+static uint32_t  CtrlStat;                      // CTRL/STAT
+static uint32_t  Select;                        // SELECT
+static uint32_t  Dlcr;                          // DLCR (SWD)
+static uint32_t  RdBuff;                        // Posted AP read result
+static uint32_t  Resend;                        // Last read result (SWD)
+static uint32_t  WaitCount;                     // WAIT responses per AP access
+static uint32_t  ApBusy;                        // WAIT responses pending
+
+// MEM-AP
+static uint32_t  Csw;
+static uint32_t  Tar;
+
+// Core debug
+static uint32_t  CoreReg[CORE_REGS];
+static uint32_t  Dhcsr;                         // DHCSR control bits
+static uint32_t  Dcrdr;
+static uint32_t  Halted;
+static uint32_t  RunPolls;                      // DHCSR reads until halt
+static uint32_t  CorePolls;
+static TargetSim_Run_t CoreRun;
+
+// SWD protocol
+static uint32_t  SwdState;
+static uint32_t  SwdCount;
+static uint32_t  SwdRequest;
+static uint32_t  SwdAck;
+static uint32_t  SwdData;
+static uint32_t  SwdDrive;                      // Target drives SWDIO
+static uint32_t  SwdOut;                        // Target SWDIO level
+static uint32_t  SwdLockout;                    // Line reset: only IDCODE read accepted
+
+// JTAG TAP
+static uint32_t  TapState;
+static uint32_t  TapTdo;
+static uint32_t  Ir;
+static uint32_t  IrShift;
+static uint64_t  DrShift;
+static uint32_t  DrLength;
+static uint32_t  JtagAck;
+static uint32_t  JtagResult;                    // Result returned by the next DR scan
+
+
+// Calculate parity of 32-bit value
+static uint32_t Parity (uint32_t val) {
+  val ^= val >> 16;
+  val ^= val >> 8;
+  val ^= val >> 4;
+  val ^= val >> 2;
+  val ^= val >> 1;
+  return (val & 1U);
+}
+
+
+// Access core debug registers (word access)
+//   addr:   DHCSR, DCRSR or DCRDR
+//   data:   pointer to data
+//   write:  0 = read, 1 = write
+static void CoreAccess (uint32_t addr, uint32_t *data, uint32_t write) {
+  uint32_t sel;
+
+  switch (addr) {
+    case CORE_DHCSR:
+      if (write) {
+        if ((*data & 0xFFFF0000U) == DHCSR_DBGKEY) {
+          Dhcsr = *data & DHCSR_C_MASK;
+          if ((Dhcsr & DHCSR_C_HALT) != 0U) {
+            Halted = 1U;
+          } else if (Halted != 0U) {
+            Halted   = 0U;
+            RunPolls = CorePolls;
+            TargetSim_Stat.core_runs++;
+          }
+        }
+      } else {
+        if (Halted == 0U) {
+          if (RunPolls == 0U) {
+            if (CoreRun != NULL) {
+              CoreRun(CoreReg);
+            }
+            CoreReg[15] = CoreReg[14] & ~1U;    // Return to LR (breakpoint)
+            Halted = 1U;
+          } else {
+            RunPolls--;
+          }
+        }
+        *data = Dhcsr | DHCSR_S_REGRDY | ((Halted != 0U) ? DHCSR_S_HALT : 0U);
+      }
+      break;
+    case CORE_DCRSR:
+      if (write) {
+        sel = *data & 0x7FU;
+        if ((Halted != 0U) && (sel < CORE_REGS)) {
+          if ((*data & DCRSR_REGWnR) != 0U) {
+            CoreReg[sel] = Dcrdr;
+          } else {
+            Dcrdr = CoreReg[sel];
+          }
+        }
+      } else {
+        *data = 0U;
+      }
+      break;
+    case CORE_DCRDR:
+      if (write) {
+        Dcrdr = *data;
+      } else {
+        *data = Dcrdr;
+      }
+      break;
+    default:
+      if (!write) {
+        *data = 0U;
+      }
+      break;
+  }
+}
+
+
+// Access target memory
+//   addr:   memory address
+//   size:   access size (0 = byte, 1 = halfword, 2 = word)
+//   data:   pointer to data (byte lanes as on the AHB bus)
+//   write:  0 = read, 1 = write
+//   return: 0 = OK, 1 = bus error
+static uint32_t MemAccess (uint32_t addr, uint32_t size, uint32_t *data, uint32_t write) {
+  uint32_t bytes = 1U << size;
+  uint32_t shift = (addr & 3U) * 8U;
+  uint32_t offset;
+  uint32_t val;
+  uint32_t n;
+
+  if ((size > 2U) || ((addr & (bytes - 1U)) != 0U)) {
+    return (1U);
+  }
+  if ((addr & ~0x0FU) == CORE_DHCSR) {
+    if (size != 2U) {
+      return (1U);
+    }
+    CoreAccess(addr, data, write);
+    return (0U);
+  }
+  offset = addr - RamBase;
+  if ((addr < RamBase) || (offset >= RamSize) || ((RamSize - offset) < bytes)) {
+    return (1U);
+  }
+
+  if (write) {
+    val = *data >> shift;
+    for (n = 0U; n < bytes; n++) {
+      Ram[offset + n] = (uint8_t)(val >> (n * 8U));
+    }
+  } else {
+    val = 0U;
+    for (n = 0U; n < bytes; n++) {
+      val |= (uint32_t)Ram[offset + n] << (n * 8U);
+    }
+    *data = val << shift;
+  }
+  return (0U);
+}
+
+
+// Increment MEM-AP transfer address (wraps within 1kB)
+static void TarIncrement (void) {
+  if ((Csw & CSW_ADDRINC) != 0U) {
+    Tar = (Tar & ~0x3FFU) | ((Tar + (1U << (Csw & CSW_SIZE))) & 0x3FFU);
+  }
+}
+
+
+// Read AP register
+//   addr:   A[7:2] (APBANKSEL and A[3:2])
+//   return: register value
+static uint32_t AP_Read (uint32_t addr) {
+  uint32_t val = 0U;
+
+  TargetSim_Stat.ap_reads++;
+
+  if ((CtrlStat & CTRL_CDBGPWRUPREQ) == 0U) {
+    CtrlStat |= CTRL_STICKYERR;
+    return (0U);
+  }
+  if ((Select >> 24) != 0U) {
+    return (0U);                                // No AP
+  }
+
+  switch (addr) {
+    case AP_CSW:
+      val = Csw | CSW_DEVICEEN;
+      break;
+    case AP_TAR:
+      val = Tar;
+      break;
+    case AP_DRW:
+      if (MemAccess(Tar, Csw & CSW_SIZE, &val, 0U) != 0U) {
+        CtrlStat |= CTRL_STICKYERR;
+        val = 0U;
+      }
+      TarIncrement();
+      break;
+    case AP_CFG:
+      val = 0U;
+      break;
+    case AP_BASE:
+      val = TARGETSIM_AP_BASE;
+      break;
+    case AP_IDR:
+      val = TARGETSIM_AP_IDR;
+      break;
+    default:
+      if ((addr >= AP_BD0) && (addr <= AP_BD3)) {
+        if (MemAccess((Tar & ~0x0FU) | (addr & 0x0CU), 2U, &val, 0U) != 0U) {
+          CtrlStat |= CTRL_STICKYERR;
+          val = 0U;
+        }
+      }
+      break;
+  }
+
+  CtrlStat |= CTRL_READOK;
+  return (val);
+}
+
+
+// Write AP register
+//   addr:   A[7:2] (APBANKSEL and A[3:2])
+//   data:   register value
+static void AP_Write (uint32_t addr, uint32_t data) {
+
+  TargetSim_Stat.ap_writes++;
+
+  if ((CtrlStat & CTRL_CDBGPWRUPREQ) == 0U) {
+    CtrlStat |= CTRL_STICKYERR;
+    return;
+  }
+  if ((Select >> 24) != 0U) {
+    return;                                     // No AP
+  }
+
+  switch (addr) {
+    case AP_CSW:
+      Csw = data & CSW_WRITE_MASK;
+      break;
+    case AP_TAR:
+      Tar = data;
+      break;
+    case AP_DRW:
+      if (MemAccess(Tar, Csw & CSW_SIZE, &data, 1U) != 0U) {
+        CtrlStat |= CTRL_STICKYERR;
+      }
+      TarIncrement();
+      break;
+    default:
+      if ((addr >= AP_BD0) && (addr <= AP_BD3)) {
+        if (MemAccess((Tar & ~0x0FU) | (addr & 0x0CU), 2U, &data, 1U) != 0U) {
+          CtrlStat |= CTRL_STICKYERR;
+        }
+      }
+      break;
+  }
+}
+
+
+// Write DP ABORT register
+static void DP_Abort (uint32_t data) {
+  if (data & ABORT_DAPABORT) {
+    ApBusy = 0U;
+  }
+  if (data & ABORT_STKCMPCLR) {
+    CtrlStat &= ~CTRL_STICKYCMP;
+  }
+  if (data & ABORT_STKERRCLR) {
+    CtrlStat &= ~CTRL_STICKYERR;
+  }
+  if (data & ABORT_WDERRCLR) {
+    CtrlStat &= ~CTRL_WDATAERR;
+  }
+  if (data & ABORT_ORUNERRCLR) {
+    CtrlStat &= ~CTRL_STICKYORUN;
+  }
+}
+
+
+// Read DP CTRL/STAT register (power-up requests are acknowledged immediately)
+static uint32_t DP_CtrlStat (void) {
+  return (CtrlStat | ((CtrlStat & CTRL_ACK_MASK) << 1));
+}
+
+
+// Write DP register (except ABORT)
+//   addr:   A[3:2]
+//   data:   register value
+static void DP_Write (uint32_t addr, uint32_t data) {
+
+  TargetSim_Stat.dp_writes++;
+
+  switch (addr) {
+    case DP_CTRL_STAT:
+      if ((Mode == TARGETSIM_MODE_SWD) && ((Select & 0x0FU) == 1U)) {
+        Dlcr = data & 0x00000300U;              // DLCR: TURNROUND
+      } else {
+        if (Mode == TARGETSIM_MODE_JTAG) {
+          CtrlStat &= ~(data & (CTRL_STICKYORUN | CTRL_STICKYCMP | CTRL_STICKYERR));
+        }
+        CtrlStat = (CtrlStat & ~CTRL_WRITE_MASK) | (data & CTRL_WRITE_MASK);
+      }
+      break;
+    case DP_SELECT:
+      Select = data;
+      break;
+    default:
+      break;
+  }
+}
+
+
+// SWD packet request (called after the park bit)
+//   request: A[3:2] RnW APnDP
+//   data:    read data
+//   return:  ACK[2:0] or 0 when the target does not respond
+static uint32_t SWD_Request (uint32_t request, uint32_t *data) {
+  uint32_t addr = request & (DAP_TRANSFER_A2 | DAP_TRANSFER_A3);
+
+  if (SwdLockout) {
+    if (request != (DP_IDCODE | DAP_TRANSFER_RnW)) {
+      return (0U);
+    }
+    SwdLockout = 0U;
+  }
+
+  if ((request & DAP_TRANSFER_APnDP) == 0U) {
+    // DP access
+    if ((request & DAP_TRANSFER_RnW) != 0U) {
+      switch (addr) {
+        case DP_IDCODE:
+          *data = TARGETSIM_SW_IDCODE;
+          break;
+        case DP_CTRL_STAT:
+          *data = ((Select & 0x0FU) == 1U) ? Dlcr : DP_CtrlStat();
+          break;
+        case DP_RESEND:
+          *data = Resend;
+          break;
+        default:                                // DP_RDBUFF
+          if ((CtrlStat & CTRL_STICKY) != 0U) {
+            TargetSim_Stat.faults++;
+            return (DAP_TRANSFER_FAULT);
+          }
+          if (ApBusy != 0U) {
+            ApBusy--;
+            TargetSim_Stat.waits++;
+            return (DAP_TRANSFER_WAIT);
+          }
+          *data = RdBuff;
+          break;
+      }
+      Resend = *data;
+      TargetSim_Stat.dp_reads++;
+    } else if ((addr == DP_SELECT) && ((CtrlStat & CTRL_STICKY) != 0U)) {
+      TargetSim_Stat.faults++;
+      return (DAP_TRANSFER_FAULT);
+    }
+    return (DAP_TRANSFER_OK);
+  }
+
+  // AP access
+  if ((CtrlStat & CTRL_STICKY) != 0U) {
+    TargetSim_Stat.faults++;
+    return (DAP_TRANSFER_FAULT);
+  }
+  if (ApBusy != 0U) {
+    ApBusy--;
+    TargetSim_Stat.waits++;
+    return (DAP_TRANSFER_WAIT);
+  }
+  if ((request & DAP_TRANSFER_RnW) != 0U) {
+    // Posted read: return previous result
+    *data  = RdBuff;
+    Resend = RdBuff;
+    RdBuff = AP_Read((Select & 0xF0U) | addr);
+    ApBusy = WaitCount;
+  }
+  return (DAP_TRANSFER_OK);
+}
+
+
+// SWD write data phase completed
+static void SWD_WriteData (uint32_t request, uint32_t data) {
+  uint32_t addr = request & (DAP_TRANSFER_A2 | DAP_TRANSFER_A3);
+
+  if ((request & DAP_TRANSFER_APnDP) != 0U) {
+    AP_Write((Select & 0xF0U) | addr, data);
+    ApBusy = WaitCount;
+  } else if (addr == DP_ABORT) {
+    TargetSim_Stat.dp_writes++;
+    DP_Abort(data);
+  } else {
+    DP_Write(addr, data);
+  }
+}
+
+
+// SWD line reset
+static void SWD_LineReset (void) {
+  SwdState   = SWD_IDLE;
+  SwdDrive   = 0U;
+  SwdLockout = 1U;
+  TargetSim_Stat.line_resets++;
+}
+
+
+// SWD protocol (one SWCLK rising edge)
+//   bit:    SWDIO level driven by the Debug Unit
+static void SWD_Clock (uint32_t bit) {
+  uint32_t valid;
+
+  switch (SwdState) {
+    case SWD_IDLE:
+      if (TargetSim_Pins.swdio_oe && bit) {
+        SwdState   = SWD_REQUEST;               // Start bit
+        SwdRequest = 0U;
+        SwdCount   = 0U;
+      }
+      break;
+
+    case SWD_REQUEST:
+      // APnDP, RnW, A2, A3, Parity, Stop, Park
+      SwdRequest |= bit << SwdCount;
+      if (++SwdCount < 7U) {
+        break;
+      }
+      valid = ((Parity(SwdRequest & 0x0FU) == ((SwdRequest >> 4) & 1U)) &&
+               ((SwdRequest & 0x20U) == 0U) && ((SwdRequest & 0x40U) != 0U));
+      SwdRequest &= 0x0FU;
+      SwdData = 0U;
+      SwdAck  = valid ? SWD_Request(SwdRequest, &SwdData) : 0U;
+      if (SwdAck == 0U) {
+        TargetSim_Stat.errors++;
+        SwdState = SWD_IDLE;                    // No response
+        break;
+      }
+      SwdCount = ((Dlcr >> 8) & 3U) + 1U;
+      SwdState = SWD_TRN_ACK;
+      break;
+
+    case SWD_TRN_ACK:
+      if (--SwdCount == 0U) {
+        SwdDrive = 1U;
+        SwdOut   = SwdAck & 1U;
+        SwdCount = 1U;
+        SwdState = SWD_ACK;
+      }
+      break;
+
+    case SWD_ACK:
+      if (SwdCount < 3U) {
+        SwdOut = (SwdAck >> SwdCount) & 1U;
+        SwdCount++;
+        break;
+      }
+      if ((SwdAck == DAP_TRANSFER_OK) && ((SwdRequest & DAP_TRANSFER_RnW) != 0U)) {
+        SwdOut   = SwdData & 1U;
+        SwdCount = 1U;
+        SwdState = SWD_RDATA;
+      } else if (SwdAck == DAP_TRANSFER_OK) {
+        SwdDrive = 0U;
+        SwdCount = ((Dlcr >> 8) & 3U) + 1U;
+        SwdState = SWD_TRN_WDATA;
+      } else {
+        SwdDrive = 0U;
+        SwdState = SWD_IDLE;
+      }
+      break;
+
+    case SWD_RDATA:
+      if (SwdCount < 32U) {
+        SwdOut = (SwdData >> SwdCount) & 1U;
+        SwdCount++;
+      } else if (SwdCount == 32U) {
+        SwdOut = Parity(SwdData);
+        SwdCount++;
+      } else {
+        SwdDrive = 0U;
+        SwdState = SWD_IDLE;
+      }
+      break;
+
+    case SWD_TRN_WDATA:
+      if (--SwdCount == 0U) {
+        SwdData  = 0U;
+        SwdState = SWD_WDATA;
+      }
+      break;
+
+    case SWD_WDATA:
+      if (SwdCount < 32U) {
+        SwdData |= bit << SwdCount;
+        SwdCount++;
+        break;
+      }
+      if (Parity(SwdData) != bit) {
+        CtrlStat |= CTRL_WDATAERR;
+      } else {
+        SWD_WriteData(SwdRequest, SwdData);
+      }
+      SwdState = SWD_IDLE;
+      break;
+
+    default:
+      SwdState = SWD_IDLE;
+      break;
+  }
+}
+
+
+// JTAG DPACC/APACC/ABORT transaction (Update-DR)
+//   ir:     instruction
+//   dr:     shifted data register (DATA[34:3] A[3:2] RnW)
+static void JTAG_Update (uint32_t ir, uint64_t dr) {
+  uint32_t rnw  = (uint32_t)dr & 1U;
+  uint32_t addr = ((uint32_t)dr << 1) & 0x0CU;
+  uint32_t data = (uint32_t)(dr >> 3);
+
+  if (ir == JTAG_ABORT) {
+    TargetSim_Stat.dp_writes++;
+    DP_Abort(data & ABORT_DAPABORT);
+    return;
+  }
+  if (JtagAck == JTAG_ACK_WAIT) {
+    return;                                     // Transaction not accepted
+  }
+
+  if (ir == JTAG_DPACC) {
+    if (rnw) {
+      TargetSim_Stat.dp_reads++;
+      switch (addr) {
+        case DP_CTRL_STAT:
+          JtagResult = DP_CtrlStat();
+          break;
+        case DP_SELECT:
+          JtagResult = Select;
+          break;
+        default:                                // RDBUFF returns 0
+          JtagResult = 0U;
+          break;
+      }
+    } else {
+      DP_Write(addr, data);
+    }
+    return;
+  }
+
+  // APACC (ignored while sticky errors are set)
+  if ((CtrlStat & CTRL_STICKY) != 0U) {
+    TargetSim_Stat.faults++;
+    return;
+  }
+  if (rnw) {
+    JtagResult = AP_Read((Select & 0xF0U) | addr);
+  } else {
+    AP_Write((Select & 0xF0U) | addr, data);
+  }
+  ApBusy = WaitCount;
+}
+
+
+// JTAG TAP controller (one TCK rising edge)
+//   tms:    TMS level
+//   tdi:    TDI level
+static void JTAG_Clock (uint32_t tms, uint32_t tdi) {
+
+  switch (TapState) {
+    case TAP_CAPTURE_DR:
+      switch (Ir) {
+        case JTAG_IDCODE:
+          DrShift  = TARGETSIM_JTAG_IDCODE;
+          DrLength = 32U;
+          break;
+        case JTAG_DPACC:
+        case JTAG_APACC:
+          if (ApBusy != 0U) {
+            ApBusy--;
+            TargetSim_Stat.waits++;
+            JtagAck = JTAG_ACK_WAIT;
+          } else {
+            JtagAck = JTAG_ACK_OK_FAULT;
+          }
+          DrShift  = ((uint64_t)JtagResult << 3) | JtagAck;
+          DrLength = 35U;
+          break;
+        case JTAG_ABORT:
+          DrShift  = 0U;
+          DrLength = 35U;
+          break;
+        default:                                // BYPASS
+          DrShift  = 0U;
+          DrLength = 1U;
+          break;
+      }
+      break;
+    case TAP_SHIFT_DR:
+      DrShift = (DrShift >> 1) | ((uint64_t)tdi << (DrLength - 1U));
+      break;
+    case TAP_CAPTURE_IR:
+      IrShift = 0x01U;
+      break;
+    case TAP_SHIFT_IR:
+      IrShift = (IrShift >> 1) | (tdi << 3);
+      break;
+    default:
+      break;
+  }
+
+  TapState = TapNext[TapState][tms];
+
+  switch (TapState) {
+    case TAP_RESET:
+      Ir = JTAG_IDCODE;
+      break;
+    case TAP_UPDATE_IR:
+      Ir = IrShift;
+      break;
+    case TAP_UPDATE_DR:
+      if ((Ir == JTAG_DPACC) || (Ir == JTAG_APACC) || (Ir == JTAG_ABORT)) {
+        JTAG_Update(Ir, DrShift);
+      }
+      break;
+    default:
+      break;
+  }
+
+  if (TapState == TAP_SHIFT_DR) {
+    TapTdo = (uint32_t)DrShift & 1U;
+  } else if (TapState == TAP_SHIFT_IR) {
+    TapTdo = IrShift & 1U;
+  } else {
+    TapTdo = 1U;
+  }
+}
+
+
+// Initialize simulated target with a RAM image accessed through the MEM-AP
+//   ram:    pointer to RAM image
+//   base:   MEM-AP address of the RAM image
+//   size:   size of the RAM image in bytes
+//   return: none
+void TargetSim_Init (uint8_t *ram, uint32_t base, uint32_t size) {
+
+  Ram      = ram;
+  RamBase  = base;
+  RamSize  = size;
+
+  Mode     = TARGETSIM_MODE_JTAG;
+  Ones     = 0U;
+  SeqBits  = 0U;
+  SeqCount = 16U;
+
+  CtrlStat = 0U;
+  Select   = 0U;
+  Dlcr     = 0U;
+  RdBuff   = 0U;
+  Resend   = 0U;
+  ApBusy   = 0U;
+  Csw      = 0U;
+  Tar      = 0U;
+
+  SwdState   = SWD_IDLE;
+  SwdDrive   = 0U;
+  SwdLockout = 1U;
+
+  TapState   = TAP_RESET;
+  Ir         = JTAG_IDCODE;
+  TapTdo     = 1U;
+  JtagAck    = JTAG_ACK_OK_FAULT;
+  JtagResult = 0U;
+
+  memset(CoreReg, 0, sizeof(CoreReg));
+  Dhcsr    = 0U;
+  Dcrdr    = 0U;
+  Halted   = 0U;
+  RunPolls = 0U;
+
+  memset(&TargetSim_Stat, 0, sizeof(TargetSim_Stat));
+}
+
+
+// Set function executed by the simulated core
+//   run:    function called when the core has run (returns to LR afterwards)
+//   polls:  number of DHCSR reads until the resumed core halts again
+//   return: none
+void TargetSim_SetCore (TargetSim_Run_t run, uint32_t polls) {
+  CoreRun   = run;
+  CorePolls = polls;
+}
+
+
+// Set number of WAIT responses returned before each AP access is accepted
+//   count:  number of WAIT responses (0 = AP accesses complete immediately)
+//   return: none
+void TargetSim_SetWait (uint32_t count) {
+  WaitCount = count;
+  ApBusy    = 0U;
+}
+
+
+// Get current wire mode of the simulated target
+//   return: TARGETSIM_MODE_JTAG or TARGETSIM_MODE_SWD
+uint32_t TargetSim_GetMode (void) {
+  return (Mode);
+}
+
+
+// Clock edge on SWCLK/TCK (called on rising edge)
+//   return: none
+void TargetSim_Clock (void) {
+  uint32_t bit;
+
+  TargetSim_Stat.clocks++;
+
+  if (TargetSim_Pins.ntrst == 0U) {
+    TapState = TAP_RESET;
+    Ir       = JTAG_IDCODE;
+  }
+
+  bit = TargetSim_SWDIO();
+
+  // SWJ-DP switching sequences and SWD line reset (Debug Unit driving SWDIO/TMS)
+  if (TargetSim_Pins.swdio_oe && !SwdDrive) {
+    SeqBits = (SeqBits >> 1) | (bit << 15);
+    if (bit) {
+      if (++Ones >= 50U) {
+        SeqCount = 0U;
+        if ((Ones == 50U) && (Mode == TARGETSIM_MODE_SWD)) {
+          SWD_LineReset();
+        }
+      }
+    } else {
+      Ones = 0U;
+    }
+    if ((Ones < 50U) && (SeqCount < 16U) && (++SeqCount == 16U)) {
+      if (SeqBits == 0xE79EU) {
+        Mode = TARGETSIM_MODE_SWD;
+        SWD_LineReset();
+      } else if (SeqBits == 0xE73CU) {
+        Mode     = TARGETSIM_MODE_JTAG;
+        TapState = TAP_RESET;
+        Ir       = JTAG_IDCODE;
+      }
+    }
+    if ((Mode == TARGETSIM_MODE_SWD) && (Ones >= 50U)) {
+      return;
+    }
+  }
+
+  if (Mode == TARGETSIM_MODE_SWD) {
+    SWD_Clock(bit);
+  } else {
+    JTAG_Clock(TargetSim_Pins.swdio_tms, TargetSim_Pins.tdi);
+  }
+}
+
+
+// Get SWDIO line level (Debug Unit output, target output or pull-up)
+//   return: SWDIO level
+uint32_t TargetSim_SWDIO (void) {
+  if (SwdDrive) {
+    return (SwdOut);
+  }
+  if (TargetSim_Pins.swdio_oe) {
+    return (TargetSim_Pins.swdio_tms);
+  }
+  return (1U);
+}
+
+
+// Get TDO line level
+//   return: TDO level
+uint32_t TargetSim_TDO (void) {
+  return ((Mode == TARGETSIM_MODE_JTAG) ? TapTdo : 1U);
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2013-2017 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ----------------------------------------------------------------------
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V1.0.0
+ *
+ * Project:      CMSIS-DAP Validation
+ * Title:        TargetSim.h Simulated SWJ-DP target definitions
+ *
+ *---------------------------------------------------------------------------*/
+
+#ifndef __TARGETSIM_H__
+#define __TARGETSIM_H__
+
+#include <stdint.h>
+
+
+// Simulated target identification
+#define TARGETSIM_SW_IDCODE     0x2BA01477U     // SW-DP IDCODE
+#define TARGETSIM_JTAG_IDCODE   0x4BA00477U     // JTAG-DP IDCODE
+#define TARGETSIM_AP_IDR        0x24770011U     // AHB-AP IDR
+#define TARGETSIM_AP_BASE       0xE00FF003U     // AHB-AP ROM table base
+
+// Simulated target wire mode
+#define TARGETSIM_MODE_JTAG     0U              // JTAG-DP (power-on default)
+#define TARGETSIM_MODE_SWD      1U              // SW-DP
+
+// Debug Unit side pin levels (driven by the DAP_config.h pin functions)
+typedef struct {
+  uint8_t  swclk_tck;                           // SWCLK/TCK output level
+  uint8_t  swdio_tms;                           // SWDIO/TMS output level
+  uint8_t  swdio_oe;                            // SWDIO/TMS output enabled
+  uint8_t  tdi;                                 // TDI output level
+  uint8_t  ntrst;                               // nTRST output level
+  uint8_t  nreset;                              // nRESET output level
+  uint8_t  port_on;                             // Port pins enabled
+  uint8_t  padding;
+} TargetSim_Pins_t;
+
+// Simulated target statistics
+typedef struct {
+  uint64_t clocks;                              // SWCLK/TCK rising edges
+  uint32_t dp_reads;                            // DP register reads
+  uint32_t dp_writes;                           // DP register writes
+  uint32_t ap_reads;                            // AP register reads
+  uint32_t ap_writes;                           // AP register writes
+  uint32_t waits;                               // WAIT responses
+  uint32_t faults;                              // FAULT responses
+  uint32_t errors;                              // Requests without response
+  uint32_t line_resets;                         // SWD line resets
+  uint32_t shift_fields;                        // Fields shifted by the SWD shift engine
+  uint32_t core_runs;                           // Core resumed from halt
+} TargetSim_Stat_t;
+
+// Function executed by the simulated core when it is resumed from halt
+//   reg:    core registers R0..R15, xPSR (DCRSR REGSEL 0..16)
+typedef void (*TargetSim_Run_t) (uint32_t *reg);
+
+extern TargetSim_Pins_t TargetSim_Pins;         // Debug Unit pins
+extern TargetSim_Stat_t TargetSim_Stat;         // Target statistics
+
+
+// Initialize simulated target with a RAM image accessed through the MEM-AP
+//   ram:    pointer to RAM image
+//   base:   MEM-AP address of the RAM image
+//   size:   size of the RAM image in bytes
+//   return: none
+extern void     TargetSim_Init  (uint8_t *ram, uint32_t base, uint32_t size);
+
+// Set number of WAIT responses returned before each AP access is accepted
+//   count:  number of WAIT responses (0 = AP accesses complete immediately)
+//   return: none
+extern void     TargetSim_SetWait (uint32_t count);
+
+// Set function executed by the simulated core (Cortex-M debug registers
+// DHCSR, DCRSR and DCRDR at 0xE000EDF0)
+//   run:    function called when the core has run (returns to LR afterwards)
+//   polls:  number of DHCSR reads until the resumed core halts again
+//   return: none
+extern void     TargetSim_SetCore (TargetSim_Run_t run, uint32_t polls);
+
+// Get current wire mode of the simulated target
+//   return: TARGETSIM_MODE_JTAG or TARGETSIM_MODE_SWD
+extern uint32_t TargetSim_GetMode (void);
+
+// Clock edge on SWCLK/TCK (called on rising edge)
+//   return: none
+extern void     TargetSim_Clock (void);
+
+// Get SWDIO line level (Debug Unit output, target output or pull-up)
+//   return: SWDIO level
+extern uint32_t TargetSim_SWDIO (void);
+
+// Get TDO line level
+//   return: TDO level
+extern uint32_t TargetSim_TDO (void);
+
+
+#endif /* __TARGETSIM_H__ */
@@ -0,0 +1,706 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2017 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    main.c
+ *      Purpose: CMSIS-DAP host simulation: command tests, stream replay
+ *               and command throughput
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "DAP_config.h"
+#include "DAP.h"
+#include "TargetSim.h"
+
+#define RAM_BASE                0x20000000U
+#define RAM_SIZE                0x00010000U
+
+#define CSW_WORD_INC            0x23000012U     // 32-bit, single increment
+#define CSW_BYTE_INC            0x23000010U     // 8-bit, single increment
+
+#define AP_CSW                  0x00U
+#define AP_TAR                  0x04U
+#define AP_DRW                  0x0CU
+#define AP_IDR                  0x0CU           // with APBANKSEL 0xF
+
+#define BLOCK_WORDS             ((DAP_PACKET_SIZE - 5U) / 4U)
+
+// Flash algorithm (executed by the simulated core, see FlashAlgoRun)
+#define FLASH_BASE              0x08000000U
+#define FLASH_SIZE              0x00004000U
+#define FLASH_PAGE              0x00000400U
+#define ALGO_BKPT               0x20000000U
+#define ALGO_ERASE              0x20000021U
+#define ALGO_PROGRAM            0x20000041U
+#define ALGO_SB                 0x20000800U
+#define ALGO_SP                 0x20001000U
+#define ALGO_BUFFER             0x20002000U
+
+#define ID_DAP_MemoryCRC32      ID_DAP_Vendor1
+#define ID_DAP_FlashSetup       ID_DAP_Vendor2
+#define ID_DAP_FlashCall        ID_DAP_Vendor3
+#define ID_DAP_FlashProgram     ID_DAP_Vendor4
+
+static uint8_t  targetRam[RAM_SIZE];
+static uint32_t testData [RAM_SIZE / 4U];
+static uint32_t readData [RAM_SIZE / 4U];
+
+static uint8_t  request [DAP_PACKET_SIZE];
+static uint8_t  response[DAP_PACKET_SIZE];
+
+static uint8_t  flashImage[FLASH_SIZE];
+
+static FILE    *record;
+static uint32_t errors;
+static uint32_t commands;
+
+/*----------------------------------------------------------------------------
+ * Command helpers
+ *---------------------------------------------------------------------------*/
+
+// Print bytes as a command stream line
+static void PrintLine (FILE *f, char dir, const uint8_t *buf, uint32_t num) {
+  uint32_t n;
+
+  fputc(dir, f);
+  for (n = 0U; n < num; n++) {
+    fprintf(f, " %02X", buf[n]);
+  }
+  fputc('\n', f);
+}
+
+// Execute command and optionally record request and response
+static uint32_t Execute (const uint8_t *req, uint8_t *rsp) {
+  uint32_t num;
+
+  num = DAP_ExecuteCommand(req, rsp);
+  commands++;
+  if (record != NULL) {
+    PrintLine(record, '>', req, num >> 16);
+    PrintLine(record, '<', rsp, num & 0xFFFFU);
+  }
+  return (num & 0xFFFFU);
+}
+
+// Print test result (errors since the test started)
+static void Result (const char *port, const char *test, uint32_t errors_start) {
+  printf("TEST %-4s %-8s %s\n", port, test, (errors == errors_start) ? "passed" : "failed");
+}
+
+static void Check (int cond, const char *msg) {
+  if (!cond) {
+    printf("FAIL: %s\n", msg);
+    errors++;
+  }
+}
+
+static void Put32 (uint8_t *buf, uint32_t val) {
+  buf[0] = (uint8_t)(val >>  0);
+  buf[1] = (uint8_t)(val >>  8);
+  buf[2] = (uint8_t)(val >> 16);
+  buf[3] = (uint8_t)(val >> 24);
+}
+
+static uint32_t Get32 (const uint8_t *buf) {
+  return ((uint32_t)buf[0]        | ((uint32_t)buf[1] <<  8) |
+         ((uint32_t)buf[2] << 16) | ((uint32_t)buf[3] << 24));
+}
+
+// Simple command with up to 4 parameter bytes, returns first response status
+static uint8_t Simple (uint8_t id, uint32_t param) {
+  request[0] = id;
+  Put32(&request[1], param);
+  (void)Execute(request, response);
+  return (response[1]);
+}
+
+// SWJ sequence
+static void Sequence (uint32_t count, const uint8_t *data) {
+  request[0] = ID_DAP_SWJ_Sequence;
+  request[1] = (uint8_t)count;
+  memcpy(&request[2], data, (count + 7U) / 8U);
+  (void)Execute(request, response);
+  Check(response[1] == DAP_OK, "SWJ_Sequence");
+}
+
+// Single register transfer, returns ACK
+static uint32_t Transfer (uint32_t req, uint32_t *data) {
+  request[0] = ID_DAP_Transfer;
+  request[1] = 0U;
+  request[2] = 1U;
+  request[3] = (uint8_t)req;
+  if ((req & DAP_TRANSFER_RnW) == 0U) {
+    Put32(&request[4], *data);
+  }
+  (void)Execute(request, response);
+  if ((response[2] == DAP_TRANSFER_OK) && ((req & DAP_TRANSFER_RnW) != 0U)) {
+    *data = Get32(&response[3]);
+  }
+  return (response[2]);
+}
+
+static uint32_t WriteReg (uint32_t req, uint32_t val) {
+  return Transfer(req, &val);
+}
+
+static uint32_t ReadReg (uint32_t req) {
+  uint32_t val = 0xDEADBEEFU;
+
+  Check(Transfer(req | DAP_TRANSFER_RnW, &val) == DAP_TRANSFER_OK, "register read");
+  return (val);
+}
+
+// Register block transfer, returns ACK
+static uint32_t Block (uint32_t req, uint32_t *data, uint32_t count) {
+  uint32_t num, n;
+
+  request[0] = ID_DAP_TransferBlock;
+  request[1] = 0U;
+  request[2] = (uint8_t)(count >> 0);
+  request[3] = (uint8_t)(count >> 8);
+  request[4] = (uint8_t)req;
+  if ((req & DAP_TRANSFER_RnW) == 0U) {
+    for (n = 0U; n < count; n++) {
+      Put32(&request[5U + (n * 4U)], data[n]);
+    }
+  }
+  (void)Execute(request, response);
+  num = (uint32_t)response[1] | ((uint32_t)response[2] << 8);
+  if ((req & DAP_TRANSFER_RnW) != 0U) {
+    for (n = 0U; n < num; n++) {
+      data[n] = Get32(&response[4U + (n * 4U)]);
+    }
+  }
+  if ((response[3] == DAP_TRANSFER_OK) && (num != count)) {
+    return (DAP_TRANSFER_ERROR);
+  }
+  return (response[3]);
+}
+
+// Memory block write or read through the MEM-AP
+static uint32_t Memory (uint32_t addr, uint32_t *data, uint32_t words, uint32_t rnw) {
+  uint32_t ack = DAP_TRANSFER_OK;
+  uint32_t num;
+
+  while ((words != 0U) && (ack == DAP_TRANSFER_OK)) {
+    num = (0x400U - (addr & 0x3FFU)) / 4U;      // TAR auto-increment wraps at 1kB
+    if (num > BLOCK_WORDS) {
+      num = BLOCK_WORDS;
+    }
+    if (num > words) {
+      num = words;
+    }
+    ack = WriteReg(DAP_TRANSFER_APnDP | AP_TAR, addr);
+    if (ack == DAP_TRANSFER_OK) {
+      ack = Block(DAP_TRANSFER_APnDP | AP_DRW | rnw, data, num);
+    }
+    addr  += num * 4U;
+    data  += num;
+    words -= num;
+  }
+  return (ack);
+}
+
+/*----------------------------------------------------------------------------
+ * Connect and power up the debug port
+ *---------------------------------------------------------------------------*/
+
+static const uint8_t seqOnes[7]    = { 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+static const uint8_t seqZeros[1]   = { 0x00U };
+static const uint8_t seqJtagSwd[2] = { 0x9EU, 0xE7U };
+static const uint8_t seqSwdJtag[2] = { 0x3CU, 0xE7U };
+
+static void Connect (uint32_t port, uint32_t clock) {
+  uint8_t jtag_conf[2] = { 1U, 4U };
+
+  Check(Simple(ID_DAP_Connect, port) == port, "Connect");
+  Check(Simple(ID_DAP_SWJ_Clock, clock) == DAP_OK, "SWJ_Clock");
+
+  request[0] = ID_DAP_TransferConfigure;
+  request[1] = 0U;                              // Idle cycles
+  request[2] = 100U;                            // WAIT retries
+  request[3] = 0U;
+  request[4] = 0U;                              // Match retries
+  request[5] = 0U;
+  (void)Execute(request, response);
+
+  Sequence(51U, seqOnes);
+  if (port == DAP_PORT_SWD) {
+    Sequence(16U, seqJtagSwd);
+    Sequence(51U, seqOnes);
+    Sequence(8U,  seqZeros);
+    Check(TargetSim_GetMode() == TARGETSIM_MODE_SWD, "switch to SWD");
+    Check(ReadReg(DP_IDCODE) == TARGETSIM_SW_IDCODE, "SW-DP IDCODE");
+    Check(WriteReg(DP_ABORT, 0x1EU) == DAP_TRANSFER_OK, "ABORT");
+  } else {
+    Sequence(16U, seqSwdJtag);
+    Sequence(8U,  seqOnes);
+    Sequence(8U,  seqZeros);
+    Check(TargetSim_GetMode() == TARGETSIM_MODE_JTAG, "switch to JTAG");
+
+    request[0] = ID_DAP_JTAG_Configure;
+    memcpy(&request[1], jtag_conf, sizeof(jtag_conf));
+    (void)Execute(request, response);
+    Check(response[1] == DAP_OK, "JTAG_Configure");
+
+    request[0] = ID_DAP_JTAG_IDCODE;
+    request[1] = 0U;
+    (void)Execute(request, response);
+    Check((response[1] == DAP_OK) && (Get32(&response[2]) == TARGETSIM_JTAG_IDCODE), "JTAG IDCODE");
+  }
+
+  // Power up debug domain and select MEM-AP
+  Check(WriteReg(DP_SELECT, 0U) == DAP_TRANSFER_OK, "SELECT");
+  Check(WriteReg(DP_CTRL_STAT, 0x50000000U) == DAP_TRANSFER_OK, "CTRL/STAT write");
+  Check((ReadReg(DP_CTRL_STAT) & 0xF0000000U) == 0xF0000000U, "power-up acknowledge");
+  Check(WriteReg(DP_SELECT, 0x000000F0U) == DAP_TRANSFER_OK, "SELECT bank 0xF");
+  Check(ReadReg(DAP_TRANSFER_APnDP | AP_IDR) == TARGETSIM_AP_IDR, "AP IDR");
+  Check(WriteReg(DP_SELECT, 0U) == DAP_TRANSFER_OK, "SELECT bank 0");
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_CSW, CSW_WORD_INC) == DAP_TRANSFER_OK, "CSW");
+}
+
+/*----------------------------------------------------------------------------
+ * Command tests
+ *---------------------------------------------------------------------------*/
+
+static void TestMemory (const char *name) {
+  uint32_t errors_start = errors;
+  uint32_t words = 512U;
+  uint32_t n;
+
+  for (n = 0U; n < words; n++) {
+    testData[n] = (n * 0x9E3779B9U) ^ (uint32_t)(uintptr_t)name;
+  }
+  memset(readData, 0, sizeof(readData));
+
+  Check(Memory(RAM_BASE + 0x100U, testData, words, 0U) == DAP_TRANSFER_OK, "block write");
+  Check(memcmp(&targetRam[0x100], testData, words * 4U) == 0, "target RAM image");
+  Check(Memory(RAM_BASE + 0x100U, readData, words, DAP_TRANSFER_RnW) == DAP_TRANSFER_OK, "block read");
+  Check(memcmp(readData, testData, words * 4U) == 0, "block read data");
+
+  // Single word blocks (posted AP read followed by RDBUFF)
+  Check(Memory(RAM_BASE + 0x0FCU, &testData[1], 1U, 0U) == DAP_TRANSFER_OK, "single write");
+  Check(Memory(RAM_BASE + 0x0FCU, &readData[1], 1U, DAP_TRANSFER_RnW) == DAP_TRANSFER_OK, "single read");
+  Check(readData[1] == testData[1], "single read data");
+
+  // Byte access on lane 1
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_CSW, CSW_BYTE_INC) == DAP_TRANSFER_OK, "CSW byte");
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_TAR, RAM_BASE + 1U) == DAP_TRANSFER_OK, "TAR byte");
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_DRW, 0x0000A500U) == DAP_TRANSFER_OK, "DRW byte");
+  Check(targetRam[1] == 0xA5U, "byte write lane");
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_CSW, CSW_WORD_INC) == DAP_TRANSFER_OK, "CSW word");
+
+  Result(name, "memory", errors_start);
+}
+
+static void TestWait (const char *name) {
+  uint32_t errors_start = errors;
+  uint32_t waits;
+
+  // Busy AP: WAIT responses retried by the firmware
+  TargetSim_SetWait(5U);
+  waits = TargetSim_Stat.waits;
+  memset(readData, 0, sizeof(readData));
+  Check(Memory(RAM_BASE + 0x100U, readData, 256U, DAP_TRANSFER_RnW) == DAP_TRANSFER_OK, "block read with WAIT");
+  Check(memcmp(readData, testData, 256U * 4U) == 0, "block read data with WAIT");
+  Check(TargetSim_Stat.waits > waits, "WAIT responses");
+
+  // AP busy longer than the retry count
+  TargetSim_SetWait(1000U);
+  Check(Memory(RAM_BASE, readData, 4U, DAP_TRANSFER_RnW) == DAP_TRANSFER_WAIT, "WAIT timeout");
+  TargetSim_SetWait(0U);
+  request[0] = ID_DAP_WriteABORT;
+  request[1] = 0U;
+  Put32(&request[2], 0x1FU);
+  (void)Execute(request, response);
+  Check(response[1] == DAP_OK, "WriteABORT");
+
+  Result(name, "wait", errors_start);
+}
+
+static void TestFault (const char *name, uint32_t port) {
+  uint32_t errors_start = errors;
+  uint32_t data;
+
+  // Bus error sets STICKYERR
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_TAR, 0x10000000U) == DAP_TRANSFER_OK, "TAR outside RAM");
+  if (port == DAP_PORT_SWD) {
+    Check(Transfer(DAP_TRANSFER_APnDP | AP_DRW | DAP_TRANSFER_RnW, &data) == DAP_TRANSFER_FAULT, "bus error FAULT");
+    Check(WriteReg(DP_ABORT, 0x04U) == DAP_TRANSFER_OK, "clear STICKYERR");
+  } else {
+    (void)Transfer(DAP_TRANSFER_APnDP | AP_DRW | DAP_TRANSFER_RnW, &data);
+    Check((ReadReg(DP_CTRL_STAT) & 0x20U) != 0U, "bus error STICKYERR");
+    Check(WriteReg(DP_CTRL_STAT, 0x50000020U) == DAP_TRANSFER_OK, "clear STICKYERR");
+  }
+  Check((ReadReg(DP_CTRL_STAT) & 0xB2U) == 0U, "sticky flags cleared");
+
+  Result(name, "fault", errors_start);
+}
+
+static void TestExecute (void) {
+  uint32_t errors_start = errors;
+  uint32_t n = 0U;
+
+  // Info and Transfer in one ExecuteCommands packet
+  request[n++] = ID_DAP_ExecuteCommands;
+  request[n++] = 2U;
+  request[n++] = ID_DAP_Info;
+  request[n++] = DAP_ID_PACKET_SIZE;
+  request[n++] = ID_DAP_Transfer;
+  request[n++] = 0U;
+  request[n++] = 1U;
+  request[n++] = DP_IDCODE | DAP_TRANSFER_RnW;
+  n = Execute(request, response);
+  Check((n == 13U) && (response[1] == 2U) && (response[2] == ID_DAP_Info) &&
+        (response[6] == ID_DAP_Transfer) && (Get32(&response[9]) == TARGETSIM_SW_IDCODE), "ExecuteCommands");
+
+  Result("SWD", "execute", errors_start);
+}
+
+// SWD engine selection by clock: GPIO bit-banging with pin delays at a slow
+// clock, SWD shift engine (DAP_SWD_SHIFT) at the fast clock, with idle cycles
+static void TestClock (void) {
+  uint32_t errors_start = errors;
+  uint32_t words = 64U;
+  uint32_t fields;
+  uint32_t n;
+
+  for (n = 0U; n < words; n++) {
+    testData[n] = ~n * 0x01000193U;
+  }
+
+  Connect(DAP_PORT_SWD, 500000U);
+  fields = TargetSim_Stat.shift_fields;
+  memset(readData, 0, words * 4U);
+  Check(Memory(RAM_BASE + 0x800U, testData, words, 0U) == DAP_TRANSFER_OK, "slow clock write");
+  Check(Memory(RAM_BASE + 0x800U, readData, words, DAP_TRANSFER_RnW) == DAP_TRANSFER_OK, "slow clock read");
+  Check(memcmp(readData, testData, words * 4U) == 0, "slow clock data");
+  Check(TargetSim_Stat.shift_fields == fields, "slow clock uses GPIO bit-banging");
+
+  Connect(DAP_PORT_SWD, 100000000U);
+  request[0] = ID_DAP_TransferConfigure;
+  request[1] = 40U;                             // Idle cycles
+  request[2] = 100U;                            // WAIT retries
+  request[3] = 0U;
+  request[4] = 0U;                              // Match retries
+  request[5] = 0U;
+  (void)Execute(request, response);
+  fields = TargetSim_Stat.shift_fields;
+  memset(readData, 0, words * 4U);
+  Check(Memory(RAM_BASE + 0x800U, readData, words, DAP_TRANSFER_RnW) == DAP_TRANSFER_OK, "idle cycles read");
+  Check(memcmp(readData, testData, words * 4U) == 0, "idle cycles data");
+#if (DAP_SWD_SHIFT != 0)
+  Check(TargetSim_Stat.shift_fields != fields, "fast clock uses SWD shift engine");
+#else
+  Check(TargetSim_Stat.shift_fields == fields, "fast clock uses GPIO bit-banging");
+#endif
+  Connect(DAP_PORT_SWD, 100000000U);            // Restore idle cycles
+
+  Result("SWD", "clock", errors_start);
+}
+
+// Flash algorithm functions run by the simulated core:
+// EraseSector(adr) and ProgramPage(adr, sz, buf)
+static void FlashAlgoRun (uint32_t *reg) {
+  uint32_t pc = reg[15] & ~1U;
+  uint32_t addr = reg[0] - FLASH_BASE;
+
+  if ((reg[9] != ALGO_SB) || (reg[13] != ALGO_SP) || (reg[14] != (ALGO_BKPT | 1U)) ||
+      (reg[16] != 0x01000000U) || (addr >= FLASH_SIZE)) {
+    reg[0] = 1U;
+    return;
+  }
+  if (pc == (ALGO_ERASE & ~1U)) {
+    memset(&flashImage[addr & ~(FLASH_PAGE - 1U)], 0xFF, FLASH_PAGE);
+    reg[0] = 0U;
+  } else if ((pc == (ALGO_PROGRAM & ~1U)) && (reg[1] <= (FLASH_SIZE - addr))) {
+    memcpy(&flashImage[addr], &targetRam[reg[2] - RAM_BASE], reg[1]);
+    reg[0] = 0U;
+  } else {
+    reg[0] = 1U;
+  }
+}
+
+// Vendor command, returns status and 32-bit result
+static uint8_t Vendor (uint8_t id, const uint32_t *param, uint32_t params, uint32_t *result) {
+  uint32_t n;
+
+  request[0] = id;
+  for (n = 0U; n < params; n++) {
+    Put32(&request[1U + (n * 4U)], param[n]);
+  }
+  (void)Execute(request, response);
+  if (result != NULL) {
+    *result = Get32(&response[2]);
+  }
+  return (response[1]);
+}
+
+// Reference CRC32 (IEEE 802.3)
+static uint32_t CRC32 (const uint8_t *data, uint32_t size) {
+  uint32_t crc = 0xFFFFFFFFU;
+  uint32_t n;
+
+  while (size--) {
+    crc ^= *data++;
+    for (n = 0U; n < 8U; n++) {
+      crc = (crc >> 1) ^ (0xEDB88320U & (0U - (crc & 1U)));
+    }
+  }
+  return (~crc);
+}
+
+static void TestFlash (const char *name) {
+  uint32_t errors_start = errors;
+  uint32_t setup[7] = { ALGO_BKPT, ALGO_SB, ALGO_SP, ALGO_BUFFER, ALGO_PROGRAM, FLASH_PAGE, 100U };
+  uint32_t call[5]  = { ALGO_ERASE, FLASH_BASE + FLASH_PAGE, 0U, 0U, 0U };
+  uint8_t *page = (uint8_t *)testData;
+  uint32_t result;
+  uint32_t offset, count, n;
+  uint32_t cmds;
+  uint64_t clocks;
+
+  for (n = 0U; n < FLASH_PAGE; n++) {
+    page[n] = (uint8_t)((n * 7U) ^ (n >> 3));
+  }
+  memset(flashImage, 0, sizeof(flashImage));
+  TargetSim_SetCore(FlashAlgoRun, 3U);
+
+  // Halt core
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_TAR, 0xE000EDF0U) == DAP_TRANSFER_OK, "TAR DHCSR");
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_DRW, 0xA05F0003U) == DAP_TRANSFER_OK, "halt core");
+
+  Check(Vendor(ID_DAP_FlashSetup, setup, 7U, NULL) == DAP_OK, "FlashSetup");
+  result = 0xFFFFFFFFU;
+  Check(Vendor(ID_DAP_FlashCall, call, 5U, &result) == DAP_OK, "FlashCall EraseSector");
+  Check(result == 0U, "EraseSector result");
+  Check(flashImage[FLASH_PAGE] == 0xFFU, "EraseSector flash");
+
+  // Program one page (chunks of up to DAP_PACKET_SIZE - 9 bytes)
+  cmds   = commands;
+  clocks = TargetSim_Stat.clocks;
+  for (offset = 0U; offset < FLASH_PAGE; offset += count) {
+    count = ((DAP_PACKET_SIZE - 9U) & ~3U);
+    if (count > (FLASH_PAGE - offset)) {
+      count = FLASH_PAGE - offset;
+    }
+    request[0] = ID_DAP_FlashProgram;
+    Put32(&request[1], FLASH_BASE + FLASH_PAGE);
+    request[5] = (uint8_t)offset;
+    request[6] = (uint8_t)(offset >> 8);
+    request[7] = (uint8_t)count;
+    request[8] = (uint8_t)(count >> 8);
+    memcpy(&request[9], &page[offset], count);
+    (void)Execute(request, response);
+    Check(response[1] == DAP_OK, "FlashProgram");
+    Check(Get32(&response[2]) == 0U, "ProgramPage result");
+  }
+  Check(memcmp(&flashImage[FLASH_PAGE], page, FLASH_PAGE) == 0, "ProgramPage flash");
+  printf("BENCH %-4s flash_page   %8u commands  %u clocks\n", name,
+         (unsigned int)(commands - cmds), (unsigned int)(TargetSim_Stat.clocks - clocks));
+
+  // CRC32 across TAR auto-increment boundaries with a partial last word
+  Check(Memory(ALGO_BUFFER + 0x400U, testData, 1024U, 0U) == DAP_TRANSFER_OK, "CRC32 data");
+  call[0] = ALGO_BUFFER + 0x404U;
+  call[1] = 3001U;
+  result  = 0U;
+  Check(Vendor(ID_DAP_MemoryCRC32, call, 2U, &result) == DAP_OK, "MemoryCRC32");
+  Check(result == CRC32(&targetRam[ALGO_BUFFER + 0x404U - RAM_BASE], 3001U), "CRC32 value");
+  call[0] = ALGO_BUFFER + 2U;
+  Check(Vendor(ID_DAP_MemoryCRC32, call, 2U, &result) == DAP_ERROR, "CRC32 unaligned");
+
+  // Core does not halt within the timeout
+  TargetSim_SetCore(FlashAlgoRun, 1000U);
+  call[0] = ALGO_ERASE;
+  call[1] = FLASH_BASE;
+  Check(Vendor(ID_DAP_FlashCall, call, 5U, NULL) == DAP_ERROR, "FlashCall timeout");
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_TAR, 0xE000EDF0U) == DAP_TRANSFER_OK, "TAR DHCSR");
+  Check(WriteReg(DAP_TRANSFER_APnDP | AP_DRW, 0xA05F0003U) == DAP_TRANSFER_OK, "halt core");
+
+  Result(name, "flash", errors_start);
+}
+
+/*----------------------------------------------------------------------------
+ * Command throughput
+ *---------------------------------------------------------------------------*/
+
+static double Seconds (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((double)ts.tv_sec + ((double)ts.tv_nsec / 1e9));
+}
+
+static void Throughput (const char *name) {
+  uint32_t words = RAM_SIZE / 4U;
+  uint64_t clocks;
+  double   t;
+
+  clocks = TargetSim_Stat.clocks;
+  t = Seconds();
+  Check(Memory(RAM_BASE, testData, words, 0U) == DAP_TRANSFER_OK, "throughput write");
+  t = Seconds() - t;
+  printf("BENCH %-4s block_write  %8.0f kB/s  %5.1f clocks/word\n", name,
+         (double)RAM_SIZE / 1024.0 / t, (double)(TargetSim_Stat.clocks - clocks) / words);
+
+  clocks = TargetSim_Stat.clocks;
+  t = Seconds();
+  Check(Memory(RAM_BASE, readData, words, DAP_TRANSFER_RnW) == DAP_TRANSFER_OK, "throughput read");
+  t = Seconds() - t;
+  printf("BENCH %-4s block_read   %8.0f kB/s  %5.1f clocks/word\n", name,
+         (double)RAM_SIZE / 1024.0 / t, (double)(TargetSim_Stat.clocks - clocks) / words);
+
+  Check(memcmp(readData, testData, RAM_SIZE) == 0, "throughput data");
+}
+
+/*----------------------------------------------------------------------------
+ * Command stream replay
+ *
+ * Lines starting with '>' hold a request, lines starting with '<' hold the
+ * expected response of the previous request ("xx" matches any byte).
+ * Other lines and text after '#' are ignored.
+ *---------------------------------------------------------------------------*/
+
+static int Replay (const char *file) {
+  char     line[4 * DAP_PACKET_SIZE];
+  uint32_t line_num = 0U;
+  uint32_t commands = 0U;
+  uint32_t num = 0U;
+  uint32_t n;
+  char    *p, *end;
+  FILE    *f;
+
+  f = fopen(file, "r");
+  if (f == NULL) {
+    perror(file);
+    return (2);
+  }
+
+  while (fgets(line, sizeof(line), f) != NULL) {
+    line_num++;
+    p = strchr(line, '#');
+    if (p != NULL) {
+      *p = '\0';
+    }
+    if ((line[0] != '>') && (line[0] != '<')) {
+      continue;
+    }
+    p = &line[1];
+    n = 0U;
+    while (n < DAP_PACKET_SIZE) {
+      while (isspace((unsigned char)*p)) {
+        p++;
+      }
+      if (*p == '\0') {
+        break;
+      }
+      if ((line[0] == '<') && (strncmp(p, "xx", 2) == 0)) {
+        n++;
+        p += 2;
+        continue;
+      }
+      if (line[0] == '>') {
+        request[n++] = (uint8_t)strtoul(p, &end, 16);
+      } else {
+        if ((n >= num) || (response[n] != (uint8_t)strtoul(p, &end, 16))) {
+          printf("FAIL: %s:%u: response byte %u\n", file, line_num, n);
+          errors++;
+          break;
+        }
+        n++;
+      }
+      if (end == p) {
+        break;
+      }
+      p = end;
+    }
+    if (line[0] == '>') {
+      num = Execute(request, response);
+      commands++;
+    }
+  }
+  fclose(f);
+
+  printf("REPLAY %s: %u commands, %u errors\n", file, commands, errors);
+  return ((errors != 0U) ? 1 : 0);
+}
+
+/*----------------------------------------------------------------------------
+ * Main
+ *---------------------------------------------------------------------------*/
+
+int main (int argc, char **argv) {
+  int arg = 1;
+
+  DAP_Setup();
+  TargetSim_Init(targetRam, RAM_BASE, RAM_SIZE);
+
+  if ((argc > 2) && (strcmp(argv[1], "-r") == 0)) {
+    record = fopen(argv[2], "w");
+    if (record == NULL) {
+      perror(argv[2]);
+      return (2);
+    }
+    fprintf(record, "# CMSIS-DAP command stream (dap_sim -r): SWD connect, memory, fault, execute\n");
+    arg = 3;
+  }
+  if (arg < argc) {
+    return (Replay(argv[arg]));
+  }
+
+  // SWD at the fast clock (no pin delays)
+  Connect(DAP_PORT_SWD, 100000000U);
+  TestMemory("SWD");
+  TestFault("SWD", DAP_PORT_SWD);
+  TestExecute();
+
+  // WAIT injection and throughput are not recorded
+  if (record != NULL) {
+    fclose(record);
+    record = NULL;
+  }
+
+  TestWait("SWD");
+  TestClock();
+  TestFlash("SWD");
+  Throughput("SWD");
+
+  // JTAG
+  Connect(DAP_PORT_JTAG, 100000000U);
+  TestMemory("JTAG");
+  TestWait("JTAG");
+  TestFault("JTAG", DAP_PORT_JTAG);
+  TestFlash("JTAG");
+  Throughput("JTAG");
+
+  printf("TargetSim: %llu clocks, %u AP reads, %u AP writes, %u WAIT, %u FAULT, %u no response\n",
+         (unsigned long long)TargetSim_Stat.clocks,
+         (unsigned int)TargetSim_Stat.ap_reads, (unsigned int)TargetSim_Stat.ap_writes,
+         (unsigned int)TargetSim_Stat.waits,    (unsigned int)TargetSim_Stat.faults,
+         (unsigned int)TargetSim_Stat.errors);
+
+  if (errors != 0U) {
+    printf("errors: %u\n", (unsigned int)errors);
+    return (1);
+  }
+  return (0);
+}
@@ -51,6 +51,7 @@ ARR_DESC_DECLARE(filtering_postshifts);
 ARR_DESC_DECLARE(filtering_numstages);
 ARR_DESC_DECLARE(filtering_Ls);
 ARR_DESC_DECLARE(filtering_Ms);
+ARR_DESC_DECLARE(filtering_median_winsizes);
 
 /* Coefficient Lists */
 extern const float64_t filtering_coeffs_f64[FILTERING_MAX_NUMSTAGES * 6 + 2];
@@ -11,5 +11,6 @@ JTEST_DECLARE_GROUP(correlate_tests);
 JTEST_DECLARE_GROUP(fir_tests);
 JTEST_DECLARE_GROUP(iir_tests);
 JTEST_DECLARE_GROUP(lms_tests);
+JTEST_DECLARE_GROUP(median_tests);
 
 #endif /* _FILTERING_TESTS_H_ */
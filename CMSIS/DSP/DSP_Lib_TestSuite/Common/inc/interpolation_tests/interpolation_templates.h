@@ -0,0 +1,46 @@
+#ifndef _INTERPOLATION_TEMPLATES_H_
+#define _INTERPOLATION_TEMPLATES_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Includes */
+/*--------------------------------------------------------------------------------*/
+
+#include "test_templates.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Group Specific Templates */
+/*--------------------------------------------------------------------------------*/
+
+/**
+ *  Largest difference allowed between the floating-point outputs of the
+ *  function under test and of the reference function.
+ */
+#define INTERPOLATION_TOLERANCE_float32_t 1.0e-5
+
+/**
+ *  Assert that every output of the function under test is within tolerance
+ *  of the reference one. The error of the interpolation is bounded per
+ *  sample, which an SNR over a few outputs near zero would not check.
+ */
+#define INTERPOLATION_ASSERT_CLOSE(ref_ptr, tst_ptr, block_size, tolerance) \
+    do                                                                  \
+    {                                                                   \
+        uint32_t close_idx;                                             \
+        float64_t close_err;                                            \
+                                                                        \
+        for (close_idx = 0; close_idx < (block_size); close_idx++)      \
+        {                                                               \
+            close_err = fabs((float64_t) (ref_ptr)[close_idx] -         \
+                             (float64_t) (tst_ptr)[close_idx]);         \
+            if (close_err > (tolerance))                                \
+            {                                                           \
+                JTEST_DUMP_STRF("Index: %d\n"                           \
+                                "Error: %f\n",                          \
+                                (int) close_idx,                        \
+                                close_err);                             \
+                return JTEST_TEST_FAILED;                               \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+#endif /* _INTERPOLATION_TEMPLATES_H_ */
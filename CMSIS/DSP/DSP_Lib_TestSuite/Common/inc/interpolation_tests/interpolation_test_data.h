@@ -0,0 +1,45 @@
+#ifndef _INTERPOLATION_TEST_DATA_H_
+#define _INTERPOLATION_TEST_DATA_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Includes */
+/*--------------------------------------------------------------------------------*/
+
+#include "arr_desc.h"
+#include "arm_math.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Macros and Defines */
+/*--------------------------------------------------------------------------------*/
+
+#define INTERPOLATION_MAX_INPUTS 256
+#define INTERPOLATION_MAX_OUTPUTS 512
+#define INTERPOLATION_MAX_BLOCKSIZE 64
+#define INTERPOLATION_MAX_TAPS 128
+
+/*--------------------------------------------------------------------------------*/
+/* Declare Variables */
+/*--------------------------------------------------------------------------------*/
+
+/* Input/Output Buffers */
+extern float32_t interpolation_output_fut[INTERPOLATION_MAX_OUTPUTS];
+extern float32_t interpolation_output_ref[INTERPOLATION_MAX_OUTPUTS];
+extern uint16_t interpolation_index[INTERPOLATION_MAX_TAPS];
+extern float32_t interpolation_coef[INTERPOLATION_MAX_TAPS];
+
+/* Block Sizes */
+ARR_DESC_DECLARE(interpolation_blocksizes);
+
+/* Resize Configurations */
+ARR_DESC_DECLARE(interpolation_resize_modes);
+ARR_DESC_DECLARE(interpolation_resize_src_dims);
+ARR_DESC_DECLARE(interpolation_resize_dst_dims);
+ARR_DESC_DECLARE(interpolation_resize_channels);
+
+/* Inputs */
+extern const q31_t interpolation_q31_inputs[INTERPOLATION_MAX_INPUTS];
+extern const q15_t * interpolation_q15_inputs;
+extern const q7_t * interpolation_q7_inputs;
+extern const float32_t interpolation_f32_inputs[INTERPOLATION_MAX_INPUTS];
+
+#endif /* _INTERPOLATION_TEST_DATA_H_ */
@@ -0,0 +1,9 @@
+#ifndef _INTERPOLATION_TEST_GROUP_H_
+#define _INTERPOLATION_TEST_GROUP_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Declare Test Group */
+/*--------------------------------------------------------------------------------*/
+JTEST_DECLARE_GROUP(interpolation_tests);
+
+#endif /* _INTERPOLATION_TEST_GROUP_H_ */
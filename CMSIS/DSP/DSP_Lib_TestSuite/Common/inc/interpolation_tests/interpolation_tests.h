@@ -0,0 +1,10 @@
+#ifndef _INTERPOLATION_TESTS_H_
+#define _INTERPOLATION_TESTS_H_
+
+/*--------------------------------------------------------------------------------*/
+/* Test/Group Declarations */
+/*--------------------------------------------------------------------------------*/
+JTEST_DECLARE_GROUP(interp_block_tests);
+JTEST_DECLARE_GROUP(resize_tests);
+
+#endif /* _INTERPOLATION_TESTS_H_ */
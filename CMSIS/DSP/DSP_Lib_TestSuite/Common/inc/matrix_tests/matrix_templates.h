@@ -122,6 +122,14 @@
 #define REF_mat_trans_INPUT_INTERFACE(input_ptr)    \
     PAREN(input_ptr, (void *) &matrix_output_ref)
 
+#define ARM_mat_vec_mult_INPUT_INTERFACE(input_ptr, vec_ptr)    \
+    PAREN(input_ptr, vec_ptr,                                   \
+          (void *) ((arm_matrix_instance_f32 *) &matrix_output_fut)->pData)
+
+#define REF_mat_vec_mult_INPUT_INTERFACE(input_ptr, vec_ptr)    \
+    PAREN(input_ptr, vec_ptr,                                   \
+          (void *) ((arm_matrix_instance_f32 *) &matrix_output_ref)->pData)
+
 /*--------------------------------------------------------------------------------*/
 /* Dimension Validation Interfaces */
 /*--------------------------------------------------------------------------------*/
@@ -214,6 +222,18 @@
                 ((input_type)(matrix_ptr))->numRows;        \
         } while (0)
 
+#define MATRIX_TEST_CONFIG_VECTOR_OUTPUT(input_type,        \
+                                         matrix_ptr)        \
+        do                                                  \
+        {                                                   \
+            ((input_type) &matrix_output_fut)->numRows =    \
+                ((input_type)(matrix_ptr))->numRows;        \
+            ((input_type) &matrix_output_fut)->numCols = 1; \
+            ((input_type) &matrix_output_ref)->numRows =    \
+                ((input_type)(matrix_ptr))->numRows;        \
+            ((input_type) &matrix_output_ref)->numCols = 1; \
+        } while (0)
+
 /*--------------------------------------------------------------------------------*/
 /* TEST Templates */
 /*--------------------------------------------------------------------------------*/
@@ -45,6 +45,7 @@ MATRIX_DECLARE_INPUTS(f64);
 MATRIX_DECLARE_INPUTS(f32);
 MATRIX_DECLARE_INPUTS(q31);
 MATRIX_DECLARE_INPUTS(q15);
+MATRIX_DECLARE_INPUTS(q7);
 
 extern const float32_t matrix_f32_scale_values[MATRIX_MAX_COEFFS_LEN];
 extern const q31_t matrix_q31_scale_values[MATRIX_MAX_COEFFS_LEN];
@@ -122,6 +122,14 @@
 #define REF_var_INPUT_INTERFACE(input, block_size)              \
     PAREN(input, block_size, statistics_output_ref.data_ptr)
 
+#define ARM_zcr_energy_INPUT_INTERFACE(input, block_size)       \
+    PAREN(input, block_size,                                    \
+          (void *) &statistics_zcr_fut, statistics_output_fut.data_ptr)
+
+#define REF_zcr_energy_INPUT_INTERFACE(input, block_size)       \
+    PAREN(input, block_size,                                    \
+          (void *) &statistics_zcr_ref, statistics_output_ref.data_ptr)
+
 
 /*--------------------------------------------------------------------------------*/
 /* Test Templates */
@@ -23,6 +23,8 @@ ARR_DESC_DECLARE(statistics_output_fut);
 ARR_DESC_DECLARE(statistics_output_ref);
 extern uint32_t statistics_idx_fut;
 extern uint32_t statistics_idx_ref;
+extern float32_t statistics_zcr_fut;
+extern float32_t statistics_zcr_ref;
 
 extern STATISTICS_BIGGEST_INPUT_TYPE
 statistics_output_f32_ref[STATISTICS_MAX_INPUT_ELEMENTS];
@@ -34,6 +36,10 @@ statistics_output_f32_fut[STATISTICS_MAX_INPUT_ELEMENTS];
 /* Block Sizes */
 ARR_DESC_DECLARE(statistics_block_sizes);
 
+/* Percentile Fractions */
+ARR_DESC_DECLARE(statistics_fractions_f32);
+ARR_DESC_DECLARE(statistics_fractions_q15);
+
 /* Float Inputs */
 ARR_DESC_DECLARE(statistics_zeros);
 ARR_DESC_DECLARE(statistics_f_2);
@@ -41,4 +47,7 @@ ARR_DESC_DECLARE(statistics_f_15);
 ARR_DESC_DECLARE(statistics_f_32);
 ARR_DESC_DECLARE(statistics_f_all);
 
+/* Spectra */
+ARR_DESC_DECLARE(statistics_spectra);
+
 #endif /* _STATISTICS_TEST_DATA_H_ */
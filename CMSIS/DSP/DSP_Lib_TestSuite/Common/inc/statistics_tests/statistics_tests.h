@@ -9,7 +9,10 @@ JTEST_DECLARE_GROUP(mean_tests);
 JTEST_DECLARE_GROUP(min_tests);
 JTEST_DECLARE_GROUP(power_tests);
 JTEST_DECLARE_GROUP(rms_tests);
+JTEST_DECLARE_GROUP(select_tests);
+JTEST_DECLARE_GROUP(spectral_features_tests);
 JTEST_DECLARE_GROUP(std_tests);
 JTEST_DECLARE_GROUP(var_tests);
+JTEST_DECLARE_GROUP(zcr_energy_tests);
 
 #endif /* _STATISTICS_TESTS_H_ */
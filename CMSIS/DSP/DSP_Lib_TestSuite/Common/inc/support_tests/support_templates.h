@@ -60,6 +60,12 @@
 #define REF_x_to_y_INPUT_INTERFACE(input, block_size)       \
     PAREN(input, support_output_ref.data_ptr, block_size)
 
+#define ARM_sort_INPUT_INTERFACE(input, block_size)                 \
+    PAREN(&sort_inst, input, support_output_fut.data_ptr, block_size)
+
+#define REF_sort_INPUT_INTERFACE(input, block_size)         \
+    PAREN(input, support_output_ref.data_ptr, block_size)
+
 /*--------------------------------------------------------------------------------*/
 /* Test Templates */
 /*--------------------------------------------------------------------------------*/
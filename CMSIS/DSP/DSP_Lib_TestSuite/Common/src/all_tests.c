@@ -4,6 +4,7 @@
 #include "controller_test_group.h"
 #include "fast_math_test_group.h"
 #include "filtering_test_group.h"
+#include "interpolation_test_group.h"
 #include "matrix_test_group.h"
 #include "statistics_test_group.h"
 #include "support_test_group.h"
@@ -20,6 +21,7 @@ JTEST_DEFINE_GROUP(all_tests)
     JTEST_GROUP_CALL(controller_tests);
     JTEST_GROUP_CALL(fast_math_tests);
     JTEST_GROUP_CALL(filtering_tests);
+    JTEST_GROUP_CALL(interpolation_tests);
     JTEST_GROUP_CALL(matrix_tests);
     JTEST_GROUP_CALL(statistics_tests);
     JTEST_GROUP_CALL(support_tests);
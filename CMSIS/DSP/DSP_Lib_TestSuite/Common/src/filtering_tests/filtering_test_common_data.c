@@ -590,6 +590,12 @@ ARR_DESC_DEFINE(uint8_t,
                 CURLY(
                       1, 2, 4, 7, 11, FILTERING_MAX_M));
 
+ARR_DESC_DEFINE(uint16_t,
+                filtering_median_winsizes,
+                5,
+                CURLY(
+                      1, 3, 5, 9, FILTERING_MAX_BLOCKSIZE));
+
 
 /*--------------------------------------------------------------------------------*/
 /* Coefficient Lists */
@@ -12,6 +12,7 @@ JTEST_DEFINE_GROUP(filtering_tests)
     JTEST_GROUP_CALL(fir_tests);
     JTEST_GROUP_CALL(iir_tests);
     JTEST_GROUP_CALL(lms_tests);
+    JTEST_GROUP_CALL(median_tests);
 
     return;
 }
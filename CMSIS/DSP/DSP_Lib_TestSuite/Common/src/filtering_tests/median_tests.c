@@ -0,0 +1,108 @@
+#include "jtest.h"
+#include "filtering_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "filtering_templates.h"
+#include "type_abbrev.h"
+
+/*
+  The filter is run from its initial state, so every output before the
+  window is full is the median of a growing window, averaged over the two
+  middle samples when the count is even. The block is split in two calls to
+  check that the window is carried over.
+*/
+#define MEDIAN_DEFINE_TEST(suffix, output_type)                             \
+   JTEST_DEFINE_TEST(arm_median_##suffix##_test,                            \
+         arm_median_##suffix)                                               \
+   {                                                                        \
+      arm_median_instance_##suffix median_inst_fut = { 0 };                 \
+      uint32_t firstSize;                                                   \
+                                                                            \
+      TEMPLATE_DO_ARR_DESC(                                                 \
+            blocksize_idx, uint32_t, blockSize, filtering_blocksizes        \
+            ,                                                               \
+         TEMPLATE_DO_ARR_DESC(                                              \
+               winsize_idx, uint16_t, winSize, filtering_median_winsizes    \
+               ,                                                            \
+               /* Display test parameter values */                          \
+               JTEST_DUMP_STRF("Block Size: %d\n"                           \
+                               "Window Size: %d\n",                         \
+                               (int)blockSize,                              \
+                               (int)winSize);                               \
+                                                                            \
+               /* Initialize the median Instance */                         \
+               if (arm_median_init_##suffix(                                \
+                         &median_inst_fut, winSize,                         \
+                         (output_type *) filtering_pState,                  \
+                         (int16_t *) filtering_scratch) != ARM_MATH_SUCCESS)\
+               {                                                            \
+                  return JTEST_TEST_FAILED;                                 \
+               }                                                            \
+                                                                            \
+               firstSize = blockSize / 2;                                   \
+               arm_median_##suffix(                                         \
+                     &median_inst_fut,                                      \
+                     (void *) filtering_##suffix##_inputs,                  \
+                     (void *) filtering_output_fut,                         \
+                     firstSize);                                            \
+                                                                            \
+               JTEST_COUNT_CYCLES(                                          \
+                     arm_median_##suffix(                                   \
+                           &median_inst_fut,                                \
+                           (output_type *) filtering_##suffix##_inputs      \
+                           + firstSize,                                     \
+                           (output_type *) filtering_output_fut             \
+                           + firstSize,                                     \
+                           blockSize - firstSize));                         \
+                                                                            \
+               ref_median_##suffix(                                         \
+                     (void *) filtering_##suffix##_inputs,                  \
+                     (void *) filtering_output_ref,                         \
+                     blockSize,                                             \
+                     winSize);                                              \
+                                                                            \
+               TEST_ASSERT_BUFFERS_EQUAL(                                   \
+                     filtering_output_ref,                                  \
+                     filtering_output_fut,                                  \
+                     blockSize * sizeof(output_type))));                    \
+                                                                            \
+      return JTEST_TEST_PASSED;                                             \
+   }
+
+/**
+ *  An even window length is rejected by the initialization function.
+ */
+JTEST_DEFINE_TEST(arm_median_init_f32_test,
+                  arm_median_init_f32)
+{
+    arm_median_instance_f32 median_inst = { 0 };
+
+    TEST_ASSERT_EQUAL(
+        arm_median_init_f32(&median_inst, 4,
+                            filtering_pState,
+                            (int16_t *) filtering_scratch),
+        ARM_MATH_ARGUMENT_ERROR);
+
+    return JTEST_TEST_PASSED;
+}
+
+MEDIAN_DEFINE_TEST(f32, float32_t);
+MEDIAN_DEFINE_TEST(q31, q31_t);
+MEDIAN_DEFINE_TEST(q15, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(median_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_median_init_f32_test);
+    JTEST_TEST_CALL(arm_median_f32_test);
+    JTEST_TEST_CALL(arm_median_q31_test);
+    JTEST_TEST_CALL(arm_median_q15_test);
+}
@@ -0,0 +1,137 @@
+#include "jtest.h"
+#include "interpolation_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "interpolation_templates.h"
+#include "type_abbrev.h"
+
+#define INTERP_TABLE_LEN 16
+#define INTERP_X1 (-1.5f)
+#define INTERP_SPACING 0.25f
+
+/* Input positions of the block */
+static float32_t interp_x_f32[INTERPOLATION_MAX_BLOCKSIZE];
+static q31_t interp_x_q31[INTERPOLATION_MAX_BLOCKSIZE];
+
+/**
+ *  Spread blockSize positions from two table steps below the first point to
+ *  two steps above the last one, so both ends are clamped. The positions land
+ *  on the last point of the table for some block sizes.
+ */
+static void interp_block_positions(uint32_t blockSize)
+{
+    uint32_t n;
+    uint32_t span = INTERP_TABLE_LEN + 3;
+
+    for (n = 0; n < blockSize; n++)
+    {
+        interp_x_f32[n] = INTERP_X1 + INTERP_SPACING *
+            (-2.0f + (float32_t) (n * span) / (float32_t) blockSize);
+
+        /* 12.20 format */
+        interp_x_q31[n] = (q31_t) ((((q63_t) n * span) << 20) / blockSize) - (2 << 20);
+    }
+}
+
+/**
+ *  Interpolate a random table of floating-point values, the functions under
+ *  test sharing the instance of the linear interpolation.
+ */
+#define INTERP_BLOCK_F32_DEFINE_TEST(kind)                              \
+    JTEST_DEFINE_TEST(arm_##kind##_interp_block_f32_test,               \
+                      arm_##kind##_interp_block_f32)                    \
+    {                                                                   \
+        arm_linear_interp_instance_f32 interp_inst =                    \
+        {                                                               \
+            INTERP_TABLE_LEN, INTERP_X1, INTERP_SPACING,                \
+            (float32_t *) interpolation_f32_inputs                      \
+        };                                                              \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            blocksize_idx, uint32_t, blockSize, interpolation_blocksizes \
+            ,                                                           \
+            /* Display test parameter values */                         \
+            JTEST_DUMP_STRF("Block Size: %d\n",                         \
+                            (int)blockSize);                            \
+                                                                        \
+            interp_block_positions(blockSize);                          \
+                                                                        \
+            JTEST_COUNT_CYCLES(                                         \
+                arm_##kind##_interp_block_f32(                          \
+                    &interp_inst,                                       \
+                    interp_x_f32,                                       \
+                    interpolation_output_fut,                           \
+                    blockSize));                                        \
+                                                                        \
+            ref_##kind##_interp_block_f32(                              \
+                &interp_inst,                                           \
+                interp_x_f32,                                           \
+                interpolation_output_ref,                               \
+                blockSize);                                             \
+                                                                        \
+            INTERPOLATION_ASSERT_CLOSE(                                 \
+                interpolation_output_ref,                               \
+                interpolation_output_fut,                               \
+                blockSize,                                              \
+                INTERPOLATION_TOLERANCE_float32_t));                    \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+INTERP_BLOCK_F32_DEFINE_TEST(linear);
+INTERP_BLOCK_F32_DEFINE_TEST(cubic);
+
+/**
+ *  The Q15 outputs are truncated the same way by the reference function, so
+ *  they are compared exactly.
+ */
+JTEST_DEFINE_TEST(arm_linear_interp_block_q15_test,
+                  arm_linear_interp_block_q15)
+{
+    TEMPLATE_DO_ARR_DESC(
+        blocksize_idx, uint32_t, blockSize, interpolation_blocksizes
+        ,
+        /* Display test parameter values */
+        JTEST_DUMP_STRF("Block Size: %d\n",
+                        (int)blockSize);
+
+        interp_block_positions(blockSize);
+
+        JTEST_COUNT_CYCLES(
+            arm_linear_interp_block_q15(
+                (q15_t *) interpolation_q15_inputs,
+                interp_x_q31,
+                (q15_t *) interpolation_output_fut,
+                INTERP_TABLE_LEN,
+                blockSize));
+
+        ref_linear_interp_block_q15(
+            (q15_t *) interpolation_q15_inputs,
+            interp_x_q31,
+            (q15_t *) interpolation_output_ref,
+            INTERP_TABLE_LEN,
+            blockSize);
+
+        TEST_ASSERT_BUFFERS_EQUAL(
+            interpolation_output_ref,
+            interpolation_output_fut,
+            blockSize * sizeof(q15_t)));
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(interp_block_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_linear_interp_block_f32_test);
+    JTEST_TEST_CALL(arm_linear_interp_block_q15_test);
+    JTEST_TEST_CALL(arm_cubic_interp_block_f32_test);
+}
@@ -0,0 +1,171 @@
+#include "interpolation_test_data.h"
+
+/*--------------------------------------------------------------------------------*/
+/* Input/Output Buffers */
+/*--------------------------------------------------------------------------------*/
+
+float32_t interpolation_output_fut[INTERPOLATION_MAX_OUTPUTS] = {0};
+float32_t interpolation_output_ref[INTERPOLATION_MAX_OUTPUTS] = {0};
+
+/* Tap buffers of the resize instances */
+uint16_t interpolation_index[INTERPOLATION_MAX_TAPS] = {0};
+float32_t interpolation_coef[INTERPOLATION_MAX_TAPS] = {0};
+
+/*--------------------------------------------------------------------------------*/
+/* Block Sizes */
+/*--------------------------------------------------------------------------------*/
+
+ARR_DESC_DEFINE(uint32_t,
+                interpolation_blocksizes,
+                5,
+                CURLY(1, 2, 19, 32, INTERPOLATION_MAX_BLOCKSIZE));
+
+/*--------------------------------------------------------------------------------*/
+/* Resize Configurations */
+/*--------------------------------------------------------------------------------*/
+
+ARR_DESC_DEFINE(arm_resize_mode,
+                interpolation_resize_modes,
+                2,
+                CURLY(ARM_RESIZE_BILINEAR, ARM_RESIZE_CUBIC));
+
+/* Source dimensions, a single pixel only repeats the edge */
+ARR_DESC_DEFINE(uint16_t,
+                interpolation_resize_src_dims,
+                3,
+                CURLY(1, 3, 8));
+
+/* Output dimensions, smaller and larger than the source ones */
+ARR_DESC_DEFINE(uint16_t,
+                interpolation_resize_dst_dims,
+                3,
+                CURLY(1, 4, 11));
+
+ARR_DESC_DEFINE(uint16_t,
+                interpolation_resize_channels,
+                2,
+                CURLY(1, 3));
+
+/*--------------------------------------------------------------------------------*/
+/* Test Data */
+/*--------------------------------------------------------------------------------*/
+
+const q31_t interpolation_q31_inputs[INTERPOLATION_MAX_INPUTS] =
+{
+	0xD081A3D4, 0x300A65CC, 0x1894F5B6, 0x4CDAC1B3, 0xECA51B19, 0xAA30B2DE,
+	0xBAFCF1AA, 0xDF21D0F6, 0x41E10912, 0xBE4F5EEA, 0x6D6F93E1, 0xE67AAD0B,
+	0x08BDD042, 0xA7CFED95, 0x25B4DFB6, 0xE29C0C8C, 0xA6C54407, 0x66950D0C,
+	0xC5AE2D2A, 0xA9CD4D13, 0x304E8458, 0xEC240AE8, 0xB2538EB6, 0x789DC152,
+	0x60FAFAD4, 0xF9AF3B2D, 0x8BC1EAEA, 0x02681E69, 0xD5810865, 0xEB82A153,
+	0x3C514518, 0xB91E4C58, 0x2CB5CB6F, 0x58F0B835, 0x6CA64674, 0x566560FC,
+	0xFA4B4790, 0xA1DE4B44, 0x6819C748, 0xB3DD0F36, 0xD761E349, 0x2F8EFCE9,
+	0x2CB9D8D0, 0xC790B940, 0xC107D7D0, 0xF556201A, 0xDBE81ED9, 0x5C4471C5,
+	0x5D75D223, 0x0DCA457F, 0x34AC7394, 0xC5E4D955, 0x19EE2945, 0x31EDB012,
+	0x24E69CF7, 0x775944FA, 0x4A99E9BA, 0x2550F7E1, 0x989B98BF, 0xA4D94660,
+	0xDFC81177, 0x86600B87, 0x41CC8120, 0xB693CB02, 0xEE415F23, 0xD7C361AB,
+	0x2ADEE6AB, 0xA0119289, 0x8011C546, 0xAB3F8084, 0xBEC593E4, 0xB202B2F6,
+	0xE6DB7CFD, 0x63E66E99, 0xE98C395C, 0xED6378CC, 0xF4388D40, 0xB9AC3D0C,
+	0x153B097E, 0xB9ACE861, 0xDD8E2FC9, 0x81E0743C, 0x006701E8, 0x1C4D6129,
+	0x755FFF76, 0xACF968BA, 0x5D675B70, 0x3A411755, 0x6EAA486B, 0xCA5DA297,
+	0x15FB489A, 0x6945913E, 0x68ACFCFE, 0x30D4F868, 0xAD8C5299, 0xE10C869B,
+	0xAB809A53, 0x218645CE, 0x019F53F9, 0x93A61930, 0xCBC3B040, 0x5FD9A046,
+	0x505E8288, 0xCE22AC13, 0x8A291F15, 0x8CE12981, 0x4D832DEC, 0x1F1C8721,
+	0xABFE1529, 0x8D570702, 0x810872F3, 0xCE5E4373, 0xDFDAE4D7, 0xA3E23372,
+	0x0E83769C, 0x34E2B6B6, 0x65B04694, 0x284DCFB7, 0xFC6F153E, 0x005CEE6C,
+	0x05C37466, 0xE59D3C8F, 0x1B9A26D4, 0x718D23F1, 0xB86573D4, 0x68EAFEC4,
+	0xFAED7794, 0x226FA4FD, 0x158F38B4, 0x4CC88B68, 0x30C94DF7, 0x735EC277,
+	0xB14A96AA, 0x774EFF10, 0x82A04DC7, 0x64CBB3BD, 0xED4521D5, 0x6E596A28,
+	0x203938AE, 0x115AA092, 0x215E3EEF, 0xCA92B242, 0x34688EAE, 0xD27BDACB,
+	0x6D83D349, 0x7B55FE6F, 0x3D8693D1, 0xE0A720C3, 0x7BACFBD6, 0x1C46958A,
+	0x16DF8844, 0x365F246B, 0x94441C62, 0x06DFB537, 0x4FF1DA63, 0x53BEFAC3,
+	0x3872E325, 0xDAABDC46, 0x25B30DA1, 0xE3EC06C3, 0x50BA2AFD, 0xDE6B7A75,
+	0x4C2FA01B, 0xF0CC6AC4, 0xF9DA1A44, 0xDD694F55, 0xA7E285CF, 0x38DC0644,
+	0xDD31C1B7, 0x1BCEC0E6, 0x7A684B9E, 0x27744883, 0x1785D9BF, 0x90BDFA1F,
+	0xA0FB46A6, 0x07643E47, 0xBD2B79E4, 0x67BBA935, 0xFC148E2D, 0xF09791AB,
+	0x01BEB637, 0x7DCC568C, 0x0967FE03, 0x5573BCA8, 0xC9826872, 0x64083CD6,
+	0x3BDA8640, 0x6182DC36, 0x0388DAEE, 0x64ADEA23, 0x1293629B, 0x7AF66590,
+	0xCEA9E1F7, 0x2B615CC6, 0x8A529FC0, 0x4BC11B1E, 0xEBBF8C05, 0x71550906,
+	0xC69A4947, 0x0D415AD8, 0x7B459997, 0x93AE8DB3, 0x58FE9C09, 0x5B709F3B,
+	0x585F701A, 0x7F4DCC7D, 0x2AE4FED8, 0xACEFF4C1, 0xECAD77B4, 0x24DCE3BD,
+	0x68602459, 0x5E2BF3C3, 0x79273C8B, 0x86992AC6, 0x6861E95A, 0x0CB2327D,
+	0x8BB628BA, 0x21A9A3A4, 0xDA946F55, 0xA1A98A94, 0xA6003C53, 0x130EB6CD,
+	0x7DD60024, 0x8BFC8627, 0xAD441663, 0x88FCDC9A, 0xC4F2F194, 0x550790F3,
+	0x9C0C92B8, 0x74541AED, 0x880A2ADC, 0x50EDD875, 0x30FE8819, 0x26568977,
+	0x2696E78B, 0x5E1A2499, 0xAA55CA0E, 0x24530D90, 0xB7422ABB, 0x112920C8,
+	0xD586A415, 0xD4FE7011, 0x43B346D1, 0x5D808A2F, 0x6C0202BC, 0x09CDF975,
+	0x01FF2F7C, 0xA1E48A62, 0x95525B94, 0x7DE53A5B, 0x8F8938BA, 0x8D49A612,
+	0x43028D2D, 0x84189509, 0xAB5C6277, 0x82EA3E6B
+};
+
+/* The source data is random across the q31_t range. Accessing it by halfword
+   or byte should remain random and full scale. */
+const q15_t * interpolation_q15_inputs = (q15_t *) interpolation_q31_inputs;
+const q7_t * interpolation_q7_inputs = (q7_t *) interpolation_q31_inputs;
+
+const float32_t interpolation_f32_inputs[INTERPOLATION_MAX_INPUTS] =
+{
+	0.7955773605, -0.1425325188, 0.2385463656, 0.1789428057,
+	0.1178681810, -0.5670382039, -0.9639204552, 0.9803241859,
+	0.7142574319, 0.9628766971, 0.6877014469, -0.7494652644,
+	-0.6735497663, -0.1823865231, 0.3118443701, 0.4012852056,
+	0.3542327388, -0.0700008180, -0.5553145163, 0.2245664662,
+	-0.2686770451, 0.3354335952, -0.6787686917, 0.7217279061,
+	-0.8667471814, 0.9804594646, 0.9355169031, 0.3449114457,
+	0.2489940659, -0.5917016562, 0.2144524882, -0.1077368117,
+	0.1939186798, -0.8920223199, 0.6408497521, 0.2910243873,
+	0.6399113680, 0.5827439211, -0.9929299566, -0.5095212773,
+	0.2001489843, -0.2806651701, -0.7000442785, 0.4883487187,
+	0.8487986140, -0.0838625663, -0.0336196573, 0.0974079839,
+	0.5319374428, 0.1657949692, -0.5040243201, -0.3110275996,
+	-0.6455562848, -0.2670721105, -0.3206282436, 0.7378853501,
+	-0.5675337402, -0.5865625653, -0.3274748689, 0.0508831196,
+	0.6907387224, -0.0835331905, -0.2014423171, 0.6279457921,
+	-0.8422117155, -0.1612508669, 0.1816414737, -0.7368627579,
+	-0.4458042791, 0.7277988949, 0.4134310704, -0.3354756899,
+	0.9095538601, -0.0133712758, 0.1169689806, 0.3647021997,
+	0.7814871415, -0.3985428723, -0.7301070429, -0.1857770014,
+	0.6179488361, 0.7690658406, 0.1181915517, -0.0393975442,
+	0.8986012122, -0.3469744941, 0.2763226134, -0.7261804508,
+	0.5439023834, 0.9216481459, 0.1551798112, -0.9447435471,
+	0.9036507791, 0.7851090991, 0.2632723941, -0.0570187197,
+	-0.4316004914, -0.1047978967, -0.2993364965, -0.8536862654,
+	-0.7194740531, 0.2002847101, -0.3417399295, -0.4406556868,
+	-0.1974293037, -0.7692924689, -0.0765445824, 0.8011568744,
+	-0.6360439700, 0.3929856674, -0.0013001867, 0.3433457255,
+	0.3065354385, -0.5552817010, -0.2808985594, 0.9757750319,
+	-0.8251631173, -0.3946559023, 0.9572413065, -0.1858321525,
+	0.2421302412, -0.1202305205, -0.3470587102, 0.0618040897,
+	-0.6466821048, -0.8734328966, -0.3397832400, -0.8948245760,
+	-0.1406683415, 0.7288344938, -0.0714261885, -0.9745227590,
+	0.0221931218, -0.5174364229, -0.6808122632, 0.9535335687,
+	0.1144199222, 0.9450994913, -0.6110062567, 0.4781264499,
+	-0.3063665841, 0.1992550294, -0.9005450736, -0.7550102412,
+	-0.6703508935, 0.0896382263, 0.4938774064, -0.8637608588,
+	-0.3154106522, 0.9200054077, 0.0626036456, -0.1466993300,
+	0.9629331962, 0.4651598800, -0.1295610343, -0.2795623696,
+	0.4991311132, 0.0736940229, -0.6613469695, -0.2342626204,
+	0.6788116370, -0.6378002701, 0.3775773888, 0.7974795654,
+	-0.2957996618, -0.6793028821, 0.7098147333, -0.9945064502,
+	0.4674555685, 0.3078450523, -0.5763666917, -0.4911493812,
+	-0.3970335921, 0.0860607151, -0.0265311083, 0.8683280048,
+	0.1020497415, 0.2680534204, 0.5780229116, -0.6674504484,
+	0.5811269772, -0.8262815875, 0.6059302321, -0.8453514972,
+	-0.4744871936, -0.9543462426, -0.6678855047, -0.3955118271,
+	-0.8266388941, 0.7321509049, 0.3393821504, -0.3716007404,
+	0.7987824829, -0.6100913925, -0.7177355420, 0.2806557928,
+	-0.8274073900, 0.7223757351, -0.0749784628, -0.2014182855,
+	0.2841769741, -0.6420218560, 0.8151474934, -0.8747300492,
+	-0.1091994306, 0.4016652550, -0.9460180899, 0.9724220351,
+	0.0908454741, 0.6872470938, -0.2236021043, -0.1481108111,
+	0.0718985497, 0.9346873383, -0.0258315242, 0.4088637310,
+	-0.1336262024, -0.4573466690, 0.7836340878, 0.9432849387,
+	-0.9798131465, 0.9852396039, 0.9571370635, -0.0359305959,
+	-0.4523674847, 0.3060870962, 0.8176229547, 0.8381306122,
+	0.6068224305, 0.7247089764, 0.0713060234, -0.7639056711,
+	0.8289863870, -0.2562091239, -0.1299919427, -0.1216631372,
+	-0.5824665840, 0.8134848904, -0.9473984192, -0.0665433541,
+	-0.9005792224, 0.4287146286, -0.9610601176, 0.6674820952,
+	0.1635917763, -0.0915989481, 0.6826315764, -0.1016793189,
+	-0.3199999347, 0.5053930529, -0.6449372761, -0.4785322361,
+	-0.5519255692, -0.6516697702, 0.1731875149, -0.5480871100
+};
@@ -0,0 +1,12 @@
+#include "jtest.h"
+#include "interpolation_tests.h"
+
+JTEST_DEFINE_GROUP(interpolation_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_GROUP_CALL(interp_block_tests);
+    JTEST_GROUP_CALL(resize_tests);
+    return;
+}
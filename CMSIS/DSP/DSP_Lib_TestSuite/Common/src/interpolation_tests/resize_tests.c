@@ -0,0 +1,141 @@
+#include "jtest.h"
+#include "interpolation_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "interpolation_templates.h"
+#include "type_abbrev.h"
+
+/*
+  Largest output error documented for each resize function, in output LSBs
+  for the fixed-point versions.
+*/
+#define RESIZE_TOLERANCE_f32(mode) INTERPOLATION_TOLERANCE_float32_t
+#define RESIZE_TOLERANCE_q15(mode) (((mode) == ARM_RESIZE_CUBIC) ? 9 : 5)
+#define RESIZE_TOLERANCE_q7(mode)  1
+
+/*
+  Resize random full scale images, both smaller and larger, so that the edge
+  samples are repeated. The Q15 bilinear mode runs the dual multiply path on
+  the cores with the DSP extension and the scalar path on the other ones.
+*/
+#define RESIZE_DEFINE_TEST(suffix, coef_type)                               \
+   JTEST_DEFINE_TEST(arm_resize_##suffix##_test,                            \
+         arm_resize_##suffix)                                               \
+   {                                                                        \
+      arm_resize_instance_##suffix resize_inst_fut = { 0 };                 \
+                                                                            \
+      TEMPLATE_DO_ARR_DESC(                                                 \
+            mode_idx, arm_resize_mode, mode, interpolation_resize_modes     \
+            ,                                                               \
+      TEMPLATE_DO_ARR_DESC(                                                 \
+            src_rows_idx, uint16_t, srcRows, interpolation_resize_src_dims  \
+            ,                                                               \
+      TEMPLATE_DO_ARR_DESC(                                                 \
+            src_cols_idx, uint16_t, srcCols, interpolation_resize_src_dims  \
+            ,                                                               \
+      TEMPLATE_DO_ARR_DESC(                                                 \
+            dst_rows_idx, uint16_t, dstRows, interpolation_resize_dst_dims  \
+            ,                                                               \
+      TEMPLATE_DO_ARR_DESC(                                                 \
+            dst_cols_idx, uint16_t, dstCols, interpolation_resize_dst_dims  \
+            ,                                                               \
+      TEMPLATE_DO_ARR_DESC(                                                 \
+            channels_idx, uint16_t, numChannels,                            \
+            interpolation_resize_channels                                   \
+            ,                                                               \
+            uint32_t numOutputs =                                           \
+               (uint32_t) dstRows * dstCols * numChannels;                  \
+                                                                            \
+            /* Display test parameter values */                             \
+            JTEST_DUMP_STRF("Mode: %d\n"                                    \
+                            "Source: %dx%dx%d\n"                            \
+                            "Output: %dx%d\n",                              \
+                            (int)mode,                                      \
+                            (int)srcRows,                                   \
+                            (int)srcCols,                                   \
+                            (int)numChannels,                               \
+                            (int)dstRows,                                   \
+                            (int)dstCols);                                  \
+                                                                            \
+            /* Initialize the resize Instance */                            \
+            if (arm_resize_init_##suffix(                                   \
+                      &resize_inst_fut, srcRows, srcCols,                   \
+                      dstRows, dstCols, numChannels, mode,                  \
+                      interpolation_index,                                  \
+                      (coef_type *) interpolation_coef) != ARM_MATH_SUCCESS)\
+            {                                                               \
+               return JTEST_TEST_FAILED;                                    \
+            }                                                               \
+                                                                            \
+            JTEST_COUNT_CYCLES(                                             \
+                  arm_resize_##suffix(                                      \
+                        &resize_inst_fut,                                   \
+                        (void *) interpolation_##suffix##_inputs,           \
+                        (void *) interpolation_output_fut));                \
+                                                                            \
+            ref_resize_##suffix(                                            \
+                  (void *) interpolation_##suffix##_inputs,                 \
+                  (void *) interpolation_output_ref,                        \
+                  srcRows, srcCols, dstRows, dstCols,                       \
+                  numChannels, mode);                                       \
+                                                                            \
+            INTERPOLATION_ASSERT_CLOSE(                                     \
+                  (TYPE_FROM_ABBREV(suffix) *) interpolation_output_ref,    \
+                  (TYPE_FROM_ABBREV(suffix) *) interpolation_output_fut,    \
+                  numOutputs,                                               \
+                  RESIZE_TOLERANCE_##suffix(mode))))))));                   \
+                                                                            \
+      return JTEST_TEST_PASSED;                                             \
+   }
+
+/**
+ *  The column offsets are stored in 16 bits, so a source row holds at most
+ *  65536 samples. The last column offsets of the largest row are checked
+ *  after the initialization, and a longer row is rejected.
+ */
+JTEST_DEFINE_TEST(arm_resize_init_q15_test,
+                  arm_resize_init_q15)
+{
+    arm_resize_instance_q15 resize_inst = { 0 };
+
+    TEST_ASSERT_EQUAL(
+        arm_resize_init_q15(&resize_inst, 1, 4, 1, 8, 16384,
+                            ARM_RESIZE_BILINEAR, interpolation_index,
+                            (q15_t *) interpolation_coef),
+        ARM_MATH_SUCCESS);
+
+    /* Both taps of the first and last output columns repeat the edge columns */
+    TEST_ASSERT_EQUAL(interpolation_index[2], 0);
+    TEST_ASSERT_EQUAL(interpolation_index[3], 0);
+    TEST_ASSERT_EQUAL(interpolation_index[2 + 2 * 7], 3 * 16384);
+    TEST_ASSERT_EQUAL(interpolation_index[2 + 2 * 7 + 1], 3 * 16384);
+
+    TEST_ASSERT_EQUAL(
+        arm_resize_init_q15(&resize_inst, 1, 4, 1, 8, 16385,
+                            ARM_RESIZE_BILINEAR, interpolation_index,
+                            (q15_t *) interpolation_coef),
+        ARM_MATH_ARGUMENT_ERROR);
+
+    return JTEST_TEST_PASSED;
+}
+
+RESIZE_DEFINE_TEST(f32, float32_t);
+RESIZE_DEFINE_TEST(q15, q15_t);
+RESIZE_DEFINE_TEST(q7, q15_t);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(resize_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_resize_init_q15_test);
+    JTEST_TEST_CALL(arm_resize_f32_test);
+    JTEST_TEST_CALL(arm_resize_q15_test);
+    JTEST_TEST_CALL(arm_resize_q7_test);
+}
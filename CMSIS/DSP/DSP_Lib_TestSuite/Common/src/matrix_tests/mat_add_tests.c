@@ -18,6 +18,7 @@
 JTEST_ARM_MAT_ADD_TEST(f32);
 JTEST_ARM_MAT_ADD_TEST(q31);
 JTEST_ARM_MAT_ADD_TEST(q15);
+JTEST_ARM_MAT_ADD_TEST(q7);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -28,4 +29,5 @@ JTEST_DEFINE_GROUP(mat_add_tests)
     JTEST_TEST_CALL(arm_mat_add_f32_test);
     JTEST_TEST_CALL(arm_mat_add_q31_test);
     JTEST_TEST_CALL(arm_mat_add_q15_test);
+    JTEST_TEST_CALL(arm_mat_add_q7_test);
 }
@@ -42,6 +42,7 @@
 JTEST_ARM_MAT_INIT_TEST(f32);
 JTEST_ARM_MAT_INIT_TEST(q31);
 JTEST_ARM_MAT_INIT_TEST(q15);
+JTEST_ARM_MAT_INIT_TEST(q7);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -55,4 +56,5 @@ JTEST_DEFINE_GROUP(mat_init_tests)
     JTEST_TEST_CALL(arm_mat_init_f32_test);
     JTEST_TEST_CALL(arm_mat_init_q31_test);
     JTEST_TEST_CALL(arm_mat_init_q15_test);
+    JTEST_TEST_CALL(arm_mat_init_q7_test);
 }
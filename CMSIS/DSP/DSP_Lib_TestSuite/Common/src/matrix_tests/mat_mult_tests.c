@@ -44,6 +44,32 @@ JTEST_DEFINE_TEST(arm_mat_mult_q15_test, arm_mat_mult_q15)
         MATRIX_COMPARE_INTERFACE);
 }
 
+/*--------------------------------------------------------------------------------*/
+/* Q7 also takes a scratch buffer for the transpose of B. */
+/*--------------------------------------------------------------------------------*/
+
+#define ARM_mat_mult_q7_INPUT_INTERFACE(input_a_ptr, input_b_ptr)  \
+    PAREN(input_a_ptr, input_b_ptr,                                     \
+          (void *) &matrix_output_fut,                                  \
+          (q7_t *) matrix_output_scratch)
+
+JTEST_DEFINE_TEST(arm_mat_mult_q7_test, arm_mat_mult_q7)
+{
+    MATRIX_TEST_TEMPLATE_ELT2(
+        matrix_q7_a_inputs,
+        matrix_q7_b_inputs,
+        arm_matrix_instance_q7 * ,
+        arm_matrix_instance_q7,
+        TYPE_FROM_ABBREV(q7),
+        arm_mat_mult_q7,
+        ARM_mat_mult_q7_INPUT_INTERFACE,
+        ref_mat_mult_q7,
+        REF_mat_mult_INPUT_INTERFACE,
+        MATRIX_TEST_CONFIG_MULTIPLICATIVE_OUTPUT,
+        MATRIX_TEST_VALID_MULTIPLICATIVE_DIMENSIONS,
+        MATRIX_COMPARE_INTERFACE);
+}
+
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
 /*--------------------------------------------------------------------------------*/
@@ -56,4 +82,5 @@ JTEST_DEFINE_GROUP(mat_mult_tests)
     JTEST_TEST_CALL(arm_mat_mult_f32_test);
     JTEST_TEST_CALL(arm_mat_mult_q31_test);
     JTEST_TEST_CALL(arm_mat_mult_q15_test);
+    JTEST_TEST_CALL(arm_mat_mult_q7_test);
 }
@@ -17,6 +17,7 @@
 JTEST_ARM_MAT_TRANS_TEST(f32);
 JTEST_ARM_MAT_TRANS_TEST(q31);
 JTEST_ARM_MAT_TRANS_TEST(q15);
+JTEST_ARM_MAT_TRANS_TEST(q7);
 
 /*--------------------------------------------------------------------------------*/
 /* Collect all tests in a group. */
@@ -30,4 +31,5 @@ JTEST_DEFINE_GROUP(mat_trans_tests)
     JTEST_TEST_CALL(arm_mat_trans_f32_test);
     JTEST_TEST_CALL(arm_mat_trans_q31_test);
     JTEST_TEST_CALL(arm_mat_trans_q15_test);
+    JTEST_TEST_CALL(arm_mat_trans_q7_test);
 }
@@ -0,0 +1,66 @@
+#include "jtest.h"
+#include "matrix_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "matrix_templates.h"
+#include "type_abbrev.h"
+
+/**
+ *  The data of the matching 'b' input is used as the vector. Every 'b' input
+ *  holds at least as many elements as its 'a' input has columns.
+ */
+#define JTEST_ARM_MAT_VEC_MULT_TEST(suffix)                             \
+    JTEST_DEFINE_TEST(arm_mat_vec_mult_##suffix##_test,                 \
+                      arm_mat_vec_mult_##suffix)                        \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_a_idx, arm_matrix_instance_##suffix *, input_a,       \
+            matrix_##suffix##_a_inputs                                  \
+            ,                                                           \
+            arm_matrix_instance_##suffix * input_b = ARR_DESC_ELT(      \
+                arm_matrix_instance_##suffix *, input_a_idx,            \
+                &(matrix_##suffix##_b_inputs));                         \
+                                                                        \
+            JTEST_DUMP_STRF("Matrix Dimensions: %dx%d\n",               \
+                            (int)input_a->numRows,                      \
+                            (int)input_a->numCols);                     \
+                                                                        \
+            MATRIX_TEST_CONFIG_VECTOR_OUTPUT(                           \
+                arm_matrix_instance_##suffix *,                         \
+                input_a);                                               \
+                                                                        \
+            TEST_CALL_FUT_AND_REF(                                      \
+                arm_mat_vec_mult_##suffix,                              \
+                ARM_mat_vec_mult_INPUT_INTERFACE(                       \
+                    input_a, input_b->pData),                           \
+                ref_mat_vec_mult_##suffix,                              \
+                REF_mat_vec_mult_INPUT_INTERFACE(                       \
+                    input_a, input_b->pData));                          \
+                                                                        \
+            MATRIX_COMPARE_INTERFACE(arm_matrix_instance_##suffix,      \
+                                     TYPE_FROM_ABBREV(suffix)));        \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_MAT_VEC_MULT_TEST(f32);
+JTEST_ARM_MAT_VEC_MULT_TEST(q31);
+JTEST_ARM_MAT_VEC_MULT_TEST(q15);
+JTEST_ARM_MAT_VEC_MULT_TEST(q7);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(mat_vec_mult_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_mat_vec_mult_f32_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q31_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q15_test);
+    JTEST_TEST_CALL(arm_mat_vec_mult_q7_test);
+}
@@ -154,7 +154,7 @@ const int32_t matrix_shift_values[MATRIX_MAX_SHIFTS_LEN] =
 /*--------------------------------------------------------------------------------*/
 
 /**
- *  Define matrices by suffix (f32, q31, q15) for use in test cases.
+ *  Define matrices by suffix (f32, q31, q15, q7) for use in test cases.
  *
  *  The rand1 and rand2 suffixes get their data from the same pool of random
  *  data, but their starting points differ by 1 element.
@@ -198,6 +198,7 @@ MATRIX_DEFINE_MATRICES(f64);
 MATRIX_DEFINE_MATRICES(f32);
 MATRIX_DEFINE_MATRICES(q31);
 MATRIX_DEFINE_MATRICES(q15);
+MATRIX_DEFINE_MATRICES(q7);
 
 /*--------------------------------------------------------------------------------*/
 /* Matrix-Input Arrays */
@@ -253,3 +254,4 @@ MATRIX_DEFINE_INPUTS(f64);
 MATRIX_DEFINE_INPUTS(f32);
 MATRIX_DEFINE_INPUTS(q31);
 MATRIX_DEFINE_INPUTS(q15);
+MATRIX_DEFINE_INPUTS(q7);
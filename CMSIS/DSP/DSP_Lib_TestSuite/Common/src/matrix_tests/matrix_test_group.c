@@ -14,6 +14,7 @@ JTEST_DEFINE_GROUP(matrix_tests)
     JTEST_GROUP_CALL(mat_mult_fast_tests);
     JTEST_GROUP_CALL(mat_sub_tests);
     JTEST_GROUP_CALL(mat_trans_tests);
+    JTEST_GROUP_CALL(mat_vec_mult_tests);
     JTEST_GROUP_CALL(mat_scale_tests);
     return;
 }
@@ -0,0 +1,160 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/* The functions reorder their input, so they work on a copy of it. */
+static float32_t statistics_select_buffer[STATISTICS_MAX_INPUT_ELEMENTS];
+
+/**
+ *  Select the smallest, the middle and the largest sample of every input.
+ */
+#define JTEST_ARM_SELECT_TEST(suffix)                                   \
+    JTEST_DEFINE_TEST(arm_select_##suffix##_test,                       \
+                      arm_select_##suffix)                              \
+    {                                                                   \
+        uint32_t k;                                                     \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    for (k = 0; k < block_size;                         \
+                         k += (block_size + 1) / 2)                     \
+                    {                                                   \
+                        memcpy(statistics_select_buffer,                \
+                               input_ptr->data_ptr,                     \
+                               block_size *                             \
+                               sizeof(TYPE_FROM_ABBREV(suffix)));       \
+                                                                        \
+                        JTEST_COUNT_CYCLES(                             \
+                            arm_select_##suffix(                        \
+                                (void *) statistics_select_buffer,      \
+                                block_size, k,                          \
+                                statistics_output_fut.data_ptr));       \
+                                                                        \
+                        ref_select_##suffix(                            \
+                            input_ptr->data_ptr, block_size, k,         \
+                            statistics_output_ref.data_ptr);            \
+                                                                        \
+                        TEST_ASSERT_BUFFERS_EQUAL(                      \
+                            statistics_output_ref.data_ptr,             \
+                            statistics_output_fut.data_ptr,             \
+                            sizeof(TYPE_FROM_ABBREV(suffix)));          \
+                    })));                                               \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/**
+ *  Compute the percentiles of every input, including fractions outside of
+ *  [0, 1].
+ */
+#define JTEST_ARM_PERCENTILE_TEST(suffix, fraction_type, fractions)     \
+    JTEST_DEFINE_TEST(arm_percentile_##suffix##_test,                   \
+                      arm_percentile_##suffix)                          \
+    {                                                                   \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_f_all        \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                block_size_idx, uint32_t, block_size,                   \
+                statistics_block_sizes                                  \
+                ,                                                       \
+                TEST_DO_VALID_BLOCKSIZE(                                \
+                    block_size, TYPE_FROM_ABBREV(suffix), input_ptr     \
+                    ,                                                   \
+                    TEMPLATE_DO_ARR_DESC(                               \
+                        fraction_idx, fraction_type, fraction,          \
+                        fractions                                       \
+                        ,                                               \
+                        memcpy(statistics_select_buffer,                \
+                               input_ptr->data_ptr,                     \
+                               block_size *                             \
+                               sizeof(TYPE_FROM_ABBREV(suffix)));       \
+                                                                        \
+                        JTEST_COUNT_CYCLES(                             \
+                            arm_percentile_##suffix(                    \
+                                (void *) statistics_select_buffer,      \
+                                block_size, fraction,                   \
+                                statistics_output_fut.data_ptr));       \
+                                                                        \
+                        ref_percentile_##suffix(                        \
+                            input_ptr->data_ptr, block_size, fraction,  \
+                            statistics_output_ref.data_ptr);            \
+                                                                        \
+                        TEST_ASSERT_BUFFERS_EQUAL(                      \
+                            statistics_output_ref.data_ptr,             \
+                            statistics_output_fut.data_ptr,             \
+                            sizeof(TYPE_FROM_ABBREV(suffix)))))));      \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+/**
+ *  An empty input returns 0 without reading the input, for any rank or
+ *  fraction.
+ */
+JTEST_DEFINE_TEST(arm_select_empty_test,
+                  arm_select_f32)
+{
+    float32_t result_f32 = 1.0f;
+    q31_t result_q31 = 1;
+    q15_t result_q15 = 1;
+
+    arm_select_f32(NULL, 0, 0, &result_f32);
+    TEST_ASSERT_EQUAL(result_f32, 0.0f);
+    arm_select_q31(NULL, 0, 5, &result_q31);
+    TEST_ASSERT_EQUAL(result_q31, 0);
+    arm_select_q15(NULL, 0, 5, &result_q15);
+    TEST_ASSERT_EQUAL(result_q15, 0);
+
+    result_f32 = 1.0f;
+    result_q31 = 1;
+    result_q15 = 1;
+
+    arm_percentile_f32(NULL, 0, 0.5f, &result_f32);
+    TEST_ASSERT_EQUAL(result_f32, 0.0f);
+    arm_percentile_q31(NULL, 0, 0x4000, &result_q31);
+    TEST_ASSERT_EQUAL(result_q31, 0);
+    arm_percentile_q15(NULL, 0, 0x4000, &result_q15);
+    TEST_ASSERT_EQUAL(result_q15, 0);
+
+    return JTEST_TEST_PASSED;
+}
+
+JTEST_ARM_SELECT_TEST(f32);
+JTEST_ARM_SELECT_TEST(q31);
+JTEST_ARM_SELECT_TEST(q15);
+
+JTEST_ARM_PERCENTILE_TEST(f32, float32_t, statistics_fractions_f32);
+JTEST_ARM_PERCENTILE_TEST(q31, q15_t, statistics_fractions_q15);
+JTEST_ARM_PERCENTILE_TEST(q15, q15_t, statistics_fractions_q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(select_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_select_f32_test);
+    JTEST_TEST_CALL(arm_select_q31_test);
+    JTEST_TEST_CALL(arm_select_q15_test);
+    JTEST_TEST_CALL(arm_percentile_f32_test);
+    JTEST_TEST_CALL(arm_percentile_q31_test);
+    JTEST_TEST_CALL(arm_percentile_q15_test);
+    JTEST_TEST_CALL(arm_select_empty_test);
+}
@@ -0,0 +1,223 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+#define SPECTRAL_MAX_BINS 32
+#define SPECTRAL_ROLLOFF_f32 0.85f
+#define SPECTRAL_ROLLOFF_q15 ((q15_t) 0x6CCD)
+
+/* Previous spectrum of the function under test, and an all zero first one for the reference */
+static float32_t spectral_state[SPECTRAL_MAX_BINS];
+static float32_t spectral_zeros[SPECTRAL_MAX_BINS];
+
+/* Two frames of the spectrum converted to Q15 */
+static q15_t spectral_input_q15[2 * SPECTRAL_MAX_BINS];
+
+static arm_spectral_desc_f32 spectral_desc_f32_fut;
+static arm_spectral_desc_f32 spectral_desc_f32_ref;
+static arm_spectral_desc_q15 spectral_desc_q15_fut;
+static arm_spectral_desc_q15 spectral_desc_q15_ref;
+
+/**
+ *  Compare every floating-point descriptor using SNR.
+ */
+#define SPECTRAL_COMPARE_f32()                                          \
+    do                                                                  \
+    {                                                                   \
+        TEST_ASSERT_SNR(&spectral_desc_f32_ref.centroid,                \
+                        &spectral_desc_f32_fut.centroid, 1,             \
+                        STATISTICS_SNR_THRESHOLD_float32_t);            \
+        TEST_ASSERT_SNR(&spectral_desc_f32_ref.rolloff,                 \
+                        &spectral_desc_f32_fut.rolloff, 1,              \
+                        STATISTICS_SNR_THRESHOLD_float32_t);            \
+        TEST_ASSERT_SNR(&spectral_desc_f32_ref.flux,                    \
+                        &spectral_desc_f32_fut.flux, 1,                 \
+                        STATISTICS_SNR_THRESHOLD_float32_t);            \
+        TEST_ASSERT_SNR(&spectral_desc_f32_ref.flatness,                \
+                        &spectral_desc_f32_fut.flatness, 1,             \
+                        STATISTICS_SNR_THRESHOLD_float32_t);            \
+    } while (0)
+
+/**
+ *  Compare the Q15 descriptors exactly, except the flatness which is
+ *  compared using SNR.
+ */
+#define SPECTRAL_COMPARE_q15()                                          \
+    do                                                                  \
+    {                                                                   \
+        TEST_ASSERT_EQUAL(spectral_desc_q15_ref.centroid,               \
+                          spectral_desc_q15_fut.centroid);              \
+        TEST_ASSERT_EQUAL(spectral_desc_q15_ref.rolloff,                \
+                          spectral_desc_q15_fut.rolloff);               \
+        TEST_ASSERT_EQUAL(spectral_desc_q15_ref.flux,                   \
+                          spectral_desc_q15_fut.flux);                  \
+        TEST_CONVERT_AND_ASSERT_SNR(                                    \
+            statistics_output_f32_ref,                                  \
+            &spectral_desc_q15_ref.flatness,                            \
+            statistics_output_f32_fut,                                  \
+            &spectral_desc_q15_fut.flatness,                            \
+            1,                                                          \
+            q15_t,                                                      \
+            STATISTICS_SNR_THRESHOLD_q15_t);                            \
+    } while (0)
+
+/**
+ *  Process two frames of every spectrum, the flux of the first one being
+ *  computed against the all zero spectrum set by the initialization.
+ */
+#define JTEST_ARM_SPECTRAL_FEATURES_TEST(suffix, input, convert)        \
+    JTEST_DEFINE_TEST(arm_spectral_features_##suffix##_test,            \
+                      arm_spectral_features_##suffix)                   \
+    {                                                                   \
+        arm_spectral_features_instance_##suffix spectral_inst_fut;      \
+        TYPE_FROM_ABBREV(suffix) * pSrc;                                \
+        TYPE_FROM_ABBREV(suffix) * pPrev;                               \
+        uint32_t frame;                                                 \
+                                                                        \
+        TEMPLATE_DO_ARR_DESC(                                           \
+            input_idx, ARR_DESC_t *, input_ptr, statistics_spectra      \
+            ,                                                           \
+            TEMPLATE_DO_ARR_DESC(                                       \
+                bins_idx, uint32_t, numBins, statistics_block_sizes     \
+                ,                                                       \
+                JTEST_DUMP_STRF("Number of Bins: %d\n", (int)numBins);  \
+                                                                        \
+                convert;                                                \
+                                                                        \
+                if (arm_spectral_features_init_##suffix(                \
+                        &spectral_inst_fut, numBins,                    \
+                        SPECTRAL_ROLLOFF_##suffix,                      \
+                        (void *) spectral_state) != ARM_MATH_SUCCESS)   \
+                {                                                       \
+                    return JTEST_TEST_FAILED;                           \
+                }                                                       \
+                                                                        \
+                for (frame = 0; frame < 2; frame++)                     \
+                {                                                       \
+                    pSrc = (TYPE_FROM_ABBREV(suffix) *) (input)         \
+                        + frame * numBins;                              \
+                    pPrev = (frame == 0) ?                              \
+                        (TYPE_FROM_ABBREV(suffix) *) spectral_zeros :   \
+                        (TYPE_FROM_ABBREV(suffix) *) (input);           \
+                                                                        \
+                    JTEST_COUNT_CYCLES(                                 \
+                        arm_spectral_features_##suffix(                 \
+                            &spectral_inst_fut, pSrc,                   \
+                            &spectral_desc_##suffix##_fut));            \
+                                                                        \
+                    ref_spectral_features_##suffix(                     \
+                        pSrc, pPrev, numBins,                           \
+                        SPECTRAL_ROLLOFF_##suffix,                      \
+                        &spectral_desc_##suffix##_ref);                 \
+                                                                        \
+                    SPECTRAL_COMPARE_##suffix();                        \
+                }));                                                    \
+                                                                        \
+        return JTEST_TEST_PASSED;                                       \
+    }
+
+JTEST_ARM_SPECTRAL_FEATURES_TEST(f32,
+                                 input_ptr->data_ptr,
+                                 (void) 0);
+JTEST_ARM_SPECTRAL_FEATURES_TEST(q15,
+                                 spectral_input_q15,
+                                 ref_float_to_q15(
+                                     input_ptr->data_ptr,
+                                     spectral_input_q15,
+                                     2 * SPECTRAL_MAX_BINS));
+
+/**
+ *  The Q15 bin indexes are packed in halfwords, so numBins is limited to
+ *  32767.
+ */
+JTEST_DEFINE_TEST(arm_spectral_features_init_q15_test,
+                  arm_spectral_features_init_q15)
+{
+    arm_spectral_features_instance_q15 spectral_inst;
+
+    TEST_ASSERT_EQUAL(
+        arm_spectral_features_init_q15(&spectral_inst, 0,
+                                       SPECTRAL_ROLLOFF_q15,
+                                       (q15_t *) spectral_state),
+        ARM_MATH_ARGUMENT_ERROR);
+    TEST_ASSERT_EQUAL(
+        arm_spectral_features_init_q15(&spectral_inst, 32768U,
+                                       SPECTRAL_ROLLOFF_q15,
+                                       (q15_t *) spectral_state),
+        ARM_MATH_ARGUMENT_ERROR);
+
+    return JTEST_TEST_PASSED;
+}
+
+/**
+ *  A spectrum with a zero bin has a zero flatness in every type, and the
+ *  same spectrum without it is flat.
+ */
+JTEST_DEFINE_TEST(arm_spectral_features_zero_bin_test,
+                  arm_spectral_features_f32)
+{
+    arm_spectral_features_instance_f32 spectral_inst_f32;
+    arm_spectral_features_instance_q15 spectral_inst_q15;
+    float32_t spectrum_f32[8];
+    q15_t spectrum_q15[8];
+    uint32_t zero;
+    uint32_t k;
+
+    for (zero = 0; zero < 2; zero++)
+    {
+        for (k = 0; k < 8; k++)
+        {
+            spectrum_f32[k] = 0.5f;
+            spectrum_q15[k] = 0x4000;
+        }
+        if (zero)
+        {
+            spectrum_f32[3] = 0.0f;
+            spectrum_q15[3] = 0;
+        }
+
+        arm_spectral_features_init_f32(&spectral_inst_f32, 8,
+                                       SPECTRAL_ROLLOFF_f32,
+                                       spectral_state);
+        arm_spectral_features_f32(&spectral_inst_f32, spectrum_f32,
+                                  &spectral_desc_f32_fut);
+        arm_spectral_features_init_q15(&spectral_inst_q15, 8,
+                                       SPECTRAL_ROLLOFF_q15,
+                                       (q15_t *) spectral_state);
+        arm_spectral_features_q15(&spectral_inst_q15, spectrum_q15,
+                                  &spectral_desc_q15_fut);
+
+        if (zero)
+        {
+            TEST_ASSERT_EQUAL(spectral_desc_f32_fut.flatness, 0.0f);
+            TEST_ASSERT_EQUAL(spectral_desc_q15_fut.flatness, 0);
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL(spectral_desc_f32_fut.flatness > 0.99f, 1);
+            TEST_ASSERT_EQUAL(spectral_desc_q15_fut.flatness > 0x7EB8, 1);
+        }
+    }
+
+    return JTEST_TEST_PASSED;
+}
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(spectral_features_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_spectral_features_f32_test);
+    JTEST_TEST_CALL(arm_spectral_features_init_q15_test);
+    JTEST_TEST_CALL(arm_spectral_features_q15_test);
+    JTEST_TEST_CALL(arm_spectral_features_zero_bin_test);
+}
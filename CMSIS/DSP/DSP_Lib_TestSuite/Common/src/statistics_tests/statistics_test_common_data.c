@@ -18,6 +18,9 @@ ARR_DESC_DEFINE(STATISTICS_BIGGEST_INPUT_TYPE,
 uint32_t statistics_idx_fut = 0;
 uint32_t statistics_idx_ref = 0;
 
+float32_t statistics_zcr_fut = 0;
+float32_t statistics_zcr_ref = 0;
+
 STATISTICS_BIGGEST_INPUT_TYPE
 statistics_output_f32_ref[STATISTICS_MAX_INPUT_ELEMENTS];
 
@@ -38,6 +41,17 @@ ARR_DESC_DEFINE(uint32_t,
                 4,
                 CURLY(1, 2, 15, 32));
 
+/* Percentile fractions, including values outside of [0, 1] */
+ARR_DESC_DEFINE(float32_t,
+                statistics_fractions_f32,
+                7,
+                CURLY(-0.5f, 0.0f, 0.25f, 0.5f, 0.9f, 1.0f, 1.5f));
+
+ARR_DESC_DEFINE(q15_t,
+                statistics_fractions_q15,
+                6,
+                CURLY(-0x4000, 0, 0x2000, 0x4000, 0x7333, 0x7FFF));
+
 /*--------------------------------------------------------------------------------*/
 /* Test Data */
 /*--------------------------------------------------------------------------------*/
@@ -92,3 +106,75 @@ ARR_DESC_DEFINE(ARR_DESC_t *,
                     &statistics_f_15,
                     &statistics_f_32
                     ));
+
+/*--------------------------------------------------------------------------------*/
+/* Spectra */
+/*--------------------------------------------------------------------------------*/
+
+/* Every spectrum holds two frames of up to 32 bins */
+ARR_DESC_DEFINE(float32_t,
+                statistics_spectrum_zeros,
+                64,
+                CURLY(0));
+
+ARR_DESC_DEFINE(float32_t,
+                statistics_spectrum_rand,
+                64,
+                CURLY(
+                    0.4798709907318027  , 0.1968918741493967,
+                    0.1458151220194387  , 0.4938884098821724,
+                    0.0708073971182879  , 0.2867895915502311,
+                    0.3356210479871912  , 0.3675771737710438,
+                    0.0889919362248683  , 0.3791290497433401,
+                    0.3013706263858887  , 0.5109690632775753,
+                    0.0189540451585078  , 0.5743912055886964,
+                    0.1052625487586726  , 0.4883864460912046,
+                    0.3053743090379249  , 0.5017448088553161,
+                    0.1113586677777056  , 0.1942463985543724,
+                    0.0541350480280116  , 0.4676740659452357,
+                    0.3213130229924560  , 0.1245758137919590,
+                    0.1166293849124471  , 0.0504074840958806,
+                    0.1216789153139576  , 0.3369423015034847,
+                    0.2637093041688337  , 0.4231480566126814,
+                    0.0476266891487467  , 0.5040131456944338,
+                    0.5892864125447149  , 0.4443397704422332,
+                    0.4463938925167019  , 0.5101470947897723,
+                    0.0587646275831744  , 0.2778205841985518,
+                    0.0494400152436109  , 0.4693778223763709,
+                    0.3237083360254838  , 0.0656729886875332,
+                    0.2679654504432331  , 0.4665513852983575,
+                    0.3321282980677477  , 0.0746450611810777,
+                    0.5622379888502821  , 0.0357234528307325,
+                    0.5061771473550745  , 0.5844636212858190,
+                    0.4511327963944162  , 0.5676283986132148,
+                    0.3195191208436157  , 0.1330572001669756,
+                    0.2844287501035710  , 0.4434133890772541,
+                    0.4615694552116549  , 0.2318281352940938,
+                    0.5684508535782168  , 0.0229879946502675,
+                    0.2984957697109702  , 0.0255954323709785,
+                    0.2161149124992945  , 0.5936016901494404
+                    ));
+
+ARR_DESC_DEFINE(float32_t,
+                statistics_spectrum_sparse,
+                64,
+                CURLY(
+                    0.0000, 0.0000, 0.0000, 0.5000, 0.2500, 0.0000, 0.0000, 0.0000,
+                    0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000,
+                    0.0000, 0.1250, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000,
+                    0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000,
+                    0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000,
+                    0.4000, 0.3000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000,
+                    0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000, 0.0000,
+                    0.0000, 0.0000, 0.0000, 0.0000, 0.0625, 0.0000, 0.0000, 0.0000
+                    ));
+
+/* Aggregate all spectra */
+ARR_DESC_DEFINE(ARR_DESC_t *,
+                statistics_spectra,
+                3,
+                CURLY(
+                    &statistics_spectrum_zeros,
+                    &statistics_spectrum_rand,
+                    &statistics_spectrum_sparse
+                    ));
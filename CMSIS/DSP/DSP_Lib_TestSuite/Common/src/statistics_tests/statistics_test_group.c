@@ -8,7 +8,10 @@ JTEST_DEFINE_GROUP(statistics_tests)
     JTEST_GROUP_CALL(min_tests);
     JTEST_GROUP_CALL(power_tests);
     JTEST_GROUP_CALL(rms_tests);
+    JTEST_GROUP_CALL(select_tests);
+    JTEST_GROUP_CALL(spectral_features_tests);
     JTEST_GROUP_CALL(std_tests);
     JTEST_GROUP_CALL(var_tests);
+    JTEST_GROUP_CALL(zcr_energy_tests);
     return;
 }
@@ -0,0 +1,58 @@
+#include "jtest.h"
+#include "statistics_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "statistics_templates.h"
+#include "type_abbrev.h"
+
+/**
+ *  Compare the energies using SNR and the zero-crossing rates exactly.
+ */
+#define ZCR_ENERGY_COMPARE_INTERFACE(block_size,                \
+                                     output_type)               \
+    do                                                          \
+    {                                                           \
+        STATISTICS_SNR_COMPARE_INTERFACE(block_size,            \
+                                         output_type);          \
+        TEST_ASSERT_BUFFERS_EQUAL(                              \
+            &statistics_zcr_ref,                                \
+            &statistics_zcr_fut,                                \
+            sizeof(statistics_zcr_fut));                        \
+    } while (0)
+
+#define JTEST_ARM_ZCR_ENERGY_TEST(suffix)                       \
+    JTEST_DEFINE_TEST(arm_zcr_energy_##suffix##_test,           \
+                      arm_zcr_energy_##suffix)                  \
+    {                                                           \
+        statistics_zcr_fut = 0;                                 \
+        statistics_zcr_ref = 0;                                 \
+                                                                \
+        TEST_TEMPLATE_BUF1_BLK(                                 \
+            statistics_f_all,                                   \
+            statistics_block_sizes,                             \
+            TYPE_FROM_ABBREV(suffix),                           \
+            TYPE_FROM_ABBREV(suffix),                           \
+            arm_zcr_energy_##suffix,                            \
+            ARM_zcr_energy_INPUT_INTERFACE,                     \
+            ref_zcr_energy_##suffix,                            \
+            REF_zcr_energy_INPUT_INTERFACE,                     \
+            ZCR_ENERGY_COMPARE_INTERFACE);                      \
+    }
+
+JTEST_ARM_ZCR_ENERGY_TEST(f32);
+JTEST_ARM_ZCR_ENERGY_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(zcr_energy_tests)
+{
+    /*
+      To skip a test, comment it out.
+    */
+    JTEST_TEST_CALL(arm_zcr_energy_f32_test);
+    JTEST_TEST_CALL(arm_zcr_energy_q15_test);
+}
@@ -0,0 +1,49 @@
+#include "jtest.h"
+#include "support_test_data.h"
+#include "arr_desc.h"
+#include "arm_math.h"           /* FUTs */
+#include "ref.h"                /* Reference Functions */
+#include "test_templates.h"
+#include "support_templates.h"
+#include "type_abbrev.h"
+
+/* Scratch buffer of the merge passes, as long as the largest input. */
+static float32_t support_sort_buffer[32];
+
+#define JTEST_ARM_SORT_TEST(suffix)                                     \
+    JTEST_DEFINE_TEST(arm_sort_##suffix##_test,                         \
+                      arm_sort_##suffix)                                \
+    {                                                                   \
+        arm_sort_instance_##suffix sort_inst;                           \
+                                                                        \
+        arm_sort_init_##suffix(                                         \
+            &sort_inst,                                                 \
+            ARM_SORT_ASCENDING,                                         \
+            (TYPE_FROM_ABBREV(suffix) *) support_sort_buffer);          \
+                                                                        \
+        TEST_TEMPLATE_BUF1_BLK(                                         \
+            support_f_all,                                              \
+            support_block_sizes,                                        \
+            TYPE_FROM_ABBREV(suffix),                                   \
+            TYPE_FROM_ABBREV(suffix),                                   \
+            arm_sort_##suffix,                                          \
+            ARM_sort_INPUT_INTERFACE,                                   \
+            ref_sort_##suffix,                                          \
+            REF_sort_INPUT_INTERFACE,                                   \
+            SUPPORT_COMPARE_INTERFACE);                                 \
+    }
+
+JTEST_ARM_SORT_TEST(f32);
+JTEST_ARM_SORT_TEST(q31);
+JTEST_ARM_SORT_TEST(q15);
+
+/*--------------------------------------------------------------------------------*/
+/* Collect all tests in a group. */
+/*--------------------------------------------------------------------------------*/
+
+JTEST_DEFINE_GROUP(sort_tests)
+{
+    JTEST_TEST_CALL(arm_sort_f32_test);
+    JTEST_TEST_CALL(arm_sort_q31_test);
+    JTEST_TEST_CALL(arm_sort_q15_test);
+}
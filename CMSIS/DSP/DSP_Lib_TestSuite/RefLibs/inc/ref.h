@@ -929,6 +929,76 @@ void ref_fir_interpolate_q15(
   q15_t * pDst,
   uint32_t blockSize);
 
+void ref_median_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  uint16_t winSize);
+
+void ref_median_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize,
+  uint16_t winSize);
+
+void ref_median_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint16_t winSize);
+
+	/*
+	 * Interpolation Functions
+	 */
+void ref_linear_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_linear_interp_block_q15(
+  q15_t * pYData,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t nValues,
+  uint32_t blockSize);
+
+void ref_cubic_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_resize_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode);
+
+void ref_resize_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode);
+
+void ref_resize_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode);
+
 	/*
 	 * Matrix Functions
 	 */
@@ -976,6 +1046,31 @@ arm_status ref_mat_mult_q15(
 /* Alias for testing purposes*/
 #define ref_mat_mult_fast_q15 ref_mat_mult_q15
 
+arm_status ref_mat_mult_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst);
+
+void ref_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  float32_t * pVec,
+  float32_t * pDst);
+
+void ref_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  q31_t * pVec,
+  q31_t * pDst);
+
+void ref_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst);
+
+void ref_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  q7_t * pVec,
+  q7_t * pDst);
+
 arm_status ref_mat_scale_f32(
   const arm_matrix_instance_f32 * pSrc,
   float32_t scale,
@@ -1024,6 +1119,10 @@ arm_status ref_mat_trans_q15(
   const arm_matrix_instance_q15 * pSrc,
   arm_matrix_instance_q15 * pDst);
 
+arm_status ref_mat_trans_q7(
+  const arm_matrix_instance_q7 * pSrc,
+  arm_matrix_instance_q7 * pDst);
+
 arm_status ref_mat_add_f32(
   const arm_matrix_instance_f32 * pSrcA,
   const arm_matrix_instance_f32 * pSrcB,
@@ -1039,6 +1138,11 @@ arm_status ref_mat_add_q15(
   const arm_matrix_instance_q15 * pSrcB,
   arm_matrix_instance_q15 * pDst);
 
+arm_status ref_mat_add_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst);
+
 	/*
 	 * Statistics Functions
 	 */
@@ -1130,6 +1234,68 @@ void ref_power_q7(
   uint32_t blockSize,
   q31_t * pResult);
 
+void ref_zcr_energy_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pZcr,
+  float32_t * pEnergy);
+
+void ref_zcr_energy_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pZcr,
+  q63_t * pEnergy);
+
+void ref_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult);
+
+void ref_select_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pResult);
+
+void ref_select_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pResult);
+
+void ref_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t fraction,
+  float32_t * pResult);
+
+void ref_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q15_t fraction,
+  q31_t * pResult);
+
+void ref_percentile_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t fraction,
+  q15_t * pResult);
+
+void ref_spectral_features_f32(
+  float32_t * pSrc,
+  float32_t * pPrev,
+  uint32_t numBins,
+  float32_t rolloffRatio,
+  arm_spectral_desc_f32 * pDesc);
+
+void ref_spectral_features_q15(
+  q15_t * pSrc,
+  q15_t * pPrev,
+  uint32_t numBins,
+  q15_t rolloffRatio,
+  arm_spectral_desc_q15 * pDesc);
+
 void ref_rms_f32(
   float32_t * pSrc,
   uint32_t blockSize,
@@ -1281,6 +1447,21 @@ void ref_float_to_q15(
 void ref_float_to_q7(
   float32_t * pSrc,
   q7_t * pDst,
+  uint32_t blockSize);
+
+void ref_sort_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+void ref_sort_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+void ref_sort_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
   uint32_t blockSize);
 
 	/*
@@ -0,0 +1,111 @@
+#include "ref.h"
+
+#define REF_MEDIAN_MAX_WINSIZE 64
+
+void ref_median_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize,
+  uint16_t winSize)
+{
+	uint32_t n, i, j, count;
+	float32_t win[REF_MEDIAN_MAX_WINSIZE];
+	float32_t in;
+	
+	for(n=0;n<blockSize;n++)
+	{
+		/* The window grows until winSize samples have been received */
+		count = (n + 1 < winSize) ? (n + 1) : winSize;
+		
+		for(i=0;i<count;i++)
+		{
+			in = pSrc[n + 1 - count + i];
+			for(j=i;(j>0) && (in<win[j-1]);j--)
+			{
+				win[j] = win[j-1];
+			}
+			win[j] = in;
+		}
+		
+		if(count & 1)
+		{
+			pDst[n] = win[count/2];
+		}
+		else
+		{
+			pDst[n] = 0.5f * (win[count/2 - 1] + win[count/2]);
+		}
+	}
+}
+
+void ref_median_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize,
+  uint16_t winSize)
+{
+	uint32_t n, i, j, count;
+	q31_t win[REF_MEDIAN_MAX_WINSIZE];
+	q31_t in;
+	
+	for(n=0;n<blockSize;n++)
+	{
+		/* The window grows until winSize samples have been received */
+		count = (n + 1 < winSize) ? (n + 1) : winSize;
+		
+		for(i=0;i<count;i++)
+		{
+			in = pSrc[n + 1 - count + i];
+			for(j=i;(j>0) && (in<win[j-1]);j--)
+			{
+				win[j] = win[j-1];
+			}
+			win[j] = in;
+		}
+		
+		if(count & 1)
+		{
+			pDst[n] = win[count/2];
+		}
+		else
+		{
+			pDst[n] = (q31_t)(((q63_t)win[count/2 - 1] + win[count/2]) >> 1);
+		}
+	}
+}
+
+void ref_median_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize,
+  uint16_t winSize)
+{
+	uint32_t n, i, j, count;
+	q15_t win[REF_MEDIAN_MAX_WINSIZE];
+	q15_t in;
+	
+	for(n=0;n<blockSize;n++)
+	{
+		/* The window grows until winSize samples have been received */
+		count = (n + 1 < winSize) ? (n + 1) : winSize;
+		
+		for(i=0;i<count;i++)
+		{
+			in = pSrc[n + 1 - count + i];
+			for(j=i;(j>0) && (in<win[j-1]);j--)
+			{
+				win[j] = win[j-1];
+			}
+			win[j] = in;
+		}
+		
+		if(count & 1)
+		{
+			pDst[n] = win[count/2];
+		}
+		else
+		{
+			pDst[n] = (q15_t)(((q31_t)win[count/2 - 1] + win[count/2]) >> 1);
+		}
+	}
+}
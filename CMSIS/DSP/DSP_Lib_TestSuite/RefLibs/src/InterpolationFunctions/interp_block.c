@@ -0,0 +1,101 @@
+#include "ref.h"
+
+void ref_linear_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t n;
+	int32_t i;
+	float64_t t;
+	
+	for(n=0;n<blockSize;n++)
+	{
+		t = ((float64_t)pSrc[n] - S->x1) / S->xSpacing;
+		if(t < 0)
+		{
+			pDst[n] = S->pYData[0];
+		}
+		else if(t >= S->nValues - 1)
+		{
+			pDst[n] = S->pYData[S->nValues - 1];
+		}
+		else
+		{
+			i = (int32_t)t;
+			t -= i;
+			pDst[n] = (float32_t)((1.0 - t) * S->pYData[i] + t * S->pYData[i+1]);
+		}
+	}
+}
+
+void ref_linear_interp_block_q15(
+  q15_t * pYData,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t nValues,
+  uint32_t blockSize)
+{
+	uint32_t n;
+	int32_t i;
+	q31_t fract;
+	
+	for(n=0;n<blockSize;n++)
+	{
+		/* 12.20 format */
+		i = pSrc[n] >> 20;
+		fract = pSrc[n] & 0xFFFFF;
+		if(i < 0)
+		{
+			pDst[n] = pYData[0];
+		}
+		else if(i >= (int32_t)nValues - 1)
+		{
+			pDst[n] = pYData[nValues - 1];
+		}
+		else
+		{
+			pDst[n] = (q15_t)(pYData[i] + (((q63_t)(pYData[i+1] - pYData[i]) * fract) >> 20));
+		}
+	}
+}
+
+void ref_cubic_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t n;
+	int32_t i, last = S->nValues - 1;
+	float64_t t, ym1, y0, y1, y2;
+	
+	for(n=0;n<blockSize;n++)
+	{
+		t = ((float64_t)pSrc[n] - S->x1) / S->xSpacing;
+		if(t < 0)
+		{
+			pDst[n] = S->pYData[0];
+		}
+		else if(t >= last)
+		{
+			pDst[n] = S->pYData[last];
+		}
+		else
+		{
+			i = (int32_t)t;
+			t -= i;
+			y0 = S->pYData[i];
+			y1 = S->pYData[i+1];
+			/* The ends of the table are repeated */
+			ym1 = (i > 0) ? S->pYData[i-1] : y0;
+			y2 = (i + 2 <= last) ? S->pYData[i+2] : y1;
+			/* Catmull-Rom weights */
+			pDst[n] = (float32_t)(ym1 * ((-0.5 * t + 1.0) * t - 0.5) * t
+			                    + y0 * ((1.5 * t - 2.5) * t * t + 1.0)
+			                    + y1 * ((-1.5 * t + 2.0) * t + 0.5) * t
+			                    + y2 * (0.5 * t - 0.5) * t * t);
+		}
+	}
+}
@@ -0,0 +1,162 @@
+#include "ref.h"
+
+/*
+ * Source samples and weights of the output sample d along one direction.
+ * The centers of the output samples are mapped on the source grid and the
+ * edge samples are repeated.
+ */
+static void ref_resize_taps(
+  uint32_t d,
+  uint16_t srcSize,
+  uint16_t dstSize,
+  uint16_t numTaps,
+  int32_t * pIdx,
+  float64_t * pW)
+{
+	float64_t pos, t;
+	int32_t i0, k;
+	
+	pos = (d + 0.5) * srcSize / dstSize - 0.5;
+	i0 = (int32_t)floor(pos);
+	t = pos - i0;
+	
+	if(numTaps == 2)
+	{
+		pW[0] = 1.0 - t;
+		pW[1] = t;
+	}
+	else
+	{
+		i0 -= 1;
+		pW[0] = ((-0.5 * t + 1.0) * t - 0.5) * t;
+		pW[1] = (1.5 * t - 2.5) * t * t + 1.0;
+		pW[2] = ((-1.5 * t + 2.0) * t + 0.5) * t;
+		pW[3] = (0.5 * t - 0.5) * t * t;
+	}
+	
+	for(k=0;k<numTaps;k++)
+	{
+		pIdx[k] = i0 + k;
+		if(pIdx[k] < 0) pIdx[k] = 0;
+		if(pIdx[k] >= srcSize) pIdx[k] = srcSize - 1;
+	}
+}
+
+/*
+ * Channel c of the output pixel (r, col), computed from a copy of the source
+ * in double precision.
+ */
+static float64_t ref_resize_sample(
+  const float64_t * pSrc,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  uint16_t numTaps,
+  uint32_t r,
+  uint32_t col,
+  uint32_t c)
+{
+	int32_t ri[4], ci[4];
+	float64_t rw[4], cw[4], sum = 0;
+	uint32_t k, u;
+	
+	ref_resize_taps(r, srcRows, dstRows, numTaps, ri, rw);
+	ref_resize_taps(col, srcCols, dstCols, numTaps, ci, cw);
+	
+	for(k=0;k<numTaps;k++)
+	{
+		for(u=0;u<numTaps;u++)
+		{
+			sum += rw[k] * cw[u] * pSrc[((uint32_t)ri[k] * srcCols + ci[u]) * numChannels + c];
+		}
+	}
+	return sum;
+}
+
+#define REF_RESIZE_MAX_SAMPLES 1024
+
+void ref_resize_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode)
+{
+	static float64_t src[REF_RESIZE_MAX_SAMPLES];
+	uint16_t numTaps = (mode == ARM_RESIZE_CUBIC) ? 4 : 2;
+	uint32_t i, r, col, c;
+	
+	for(i=0;i<(uint32_t)srcRows * srcCols * numChannels;i++)
+	{
+		src[i] = pSrc[i];
+	}
+	
+	for(r=0;r<dstRows;r++)
+		for(col=0;col<dstCols;col++)
+			for(c=0;c<numChannels;c++)
+			{
+				*pDst++ = (float32_t)ref_resize_sample(src, srcRows, srcCols, dstRows, dstCols,
+				                                       numChannels, numTaps, r, col, c);
+			}
+}
+
+void ref_resize_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode)
+{
+	static float64_t src[REF_RESIZE_MAX_SAMPLES];
+	uint16_t numTaps = (mode == ARM_RESIZE_CUBIC) ? 4 : 2;
+	uint32_t i, r, col, c;
+	
+	for(i=0;i<(uint32_t)srcRows * srcCols * numChannels;i++)
+	{
+		src[i] = pSrc[i];
+	}
+	
+	for(r=0;r<dstRows;r++)
+		for(col=0;col<dstCols;col++)
+			for(c=0;c<numChannels;c++)
+			{
+				*pDst++ = ref_sat_q15((q31_t)floor(ref_resize_sample(src, srcRows, srcCols, dstRows, dstCols,
+				                                                     numChannels, numTaps, r, col, c) + 0.5));
+			}
+}
+
+void ref_resize_q7(
+  q7_t * pSrc,
+  q7_t * pDst,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode)
+{
+	static float64_t src[REF_RESIZE_MAX_SAMPLES];
+	uint16_t numTaps = (mode == ARM_RESIZE_CUBIC) ? 4 : 2;
+	uint32_t i, r, col, c;
+	
+	for(i=0;i<(uint32_t)srcRows * srcCols * numChannels;i++)
+	{
+		src[i] = pSrc[i];
+	}
+	
+	for(r=0;r<dstRows;r++)
+		for(col=0;col<dstCols;col++)
+			for(c=0;c<numChannels;c++)
+			{
+				*pDst++ = ref_sat_q7((q15_t)floor(ref_resize_sample(src, srcRows, srcCols, dstRows, dstCols,
+				                                                    numChannels, numTaps, r, col, c) + 0.5));
+			}
+}
@@ -56,3 +56,22 @@ arm_status ref_mat_add_q15(
 	
 	return ARM_MATH_SUCCESS;
 }
+
+arm_status ref_mat_add_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst)
+{
+	uint32_t i;
+  uint32_t numSamples;                           /* total number of elements in the matrix  */
+
+	/* Total number of samples in the input matrix */
+	numSamples = (uint32_t) pSrcA->numRows * pSrcA->numCols;
+	
+	for(i=0;i<numSamples;i++)
+	{
+		pDst->pData[i] = ref_sat_q7( (q15_t)pSrcA->pData[i] + pSrcB->pData[i]);
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -89,3 +89,33 @@ arm_status ref_mat_mult_q15(
 	
 	return ARM_MATH_SUCCESS;
 }
+
+arm_status ref_mat_mult_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst)
+{
+	uint32_t r,c,i,outR,outC,innerSize;
+	q31_t sum;
+	
+	outR = pSrcA->numRows;
+	outC = pSrcB->numCols;
+	innerSize = pSrcA->numCols;
+	
+	for(r=0;r<outR;r++)
+	{
+		for(c=0;c<outC;c++)
+		{
+			sum = 0;
+			
+			for(i=0;i<innerSize;i++)
+			{
+				sum += (q15_t)(pSrcA->pData[r*innerSize + i]) * pSrcB->pData[i*outC + c];
+			}
+			
+			pDst->pData[r*outC + c] = ref_sat_q7(ref_sat_q15(sum >> 7));
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
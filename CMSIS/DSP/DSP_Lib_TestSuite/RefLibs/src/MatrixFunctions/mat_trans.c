@@ -75,3 +75,22 @@ arm_status ref_mat_trans_q15(
 	
 	return ARM_MATH_SUCCESS;
 }
+
+arm_status ref_mat_trans_q7(
+  const arm_matrix_instance_q7 * pSrc,
+  arm_matrix_instance_q7 * pDst)
+{
+	uint32_t r,c;
+	uint32_t numR = pSrc->numRows;
+	uint32_t numC = pSrc->numCols;
+	
+	for(r=0;r<numR;r++)
+	{
+		for(c=0;c<numC;c++)
+		{
+			pDst->pData[c*numR + r] = pSrc->pData[r*numC + c];
+		}
+	}
+	
+	return ARM_MATH_SUCCESS;
+}
@@ -0,0 +1,85 @@
+#include "ref.h"
+
+void ref_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  float32_t * pVec,
+  float32_t * pDst)
+{
+	uint32_t r,c;
+	float32_t sum;
+	
+	for(r=0;r<pSrcMat->numRows;r++)
+	{
+		sum = 0;
+		
+		for(c=0;c<pSrcMat->numCols;c++)
+		{
+			sum += pSrcMat->pData[r*pSrcMat->numCols + c] * pVec[c];
+		}
+		
+		pDst[r] = sum;
+	}
+}
+
+void ref_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  q31_t * pVec,
+  q31_t * pDst)
+{
+	uint32_t r,c;
+	q63_t sum;
+	
+	for(r=0;r<pSrcMat->numRows;r++)
+	{
+		sum = 0;
+		
+		for(c=0;c<pSrcMat->numCols;c++)
+		{
+			sum += (q63_t)(pSrcMat->pData[r*pSrcMat->numCols + c]) * pVec[c];
+		}
+		
+		pDst[r] = ref_sat_q31(sum >> 31);
+	}
+}
+
+void ref_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst)
+{
+	uint32_t r,c;
+	q63_t sum;
+	
+	for(r=0;r<pSrcMat->numRows;r++)
+	{
+		sum = 0;
+		
+		for(c=0;c<pSrcMat->numCols;c++)
+		{
+			sum += (q31_t)(pSrcMat->pData[r*pSrcMat->numCols + c]) * pVec[c];
+		}
+		
+		pDst[r] = ref_sat_q15(sum >> 15);
+	}
+}
+
+void ref_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  q7_t * pVec,
+  q7_t * pDst)
+{
+	uint32_t r,c;
+	q31_t sum;
+	
+	for(r=0;r<pSrcMat->numRows;r++)
+	{
+		sum = 0;
+		
+		for(c=0;c<pSrcMat->numCols;c++)
+		{
+			sum += (q15_t)(pSrcMat->pData[r*pSrcMat->numCols + c]) * pVec[c];
+		}
+		
+		pDst[r] = ref_sat_q7(ref_sat_q15(sum >> 7));
+	}
+}
@@ -0,0 +1,113 @@
+#include "ref.h"
+
+#define REF_SELECT_MAX_BLOCKSIZE 64
+
+void ref_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult)
+{
+	float32_t sorted[REF_SELECT_MAX_BLOCKSIZE];
+	
+	ref_sort_f32(pSrc, sorted, blockSize);
+	*pResult = sorted[k];
+}
+
+void ref_select_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pResult)
+{
+	q31_t sorted[REF_SELECT_MAX_BLOCKSIZE];
+	
+	ref_sort_q31(pSrc, sorted, blockSize);
+	*pResult = sorted[k];
+}
+
+void ref_select_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pResult)
+{
+	q15_t sorted[REF_SELECT_MAX_BLOCKSIZE];
+	
+	ref_sort_q15(pSrc, sorted, blockSize);
+	*pResult = sorted[k];
+}
+
+void ref_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t fraction,
+  float32_t * pResult)
+{
+	float32_t sorted[REF_SELECT_MAX_BLOCKSIZE];
+	float32_t pos, out;
+	uint32_t k;
+	
+	ref_sort_f32(pSrc, sorted, blockSize);
+	
+	if(fraction < 0.0f) fraction = 0.0f;
+	if(fraction > 1.0f) fraction = 1.0f;
+	
+	/* Linear interpolation between the two closest ranks */
+	pos = fraction * (blockSize - 1);
+	k = (uint32_t)pos;
+	pos -= k;
+	
+	out = sorted[k];
+	if(pos > 0.0f && k + 1 < blockSize)
+	{
+		out += pos * (sorted[k+1] - out);
+	}
+	*pResult = out;
+}
+
+void ref_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q15_t fraction,
+  q31_t * pResult)
+{
+	q31_t sorted[REF_SELECT_MAX_BLOCKSIZE];
+	q31_t out;
+	uint32_t k, pos;
+	
+	ref_sort_q31(pSrc, sorted, blockSize);
+	
+	/* Linear interpolation between the two closest ranks, rounded to the nearest LSB */
+	pos = (fraction > 0) ? (uint32_t)fraction * (blockSize - 1) : 0;
+	k = pos >> 15;
+	out = sorted[k];
+	if((pos & 0x7FFF) != 0 && k + 1 < blockSize)
+	{
+		out += (q31_t)((((q63_t)sorted[k+1] - out) * (pos & 0x7FFF) + 0x4000) >> 15);
+	}
+	*pResult = out;
+}
+
+void ref_percentile_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t fraction,
+  q15_t * pResult)
+{
+	q15_t sorted[REF_SELECT_MAX_BLOCKSIZE];
+	q15_t out;
+	uint32_t k, pos;
+	
+	ref_sort_q15(pSrc, sorted, blockSize);
+	
+	/* Linear interpolation between the two closest ranks, rounded to the nearest LSB */
+	pos = (fraction > 0) ? (uint32_t)fraction * (blockSize - 1) : 0;
+	k = pos >> 15;
+	out = sorted[k];
+	if((pos & 0x7FFF) != 0 && k + 1 < blockSize)
+	{
+		out += (q15_t)((((q31_t)sorted[k+1] - out) * (pos & 0x7FFF) + 0x4000) >> 15);
+	}
+	*pResult = out;
+}
@@ -0,0 +1,109 @@
+#include "ref.h"
+
+void ref_spectral_features_f32(
+  float32_t * pSrc,
+  float32_t * pPrev,
+  uint32_t numBins,
+  float32_t rolloffRatio,
+  arm_spectral_desc_f32 * pDesc)
+{
+	uint32_t k;
+	float32_t sum=0, wsum=0, flux=0, cum=0, diff;
+	float64_t logsum=0;
+	int isZero=0;
+	
+	for(k=0;k<numBins;k++)
+	{
+		sum += pSrc[k];
+		wsum += k * pSrc[k];
+		diff = pSrc[k] - pPrev[k];
+		flux += diff * diff;
+		if(pSrc[k] < 1.17549435e-38f)
+		{
+			isZero = 1;
+		}
+		else
+		{
+			logsum += log(pSrc[k]);
+		}
+	}
+	pDesc->flux = flux;
+	
+	if(sum <= 0)
+	{
+		pDesc->centroid = 0;
+		pDesc->rolloff = 0;
+		pDesc->flatness = 0;
+		return;
+	}
+	
+	pDesc->centroid = wsum / (sum * numBins);
+	
+	for(k=0;k<numBins-1;k++)
+	{
+		cum += pSrc[k];
+		if(cum >= rolloffRatio * sum)
+		{
+			break;
+		}
+	}
+	pDesc->rolloff = (float32_t)k / numBins;
+	
+	pDesc->flatness = isZero ? 0 : (float32_t)(exp(logsum / numBins) / (sum / numBins));
+}
+
+void ref_spectral_features_q15(
+  q15_t * pSrc,
+  q15_t * pPrev,
+  uint32_t numBins,
+  q15_t rolloffRatio,
+  arm_spectral_desc_q15 * pDesc)
+{
+	uint32_t k;
+	q31_t sum=0, cum=0, thr, diff;
+	q63_t wsum=0, flux=0;
+	float64_t logsum=0, flatness;
+	int isZero=0;
+	
+	for(k=0;k<numBins;k++)
+	{
+		sum += pSrc[k];
+		wsum += (q63_t)k * pSrc[k];
+		diff = pSrc[k] - pPrev[k];
+		flux += (q63_t)diff * diff;
+		if(pSrc[k] <= 0)
+		{
+			isZero = 1;
+		}
+		else
+		{
+			logsum += log(pSrc[k]);
+		}
+	}
+	pDesc->flux = flux;
+	
+	if(sum <= 0)
+	{
+		pDesc->centroid = 0;
+		pDesc->rolloff = 0;
+		pDesc->flatness = 0;
+		return;
+	}
+	
+	pDesc->centroid = (q15_t)((wsum << 15) / ((q63_t)sum * numBins));
+	
+	thr = (q31_t)(((q63_t)sum * rolloffRatio) >> 15);
+	for(k=0;k<numBins-1;k++)
+	{
+		cum += pSrc[k];
+		if(cum >= thr)
+		{
+			break;
+		}
+	}
+	pDesc->rolloff = (q15_t)((k << 15) / numBins);
+	
+	/* A zero bin makes the geometric mean zero */
+	flatness = isZero ? 0 : floor(exp(logsum / numBins) / ((float64_t)sum / numBins) * 32768.0 + 0.5);
+	pDesc->flatness = (flatness > 0x7FFF) ? 0x7FFF : (q15_t)flatness;
+}
@@ -0,0 +1,43 @@
+#include "ref.h"
+
+void ref_zcr_energy_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pZcr,
+  float32_t * pEnergy)
+{
+	uint32_t i, count=0;
+	float32_t sumsq=0;
+	
+	for(i=0;i<blockSize;i++)
+	{
+			sumsq += pSrc[i] * pSrc[i];
+			if(i > 0 && ((pSrc[i] < 0) != (pSrc[i-1] < 0)))
+			{
+				count++;
+			}
+	}
+	*pZcr = (blockSize > 1) ? (float32_t)count / (blockSize - 1) : 0;
+	*pEnergy = sumsq;
+}
+
+void ref_zcr_energy_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pZcr,
+  q63_t * pEnergy)
+{
+	uint32_t i, count=0;
+	q63_t sumsq=0;
+	
+	for(i=0;i<blockSize;i++)
+	{
+			sumsq += ((q63_t)pSrc[i] * pSrc[i]);
+			if(i > 0 && ((pSrc[i] < 0) != (pSrc[i-1] < 0)))
+			{
+				count++;
+			}
+	}
+	*pZcr = (blockSize > 1) ? ref_sat_q15((q31_t)(((q63_t)count << 15) / (blockSize - 1))) : 0;
+	*pEnergy = sumsq;
+}
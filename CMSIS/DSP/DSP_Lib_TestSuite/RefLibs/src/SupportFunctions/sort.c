@@ -0,0 +1,58 @@
+#include "ref.h"
+
+void ref_sort_f32(
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i, j;
+	float32_t in;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		in = pSrc[i];
+		for(j=i;(j>0) && (in<pDst[j-1]);j--)
+		{
+			pDst[j] = pDst[j-1];
+		}
+		pDst[j] = in;
+	}
+}
+
+void ref_sort_q31(
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i, j;
+	q31_t in;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		in = pSrc[i];
+		for(j=i;(j>0) && (in<pDst[j-1]);j--)
+		{
+			pDst[j] = pDst[j-1];
+		}
+		pDst[j] = in;
+	}
+}
+
+void ref_sort_q15(
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+	uint32_t i, j;
+	q15_t in;
+	
+	for(i=0;i<blockSize;i++)
+	{
+		in = pSrc[i];
+		for(j=i;(j>0) && (in<pDst[j-1]);j--)
+		{
+			pDst[j] = pDst[j-1];
+		}
+		pDst[j] = in;
+	}
+}
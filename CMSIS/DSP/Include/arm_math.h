@@ -206,7 +206,7 @@
  *       float32_t *pData;     // points to the data of the matrix.
  *     } arm_matrix_instance_f32;
  * </pre>
- * There are similar definitions for Q15 and Q31 data types.
+ * There are similar definitions for Q31, Q15 and Q7 data types.
  *
  * The structure specifies the size of the matrix and then points to
  * an array of data.  The array is of size <code>numRows X numCols</code>
@@ -220,8 +220,9 @@
  * There is an associated initialization function for each type of matrix
  * data structure.
  * The initialization function sets the values of the internal structure fields.
- * Refer to the function <code>arm_mat_init_f32()</code>, <code>arm_mat_init_q31()</code>
- * and <code>arm_mat_init_q15()</code> for floating-point, Q31 and Q15 types,  respectively.
+ * Refer to the function <code>arm_mat_init_f32()</code>, <code>arm_mat_init_q31()</code>,
+ * <code>arm_mat_init_q15()</code> and <code>arm_mat_init_q7()</code> for floating-point,
+ * Q31, Q15 and Q7 types,  respectively.
  *
  * \par
  * Use of the initialization function is optional. However, if initialization function is used
@@ -232,6 +233,7 @@
  * <code>arm_matrix_instance_f32 S = {nRows, nColumns, pData};</code>
  * <code>arm_matrix_instance_q31 S = {nRows, nColumns, pData};</code>
  * <code>arm_matrix_instance_q15 S = {nRows, nColumns, pData};</code>
+ * <code>arm_matrix_instance_q7 S = {nRows, nColumns, pData};</code>
  * </pre>
  * where <code>nRows</code> specifies the number of rows, <code>nColumns</code>
  * specifies the number of columns, and <code>pData</code> points to the
@@ -279,8 +281,9 @@
 /**
  * @defgroup groupInterpolation Interpolation Functions
  * These functions perform 1- and 2-dimensional interpolation of data.
- * Linear interpolation is used for 1-dimensional data and
+ * Linear and cubic interpolation are used for 1-dimensional data and
  * bilinear interpolation is used for 2-dimensional data.
+ * Images sampled on a uniform grid are resized with bilinear or cubic interpolation.
  */
 
 /**
@@ -1385,6 +1388,16 @@ extern "C"
     q31_t *pData;         /**< points to the data of the matrix. */
   } arm_matrix_instance_q31;
 
+  /**
+   * @brief Instance structure for the Q7 matrix structure.
+   */
+  typedef struct
+  {
+    uint16_t numRows;     /**< number of rows of the matrix.     */
+    uint16_t numCols;     /**< number of columns of the matrix.  */
+    q7_t *pData;          /**< points to the data of the matrix. */
+  } arm_matrix_instance_q7;
+
 
   /**
    * @brief Floating-point matrix addition.
@@ -1428,6 +1441,20 @@ extern "C"
   arm_matrix_instance_q31 * pDst);
 
 
+  /**
+   * @brief Q7 matrix addition.
+   * @param[in]  pSrcA  points to the first input matrix structure
+   * @param[in]  pSrcB  points to the second input matrix structure
+   * @param[out] pDst   points to output matrix structure
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_add_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst);
+
+
   /**
    * @brief Floating-point, complex, matrix multiplication.
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -1507,6 +1534,18 @@ extern "C"
   arm_matrix_instance_q31 * pDst);
 
 
+  /**
+   * @brief Q7 matrix transpose.
+   * @param[in]  pSrc  points to the input matrix
+   * @param[out] pDst  points to the output matrix
+   * @return    The function returns either  <code>ARM_MATH_SIZE_MISMATCH</code>
+   * or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_trans_q7(
+  const arm_matrix_instance_q7 * pSrc,
+  arm_matrix_instance_q7 * pDst);
+
+
   /**
    * @brief Floating-point matrix multiplication
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -1581,6 +1620,70 @@ extern "C"
   arm_matrix_instance_q31 * pDst);
 
 
+  /**
+   * @brief Q7 matrix multiplication
+   * @param[in]  pSrcA   points to the first input matrix structure
+   * @param[in]  pSrcB   points to the second input matrix structure
+   * @param[out] pDst    points to output matrix structure
+   * @param[in]  pState  points to the array for storing the transpose of pSrcB
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   */
+  arm_status arm_mat_mult_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst,
+  q7_t * pState);
+
+
+  /**
+   * @brief Floating-point matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector of numCols samples
+   * @param[out] pDst     points to the output vector of numRows samples
+   */
+  void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  float32_t * pVec,
+  float32_t * pDst);
+
+
+  /**
+   * @brief Q31 matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector of numCols samples
+   * @param[out] pDst     points to the output vector of numRows samples
+   */
+  void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  q31_t * pVec,
+  q31_t * pDst);
+
+
+  /**
+   * @brief Q15 matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector of numCols samples
+   * @param[out] pDst     points to the output vector of numRows samples
+   */
+  void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst);
+
+
+  /**
+   * @brief Q7 matrix and vector multiplication.
+   * @param[in]  pSrcMat  points to the input matrix structure
+   * @param[in]  pVec     points to the input vector of numCols samples
+   * @param[out] pDst     points to the output vector of numRows samples
+   */
+  void arm_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  q7_t * pVec,
+  q7_t * pDst);
+
+
   /**
    * @brief Floating-point matrix subtraction
    * @param[in]  pSrcA  points to the first input matrix structure
@@ -1711,6 +1814,20 @@ extern "C"
   float32_t * pData);
 
 
+  /**
+   * @brief  Q7 matrix initialization.
+   * @param[in,out] S         points to an instance of the Q7 matrix structure.
+   * @param[in]     nRows     number of rows in the matrix.
+   * @param[in]     nColumns  number of columns in the matrix.
+   * @param[in]     pData     points to the matrix data array.
+   */
+  void arm_mat_init_q7(
+  arm_matrix_instance_q7 * S,
+  uint16_t nRows,
+  uint16_t nColumns,
+  q7_t * pData);
+
+
 
   /**
    * @brief Instance structure for the Q15 PID Control.
@@ -1866,6 +1983,60 @@ extern "C"
     q7_t *pData;        /**< points to the data table. */
   } arm_bilinear_interp_instance_q7;
 
+  /**
+   * @brief Interpolation method of the image resize functions.
+   */
+  typedef enum
+  {
+    ARM_RESIZE_BILINEAR = 0,    /**< bilinear interpolation, 2 taps per direction. */
+    ARM_RESIZE_CUBIC = 1        /**< cubic interpolation, 4 taps per direction. */
+  } arm_resize_mode;
+
+  /**
+   * @brief Instance structure for the floating-point image resize function.
+   */
+  typedef struct
+  {
+    uint16_t srcRows;           /**< number of rows of the source image. */
+    uint16_t srcCols;           /**< number of columns of the source image. */
+    uint16_t dstRows;           /**< number of rows of the output image. */
+    uint16_t dstCols;           /**< number of columns of the output image. */
+    uint16_t numChannels;       /**< number of interleaved channels of a pixel. */
+    uint16_t numTaps;           /**< number of taps per direction. */
+    uint16_t *pIndex;           /**< points to the source rows of the output rows, followed by the source column offsets of the output columns. */
+    float32_t *pCoef;           /**< points to the weights of the taps of pIndex. */
+  } arm_resize_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 image resize function.
+   */
+  typedef struct
+  {
+    uint16_t srcRows;           /**< number of rows of the source image. */
+    uint16_t srcCols;           /**< number of columns of the source image. */
+    uint16_t dstRows;           /**< number of rows of the output image. */
+    uint16_t dstCols;           /**< number of columns of the output image. */
+    uint16_t numChannels;       /**< number of interleaved channels of a pixel. */
+    uint16_t numTaps;           /**< number of taps per direction. */
+    uint16_t *pIndex;           /**< points to the source rows of the output rows, followed by the source column offsets of the output columns. */
+    q15_t *pCoef;               /**< points to the weights of the taps of pIndex, in 2.14 format. */
+  } arm_resize_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q7 image resize function.
+   */
+  typedef struct
+  {
+    uint16_t srcRows;           /**< number of rows of the source image. */
+    uint16_t srcCols;           /**< number of columns of the source image. */
+    uint16_t dstRows;           /**< number of rows of the output image. */
+    uint16_t dstCols;           /**< number of columns of the output image. */
+    uint16_t numChannels;       /**< number of interleaved channels of a pixel. */
+    uint16_t numTaps;           /**< number of taps per direction. */
+    uint16_t *pIndex;           /**< points to the source rows of the output rows, followed by the source column offsets of the output columns. */
+    q15_t *pCoef;               /**< points to the weights of the taps of pIndex, in 2.14 format. */
+  } arm_resize_instance_q7;
+
 
   /**
    * @brief Q7 vector multiplication.
@@ -3407,6 +3578,136 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q15 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t winSize;           /**< length of the sliding window. Must be odd. */
+    uint16_t count;             /**< number of samples currently held in the window. */
+    uint16_t index;             /**< position of the oldest sample in the window. */
+    q15_t *pState;              /**< points to the window samples. The array is of length winSize. */
+    int16_t *pPos;              /**< points to the heap position of every window sample. The array is of length winSize. */
+    int16_t *pHeap;             /**< points to the root of the double heap, which holds the median. */
+  } arm_median_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 running median filter.
+   */
+  typedef struct
+  {
+    uint16_t winSize;           /**< length of the sliding window. Must be odd. */
+    uint16_t count;             /**< number of samples currently held in the window. */
+    uint16_t index;             /**< position of the oldest sample in the window. */
+    q31_t *pState;              /**< points to the window samples. The array is of length winSize. */
+    int16_t *pPos;              /**< points to the heap position of every window sample. The array is of length winSize. */
+    int16_t *pHeap;             /**< points to the root of the double heap, which holds the median. */
+  } arm_median_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point running median filter.
+   */
+  typedef struct
+  {
+    uint16_t winSize;           /**< length of the sliding window. Must be odd. */
+    uint16_t count;             /**< number of samples currently held in the window. */
+    uint16_t index;             /**< position of the oldest sample in the window. */
+    float32_t *pState;          /**< points to the window samples. The array is of length winSize. */
+    int16_t *pPos;              /**< points to the heap position of every window sample. The array is of length winSize. */
+    int16_t *pHeap;             /**< points to the root of the double heap, which holds the median. */
+  } arm_median_instance_f32;
+
+
+  /**
+   * @brief  Processing function for the Q15 running median filter.
+   * @param[in,out] S          points to an instance of the Q15 running median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_q15(
+  arm_median_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q15 running median filter.
+   * @param[in,out] S        points to an instance of the Q15 running median filter structure.
+   * @param[in]     winSize  length of the sliding window.
+   * @param[in]     pState   points to the window buffer of length winSize.
+   * @param[in]     pIndex   points to the heap index buffer of length 2*winSize.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>winSize</code> is not odd.
+   */
+  arm_status arm_median_init_q15(
+  arm_median_instance_q15 * S,
+  uint16_t winSize,
+  q15_t * pState,
+  int16_t * pIndex);
+
+
+  /**
+   * @brief  Processing function for the Q31 running median filter.
+   * @param[in,out] S          points to an instance of the Q31 running median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_q31(
+  arm_median_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 running median filter.
+   * @param[in,out] S        points to an instance of the Q31 running median filter structure.
+   * @param[in]     winSize  length of the sliding window.
+   * @param[in]     pState   points to the window buffer of length winSize.
+   * @param[in]     pIndex   points to the heap index buffer of length 2*winSize.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>winSize</code> is not odd.
+   */
+  arm_status arm_median_init_q31(
+  arm_median_instance_q31 * S,
+  uint16_t winSize,
+  q31_t * pState,
+  int16_t * pIndex);
+
+
+  /**
+   * @brief  Processing function for the floating-point running median filter.
+   * @param[in,out] S          points to an instance of the floating-point running median filter structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_median_f32(
+  arm_median_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point running median filter.
+   * @param[in,out] S        points to an instance of the floating-point running median filter structure.
+   * @param[in]     winSize  length of the sliding window.
+   * @param[in]     pState   points to the window buffer of length winSize.
+   * @param[in]     pIndex   points to the heap index buffer of length 2*winSize.
+   * @return    The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_ARGUMENT_ERROR if
+   * <code>winSize</code> is not odd.
+   */
+  arm_status arm_median_init_f32(
+  arm_median_instance_f32 * S,
+  uint16_t winSize,
+  float32_t * pState,
+  int16_t * pIndex);
+
+
   /**
    * @brief Instance structure for the Q15 FIR interpolator.
    */
@@ -6522,6 +6823,410 @@ void arm_rfft_fast_f32(
   uint32_t * pIndex);
 
 
+  /**
+   * @brief  Compare-exchange of two Q15 values.
+   * @param[in,out] pA  points to the first value, holds the minimum on return
+   * @param[in,out] pB  points to the second value, holds the maximum on return
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_cmp_exch_q15(
+  q15_t * pA,
+  q15_t * pB)
+  {
+    q15_t a = *pA, b = *pB;
+
+    *pA = (a < b) ? a : b;
+    *pB = (a < b) ? b : a;
+  }
+
+
+  /**
+   * @brief  Compare-exchange of two Q31 values.
+   * @param[in,out] pA  points to the first value, holds the minimum on return
+   * @param[in,out] pB  points to the second value, holds the maximum on return
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_cmp_exch_q31(
+  q31_t * pA,
+  q31_t * pB)
+  {
+    q31_t a = *pA, b = *pB;
+
+    *pA = (a < b) ? a : b;
+    *pB = (a < b) ? b : a;
+  }
+
+
+  /**
+   * @brief  Compare-exchange of two floating-point values.
+   * @param[in,out] pA  points to the first value, holds the minimum on return
+   * @param[in,out] pB  points to the second value, holds the maximum on return
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_cmp_exch_f32(
+  float32_t * pA,
+  float32_t * pB)
+  {
+    float32_t a = *pA, b = *pB;
+
+    *pA = (a < b) ? a : b;
+    *pB = (a < b) ? b : a;
+  }
+
+
+  /**
+   * @brief  Lane-wise compare-exchange of two packed Q15 pairs.
+   * @param[in,out] pA  points to the first packed pair, holds the lane-wise minimum on return
+   * @param[in,out] pB  points to the second packed pair, holds the lane-wise maximum on return
+   *
+   * Two independent sorting networks are evaluated at once when one of them is
+   * kept in the bottom halfwords and the other one in the top halfwords.
+   */
+  CMSIS_INLINE __STATIC_INLINE void arm_cmp_exch_q15x2(
+  q31_t * pA,
+  q31_t * pB)
+  {
+    q31_t a = *pA, b = *pB;
+
+#if defined (ARM_MATH_DSP)
+    /* SSUB16 sets the GE flags of every halfword where a >= b, SEL picks on them */
+    (void) __SSUB16(a, b);
+    *pA = (q31_t) __SEL(b, a);
+    *pB = (q31_t) __SEL(a, b);
+#else
+    q15_t aLo = (q15_t) a, aHi = (q15_t) (a >> 16);
+    q15_t bLo = (q15_t) b, bHi = (q15_t) (b >> 16);
+
+    arm_cmp_exch_q15(&aLo, &bLo);
+    arm_cmp_exch_q15(&aHi, &bHi);
+
+    *pA = __PKHBT(aLo, aHi, 16);
+    *pB = __PKHBT(bLo, bHi, 16);
+#endif /* #if defined (ARM_MATH_DSP) */
+  }
+
+
+  /**
+   * @brief Sort direction of the sorting functions.
+   */
+  typedef enum
+  {
+    ARM_SORT_ASCENDING = 0,              /**< Smallest value first */
+    ARM_SORT_DESCENDING = 1              /**< Largest value first */
+  } arm_sort_dir;
+
+  /**
+   * @brief Instance structure for the Q15 sort.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;           /**< sort direction. */
+    q15_t *pBuffer;             /**< points to the scratch buffer of the merge passes. The array is of length blockSize. */
+  } arm_sort_instance_q15;
+
+  /**
+   * @brief Instance structure for the Q31 sort.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;           /**< sort direction. */
+    q31_t *pBuffer;             /**< points to the scratch buffer of the merge passes. The array is of length blockSize. */
+  } arm_sort_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point sort.
+   */
+  typedef struct
+  {
+    arm_sort_dir dir;           /**< sort direction. */
+    float32_t *pBuffer;         /**< points to the scratch buffer of the merge passes. The array is of length blockSize. */
+  } arm_sort_instance_f32;
+
+
+  /**
+   * @brief  Initialization function for the Q15 sort.
+   * @param[in,out] S        points to an instance of the Q15 sort structure.
+   * @param[in]     dir      sort direction.
+   * @param[in]     pBuffer  points to the scratch buffer.
+   */
+  void arm_sort_init_q15(
+  arm_sort_instance_q15 * S,
+  arm_sort_dir dir,
+  q15_t * pBuffer);
+
+
+  /**
+   * @brief  Initialization function for the Q31 sort.
+   * @param[in,out] S        points to an instance of the Q31 sort structure.
+   * @param[in]     dir      sort direction.
+   * @param[in]     pBuffer  points to the scratch buffer.
+   */
+  void arm_sort_init_q31(
+  arm_sort_instance_q31 * S,
+  arm_sort_dir dir,
+  q31_t * pBuffer);
+
+
+  /**
+   * @brief  Initialization function for the floating-point sort.
+   * @param[in,out] S        points to an instance of the floating-point sort structure.
+   * @param[in]     dir      sort direction.
+   * @param[in]     pBuffer  points to the scratch buffer.
+   */
+  void arm_sort_init_f32(
+  arm_sort_instance_f32 * S,
+  arm_sort_dir dir,
+  float32_t * pBuffer);
+
+
+  /**
+   * @brief  Sorts a Q15 vector.
+   * @param[in]  S          points to an instance of the Q15 sort structure.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the sorted output vector
+   * @param[in]  blockSize  length of the vectors
+   */
+  void arm_sort_q15(
+  const arm_sort_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts a Q31 vector.
+   * @param[in]  S          points to an instance of the Q31 sort structure.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the sorted output vector
+   * @param[in]  blockSize  length of the vectors
+   */
+  void arm_sort_q31(
+  const arm_sort_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sorts a floating-point vector.
+   * @param[in]  S          points to an instance of the floating-point sort structure.
+   * @param[in]  pSrc       points to the input vector
+   * @param[out] pDst       points to the sorted output vector
+   * @param[in]  blockSize  length of the vectors
+   */
+  void arm_sort_f32(
+  const arm_sort_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  k-th smallest value of a Q15 vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     k          zero based rank of the requested value
+   * @param[out]    pResult    k-th smallest value returned here
+   */
+  void arm_select_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q15_t * pResult);
+
+
+  /**
+   * @brief  k-th smallest value of a Q31 vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     k          zero based rank of the requested value
+   * @param[out]    pResult    k-th smallest value returned here
+   */
+  void arm_select_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  q31_t * pResult);
+
+
+  /**
+   * @brief  k-th smallest value of a floating-point vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     k          zero based rank of the requested value
+   * @param[out]    pResult    k-th smallest value returned here
+   */
+  void arm_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult);
+
+
+  /**
+   * @brief  Percentile of a Q15 vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     fraction   requested percentile as a fraction of one in 1.15 format
+   * @param[out]    pResult    percentile value returned here
+   */
+  void arm_percentile_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t fraction,
+  q15_t * pResult);
+
+
+  /**
+   * @brief  Percentile of a Q31 vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     fraction   requested percentile as a fraction of one in 1.15 format
+   * @param[out]    pResult    percentile value returned here
+   */
+  void arm_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q15_t fraction,
+  q31_t * pResult);
+
+
+  /**
+   * @brief  Percentile of a floating-point vector.
+   * @param[in,out] pSrc       points to the input vector, reordered on return
+   * @param[in]     blockSize  length of the input vector
+   * @param[in]     fraction   requested percentile as a fraction of one, in the range [0, 1]
+   * @param[out]    pResult    percentile value returned here
+   */
+  void arm_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t fraction,
+  float32_t * pResult);
+
+
+  /**
+   * @brief Instance structure for the floating-point spectral features.
+   */
+  typedef struct
+  {
+    uint16_t numBins;           /**< number of bins of the spectrum. */
+    float32_t rolloffRatio;     /**< share of the spectrum sum found up to the rolloff bin. */
+    float32_t *pState;          /**< points to the previous spectrum array. The array is of length numBins. */
+  } arm_spectral_features_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q15 spectral features.
+   */
+  typedef struct
+  {
+    uint16_t numBins;           /**< number of bins of the spectrum. */
+    q15_t rolloffRatio;         /**< share of the spectrum sum found up to the rolloff bin. */
+    q15_t *pState;              /**< points to the previous spectrum array. The array is of length numBins. */
+  } arm_spectral_features_instance_q15;
+
+  /**
+   * @brief Floating-point spectral descriptors of a frame.
+   */
+  typedef struct
+  {
+    float32_t centroid;         /**< spectral centroid, as a fraction of numBins. */
+    float32_t rolloff;          /**< spectral rolloff, as a fraction of numBins. */
+    float32_t flux;             /**< sum of the squared differences to the previous spectrum. */
+    float32_t flatness;         /**< geometric mean over arithmetic mean of the bins. */
+  } arm_spectral_desc_f32;
+
+  /**
+   * @brief Q15 spectral descriptors of a frame.
+   */
+  typedef struct
+  {
+    q15_t centroid;             /**< spectral centroid, as a fraction of numBins. */
+    q15_t rolloff;              /**< spectral rolloff, as a fraction of numBins. */
+    q63_t flux;                 /**< sum of the squared differences to the previous spectrum, in 34.30 format. */
+    q15_t flatness;             /**< geometric mean over arithmetic mean of the bins. */
+  } arm_spectral_desc_q15;
+
+
+  /**
+   * @brief  Initialization function for the floating-point spectral features.
+   * @param[in,out] S             points to an instance of the floating-point spectral features structure.
+   * @param[in]     numBins       number of bins of the spectrum.
+   * @param[in]     rolloffRatio  share of the spectrum sum found up to the rolloff bin.
+   * @param[in]     pState        points to the previous spectrum buffer.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_spectral_features_init_f32(
+  arm_spectral_features_instance_f32 * S,
+  uint16_t numBins,
+  float32_t rolloffRatio,
+  float32_t * pState);
+
+
+  /**
+   * @brief  Initialization function for the Q15 spectral features.
+   * @param[in,out] S             points to an instance of the Q15 spectral features structure.
+   * @param[in]     numBins       number of bins of the spectrum.
+   * @param[in]     rolloffRatio  share of the spectrum sum found up to the rolloff bin.
+   * @param[in]     pState        points to the previous spectrum buffer.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_spectral_features_init_q15(
+  arm_spectral_features_instance_q15 * S,
+  uint16_t numBins,
+  q15_t rolloffRatio,
+  q15_t * pState);
+
+
+  /**
+   * @brief  Spectral centroid, rolloff, flux and flatness of a floating-point spectrum.
+   * @param[in,out] S      points to an instance of the floating-point spectral features structure.
+   * @param[in]     pSrc   points to the magnitude or power spectrum.
+   * @param[out]    pDesc  points to the spectral descriptors.
+   */
+  void arm_spectral_features_f32(
+  arm_spectral_features_instance_f32 * S,
+  float32_t * pSrc,
+  arm_spectral_desc_f32 * pDesc);
+
+
+  /**
+   * @brief  Spectral centroid, rolloff, flux and flatness of a Q15 spectrum.
+   * @param[in,out] S      points to an instance of the Q15 spectral features structure.
+   * @param[in]     pSrc   points to the magnitude or power spectrum.
+   * @param[out]    pDesc  points to the spectral descriptors.
+   */
+  void arm_spectral_features_q15(
+  arm_spectral_features_instance_q15 * S,
+  q15_t * pSrc,
+  arm_spectral_desc_q15 * pDesc);
+
+
+  /**
+   * @brief  Zero-crossing rate and energy of a floating-point vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pZcr       is the zero-crossing rate.
+   * @param[out] pEnergy    is the sum of the squares.
+   */
+  void arm_zcr_energy_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pZcr,
+  float32_t * pEnergy);
+
+
+  /**
+   * @brief  Zero-crossing rate and energy of a Q15 vector.
+   * @param[in]  pSrc       is input pointer
+   * @param[in]  blockSize  is the number of samples to process
+   * @param[out] pZcr       is the zero-crossing rate.
+   * @param[out] pEnergy    is the sum of the squares.
+   */
+  void arm_zcr_energy_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pZcr,
+  q63_t * pEnergy);
+
+
   /**
    * @brief  Q15 complex-by-complex multiplication
    * @param[in]  pSrcA       points to the first input vector
@@ -7019,6 +7724,161 @@ void arm_rfft_fast_f32(
    */
 
 
+  /**
+   * @brief  Floating-point linear interpolation of a block of samples.
+   * @param[in]  S          is an instance of the floating-point Linear Interpolation structure
+   * @param[in]  pSrc       points to the block of input samples.
+   * @param[out] pDst       points to the block of output samples.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_linear_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Q15 linear interpolation of a block of samples.
+   * @param[in]  pYData     points to the Q15 Linear Interpolation table.
+   * @param[in]  pSrc       points to the block of input samples in 12.20 format.
+   * @param[out] pDst       points to the block of output samples.
+   * @param[in]  nValues    number of table values.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_linear_interp_block_q15(
+  q15_t * pYData,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t nValues,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Floating-point cubic interpolation of a block of samples.
+   * @param[in]  S          is an instance of the floating-point Linear Interpolation structure
+   * @param[in]  pSrc       points to the block of input samples.
+   * @param[out] pDst       points to the block of output samples.
+   * @param[in]  blockSize  number of samples to process.
+   */
+  void arm_cubic_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point image resize.
+   * @param[in,out] S            points to an instance of the floating-point image resize structure.
+   * @param[in]     srcRows      number of rows of the source image.
+   * @param[in]     srcCols      number of columns of the source image.
+   * @param[in]     dstRows      number of rows of the output image.
+   * @param[in]     dstCols      number of columns of the output image.
+   * @param[in]     numChannels  number of interleaved channels of a pixel.
+   * @param[in]     mode         interpolation method.
+   * @param[in]     pIndex       points to the tap index buffer.
+   * @param[in]     pCoef        points to the tap weight buffer.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_resize_init_f32(
+  arm_resize_instance_f32 * S,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode,
+  uint16_t * pIndex,
+  float32_t * pCoef);
+
+
+  /**
+   * @brief  Processing function for the floating-point image resize.
+   * @param[in]  S     points to an instance of the floating-point image resize structure.
+   * @param[in]  pSrc  points to the source image.
+   * @param[out] pDst  points to the output image.
+   */
+  void arm_resize_f32(
+  const arm_resize_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst);
+
+
+  /**
+   * @brief  Initialization function for the Q15 image resize.
+   * @param[in,out] S            points to an instance of the Q15 image resize structure.
+   * @param[in]     srcRows      number of rows of the source image.
+   * @param[in]     srcCols      number of columns of the source image.
+   * @param[in]     dstRows      number of rows of the output image.
+   * @param[in]     dstCols      number of columns of the output image.
+   * @param[in]     numChannels  number of interleaved channels of a pixel.
+   * @param[in]     mode         interpolation method.
+   * @param[in]     pIndex       points to the tap index buffer.
+   * @param[in]     pCoef        points to the tap weight buffer.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_resize_init_q15(
+  arm_resize_instance_q15 * S,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode,
+  uint16_t * pIndex,
+  q15_t * pCoef);
+
+
+  /**
+   * @brief  Processing function for the Q15 image resize.
+   * @param[in]  S     points to an instance of the Q15 image resize structure.
+   * @param[in]  pSrc  points to the source image.
+   * @param[out] pDst  points to the output image.
+   */
+  void arm_resize_q15(
+  const arm_resize_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst);
+
+
+  /**
+   * @brief  Initialization function for the Q7 image resize.
+   * @param[in,out] S            points to an instance of the Q7 image resize structure.
+   * @param[in]     srcRows      number of rows of the source image.
+   * @param[in]     srcCols      number of columns of the source image.
+   * @param[in]     dstRows      number of rows of the output image.
+   * @param[in]     dstCols      number of columns of the output image.
+   * @param[in]     numChannels  number of interleaved channels of a pixel.
+   * @param[in]     mode         interpolation method.
+   * @param[in]     pIndex       points to the tap index buffer.
+   * @param[in]     pCoef        points to the tap weight buffer.
+   * @return        The function returns ARM_MATH_SUCCESS or ARM_MATH_ARGUMENT_ERROR.
+   */
+  arm_status arm_resize_init_q7(
+  arm_resize_instance_q7 * S,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode,
+  uint16_t * pIndex,
+  q15_t * pCoef);
+
+
+  /**
+   * @brief  Processing function for the Q7 image resize.
+   * @param[in]  S     points to an instance of the Q7 image resize structure.
+   * @param[in]  pSrc  points to the source image.
+   * @param[out] pDst  points to the output image.
+   */
+  void arm_resize_q7(
+  const arm_resize_instance_q7 * S,
+  q7_t * pSrc,
+  q7_t * pDst);
+
+
 /* SMMLAR */
 #define multAcc_32x32_keep32_R(a, x, y) \
     a = (q31_t) (((((q63_t) a) << 32) + ((q63_t) x * y) + 0x80000000LL ) >> 32)
@@ -0,0 +1,481 @@
+#!/usr/bin/env python
+"""Static scheduler generator for synchronous dataflow (SDF) graphs of DSP and NN blocks.
+
+usage: sdf_gen.py <graph.json> [-o <output directory>]
+       sdf_gen.py --selftest
+
+The graph describes nodes which wrap library calls and the FIFOs which connect them.
+Every node declares how many tokens it consumes on each input and produces on each
+output per call. The generator:
+
+  1. solves the balance equations for the number of calls of every node in one period,
+  2. builds a periodic schedule which fires every node as soon as its consumers can run,
+     keeping the FIFO occupancy low,
+  3. sizes every FIFO to the smallest buffer which holds its peak occupancy and in which
+     every read and write of the schedule is contiguous,
+  4. emits <name>_sched.c and <name>_sched.h with one function running the schedule,
+     where repeated patterns of calls are folded into loops.
+
+Since the schedule is static, the position of every read and write in the FIFOs is known
+when the code is generated. The nodes read and write the FIFO memory in place through
+constant offsets: there is no dynamic allocation, no copy between stages and no FIFO
+bookkeeping at run time.
+
+Graph description:
+
+  {
+    "name": "kws",
+    "includes": ["kws_nodes.h"],
+    "nodes": {
+      "mic":  {"call": "mic_read({o0}, 160)", "status": true,
+               "outputs": [["q15_t", 160]]},
+      "dec":  {"call": "arm_fir_decimate_q15(&kws_dec, {i0}, {o0}, 160)",
+               "inputs": [["q15_t", 160]], "outputs": [["q15_t", 80]]},
+      ...
+      "fft":  {"call": "arm_rfft_q15(&kws_rfft, {i0}, {o0})",
+               "inputs": [["q15_t", 256]], "outputs": [["q15_t", 512]]},
+      ...
+    },
+    "edges": [["mic.o0", "dec.i0"], ...]
+  }
+
+{iN} and {oN} in the call are replaced by pointers to the tokens of input and output N.
+The rates are the numbers of values the call actually reads and writes: arm_rfft_q15 with
+fftLenReal = 256 writes 512 values, the real and imaginary parts of 256 bins.
+A node with "status": true returns arm_status; the scheduler stops and returns the first
+status which is not ARM_MATH_SUCCESS. Graphs must be connected and acyclic, every port
+must be connected exactly once and both ends of an edge must have the same token type.
+"""
+
+import json
+import os
+import sys
+from fractions import Fraction
+
+try:
+  from math import gcd
+except ImportError:
+  from fractions import gcd
+
+
+# Longest pattern of firings folded into a loop
+MAX_PATTERN = 64
+
+
+class SDFError(Exception):
+  pass
+
+
+def lcm(a, b):
+  return a * b // gcd(a, b)
+
+
+class Port(object):
+
+  def __init__(self, node, kind, index, ctype, rate):
+    self.node = node
+    self.kind = kind
+    self.index = index
+    self.ctype = ctype
+    self.rate = rate
+    self.edge = None
+
+  def name(self):
+    return '%s.%s%d' % (self.node.name, self.kind, self.index)
+
+
+class Node(object):
+
+  def __init__(self, name, desc):
+    self.name = name
+    self.call = desc['call']
+    self.status = bool(desc.get('status', False))
+    self.inputs = [Port(self, 'i', k, t, int(r)) for k, (t, r) in enumerate(desc.get('inputs', []))]
+    self.outputs = [Port(self, 'o', k, t, int(r)) for k, (t, r) in enumerate(desc.get('outputs', []))]
+    for p in self.inputs + self.outputs:
+      if p.rate <= 0:
+        raise SDFError('%s: rates must be positive' % p.name())
+    self.reps = 0
+    self.rank = 0
+
+
+class Edge(object):
+
+  def __init__(self, index, src, dst):
+    if src.ctype != dst.ctype:
+      raise SDFError('%s -> %s: token types %s and %s differ' % (src.name(), dst.name(), src.ctype, dst.ctype))
+    self.index = index
+    self.src = src
+    self.dst = dst
+    self.size = 0
+    self.peak = 0
+
+
+class Graph(object):
+
+  def __init__(self, desc):
+    self.name = desc['name']
+    self.includes = desc.get('includes', [])
+    self.nodes = [Node(n, d) for n, d in sorted(desc['nodes'].items())]
+    byname = dict((n.name, n) for n in self.nodes)
+    self.edges = []
+    for src, dst in desc['edges']:
+      e = Edge(len(self.edges), self._port(byname, src, 'o'), self._port(byname, dst, 'i'))
+      for p in (e.src, e.dst):
+        if p.edge is not None:
+          raise SDFError('%s is connected twice' % p.name())
+        p.edge = e
+      self.edges.append(e)
+    for n in self.nodes:
+      for p in n.inputs + n.outputs:
+        if p.edge is None:
+          raise SDFError('%s is not connected' % p.name())
+
+  def _port(self, byname, ref, kind):
+    try:
+      node, port = ref.split('.')
+      p = (byname[node].outputs if kind == 'o' else byname[node].inputs)[int(port[1:])]
+    except (ValueError, KeyError, IndexError):
+      raise SDFError('unknown port %s' % ref)
+    if port[0] != kind:
+      raise SDFError('%s must be an %s port' % (ref, 'output' if kind == 'o' else 'input'))
+    return p
+
+  def solve_repetitions(self):
+    """Solves q[src] * produced = q[dst] * consumed for every edge."""
+    q = {self.nodes[0].name: Fraction(1)}
+    stack = [self.nodes[0]]
+    while stack:
+      n = stack.pop()
+      for p in n.inputs + n.outputs:
+        e = p.edge
+        if p.kind == 'o':
+          other, ratio = e.dst.node, Fraction(e.src.rate, e.dst.rate)
+        else:
+          other, ratio = e.src.node, Fraction(e.dst.rate, e.src.rate)
+        r = q[n.name] * ratio
+        if other.name not in q:
+          q[other.name] = r
+          stack.append(other)
+        elif q[other.name] != r:
+          raise SDFError('rates of %s -> %s are inconsistent' % (e.src.name(), e.dst.name()))
+    if len(q) != len(self.nodes):
+      raise SDFError('the graph is not connected')
+    den = 1
+    for r in q.values():
+      den = lcm(den, r.denominator)
+    num = 0
+    for r in q.values():
+      num = gcd(num, int(r * den))
+    for n in self.nodes:
+      n.reps = int(q[n.name] * den) // num
+
+  def rank_nodes(self):
+    """Ranks the nodes by their longest distance from a source."""
+    indeg = dict((n.name, len(n.inputs)) for n in self.nodes)
+    ready = [n for n in self.nodes if indeg[n.name] == 0]
+    done = 0
+    while ready:
+      n = ready.pop(0)
+      done += 1
+      for p in n.outputs:
+        d = p.edge.dst.node
+        d.rank = max(d.rank, n.rank + 1)
+        indeg[d.name] -= 1
+        if indeg[d.name] == 0:
+          ready.append(d)
+    if done != len(self.nodes):
+      raise SDFError('the graph has a cycle')
+
+  def schedule(self):
+    """Fires the fireable node closest to the sinks until every node has run its repetitions."""
+    tokens = dict((e.index, 0) for e in self.edges)
+    fired = dict((n.name, 0) for n in self.nodes)
+    firings = []
+    total = sum(n.reps for n in self.nodes)
+    while len(firings) < total:
+      ready = [n for n in self.nodes if fired[n.name] < n.reps and
+               all(tokens[p.edge.index] >= p.rate for p in n.inputs)]
+      if not ready:
+        raise SDFError('the graph deadlocks')
+      n = max(ready, key=lambda m: m.rank)
+      for p in n.inputs:
+        tokens[p.edge.index] -= p.rate
+      for p in n.outputs:
+        tokens[p.edge.index] += p.rate
+        p.edge.peak = max(p.edge.peak, tokens[p.edge.index])
+      fired[n.name] += 1
+      firings.append(n)
+    return firings
+
+  def size_fifos(self):
+    """Picks for every FIFO the smallest divisor of its tokens per period which holds the
+    peak occupancy and in which no read or write wraps around the end of the buffer."""
+    for e in self.edges:
+      period = e.src.node.reps * e.src.rate
+      for size in range(e.peak, period + 1):
+        if period % size != 0:
+          continue
+        if all((k * r) % size + r <= size
+               for r, reps in ((e.src.rate, e.src.node.reps), (e.dst.rate, e.dst.node.reps))
+               for k in range(reps)):
+          e.size = size
+          break
+
+  def offsets(self, firings):
+    """Returns the firings with the offset of every port in its FIFO."""
+    pos = dict(((e.index, k), 0) for e in self.edges for k in 'io')
+    out = []
+    for n in firings:
+      offs = {}
+      for p in n.inputs + n.outputs:
+        key = (p.edge.index, p.kind)
+        offs[p.kind + str(p.index)] = pos[key]
+        pos[key] = (pos[key] + p.rate) % p.edge.size
+      out.append((n, offs))
+    return out
+
+  def loops(self, placed):
+    """Folds the firings into loops over a repeated pattern of firings, in which the offset
+    of every port advances by the same amount at every repetition."""
+    loops = []
+    p = 0
+    while p < len(placed):
+      best = (1, 1, None)
+      for length in range(1, min(MAX_PATTERN, (len(placed) - p) // 2) + 1):
+        if any(placed[p + k][0] is not placed[p + length + k][0] for k in range(length)):
+          continue
+        deltas = [dict((key, placed[p + length + k][1][key] - off)
+                       for key, off in placed[p + k][1].items()) for k in range(length)]
+        reps = 2
+        while p + (reps + 1) * length <= len(placed) and \
+              all(placed[p + reps * length + k][0] is placed[p + k][0] and
+                  all(placed[p + reps * length + k][1][key] == off + reps * deltas[k][key]
+                      for key, off in placed[p + k][1].items())
+                  for k in range(length)):
+          reps += 1
+        if reps * length > best[0] * best[1]:
+          best = (length, reps, deltas)
+      length, reps, deltas = best
+      if deltas is None:
+        deltas = [dict((key, 0) for key in placed[p][1])]
+      loops.append((placed[p:p + length], deltas, reps))
+      p += length * reps
+    return loops
+
+  def fifo_name(self, e):
+    return '%s_fifo%d' % (self.name, e.index)
+
+  def place(self):
+    """Schedules one period, sizes the FIFOs and returns the firings with their offsets."""
+    self.solve_repetitions()
+    self.rank_nodes()
+    firings = self.schedule()
+    self.size_fifos()
+    return self.offsets(firings)
+
+  def emit(self, outdir):
+    placed = self.place()
+    loops = self.loops(placed)
+
+    guard = '_%s_SCHED_H_' % self.name.upper()
+    memory = ['  %-24s %6d x %s' % ('%s -> %s' % (e.src.name(), e.dst.name()), e.size, e.src.ctype)
+              for e in self.edges]
+    reps = ['  %-24s %6d' % (n.name, n.reps) for n in self.nodes]
+
+    h = []
+    h.append('/* Generated by sdf_gen.py, do not edit. */')
+    h.append('')
+    h.append('#ifndef %s' % guard)
+    h.append('#define %s' % guard)
+    h.append('')
+    h.append('#include "arm_math.h"')
+    h.append('')
+    h.append('#ifdef __cplusplus')
+    h.append('extern "C"')
+    h.append('{')
+    h.append('#endif')
+    h.append('')
+    h.append('/**')
+    h.append(' * @brief Runs periods of the static schedule of the %s graph.' % self.name)
+    h.append(' * @param[in] numPeriods number of schedule periods to run.')
+    h.append(' * @return ARM_MATH_SUCCESS, or the first failing status returned by a node.')
+    h.append(' *')
+    h.append(' * Calls per period:')
+    h.append(' * <pre>')
+    h.extend(' *' + r for r in reps)
+    h.append(' * </pre>')
+    h.append(' * FIFO sizes, in tokens:')
+    h.append(' * <pre>')
+    h.extend(' *' + m for m in memory)
+    h.append(' * </pre>')
+    h.append(' */')
+    h.append('arm_status %s_run(uint32_t numPeriods);' % self.name)
+    h.append('')
+    h.append('#ifdef __cplusplus')
+    h.append('}')
+    h.append('#endif')
+    h.append('')
+    h.append('#endif /* %s */' % guard)
+
+    c = []
+    c.append('/* Generated by sdf_gen.py, do not edit. */')
+    c.append('')
+    c.append('#include "arm_math.h"')
+    for inc in self.includes:
+      c.append('#include "%s"' % inc)
+    c.append('#include "%s_sched.h"' % self.name)
+    c.append('')
+    c.append('/* FIFOs, sized so that the nodes read and write them in place */')
+    for e in self.edges:
+      c.append('static %s %s[%d];' % (e.src.ctype, self.fifo_name(e), e.size))
+    c.append('')
+    c.append('arm_status %s_run(uint32_t numPeriods)' % self.name)
+    c.append('{')
+    c.append('  arm_status status = ARM_MATH_SUCCESS;')
+    if any(l[2] > 1 for l in loops):
+      c.append('  uint32_t i;')
+    c.append('')
+    c.append('  while (numPeriods > 0U)')
+    c.append('  {')
+    for body, deltas, count in loops:
+      ind = '    '
+      if count > 1:
+        c.append('    for (i = 0U; i < %dU; i++)' % count)
+        c.append('    {')
+        ind = '      '
+      for (n, offs), delta in zip(body, deltas):
+        args = {}
+        for p in n.inputs + n.outputs:
+          key = p.kind + str(p.index)
+          expr = self.fifo_name(p.edge)
+          if offs[key]:
+            expr += ' + %dU' % offs[key]
+          if count > 1 and delta[key]:
+            expr += ' %s (i * %dU)' % ('+' if delta[key] > 0 else '-', abs(delta[key]))
+          args[key] = '(%s)' % expr if expr != self.fifo_name(p.edge) else expr
+        try:
+          call = n.call.format(**args)
+        except (KeyError, IndexError):
+          raise SDFError('%s: the call uses a port which does not exist' % n.name)
+        c.append(ind + '/* %s */' % n.name)
+        c.append(ind + ('status = %s;' % call if n.status else '%s;' % call))
+        if n.status:
+          c.append(ind + 'if (status != ARM_MATH_SUCCESS)')
+          c.append(ind + '{')
+          c.append(ind + '  return (status);')
+          c.append(ind + '}')
+        c.append('')
+      if count > 1:
+        c[-1] = '    }'
+        c.append('')
+    c.append('    numPeriods--;')
+    c.append('  }')
+    c.append('')
+    c.append('  return (status);')
+    c.append('}')
+
+    for fname, lines in (('%s_sched.h' % self.name, h), ('%s_sched.c' % self.name, c)):
+      with open(os.path.join(outdir, fname), 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+    total = sum(e.size for e in self.edges)
+    print('%s: %d calls per period, %d FIFO tokens' % (self.name, len(placed), total))
+
+
+# Graph whose rates do not divide each other: 3 calls of a feed 2 calls of b, which feed 1 call of c
+RATES_GRAPH = {
+  "name": "rates",
+  "nodes": {
+    "a": {"call": "a({o0})", "outputs": [["q15_t", 2]]},
+    "b": {"call": "b({i0}, {o0})", "inputs": [["q15_t", 3]], "outputs": [["q15_t", 1]]},
+    "c": {"call": "c({i0})", "inputs": [["q15_t", 2]]}
+  },
+  "edges": [["a.o0", "b.i0"], ["b.o0", "c.i0"]]
+}
+
+
+def check(cond, what):
+  if not cond:
+    raise SDFError('self-test failed: %s' % what)
+
+
+def check_fifos(g, placed, loops):
+  """Replays the placed firings on the FIFO memory: every read must find the tokens in the
+  order they were produced, no write may overwrite an unread token, and the loops must
+  expand back to the placed offsets."""
+  mem = dict((e.index, [None] * e.size) for e in g.edges)
+  count = dict(((e.index, k), 0) for e in g.edges for k in 'io')
+  for n, offs in placed:
+    for p in n.inputs + n.outputs:
+      e, o, key = p.edge, offs[p.kind + str(p.index)], (p.edge.index, p.kind)
+      check(o + p.rate <= e.size, '%s wraps around its FIFO' % p.name())
+      tokens = list(range(count[key], count[key] + p.rate))
+      if p.kind == 'i':
+        check(mem[e.index][o:o + p.rate] == tokens, '%s reads the wrong tokens' % p.name())
+      else:
+        check(all(t is None or t < count[(e.index, 'i')] for t in mem[e.index][o:o + p.rate]),
+              '%s overwrites unread tokens' % p.name())
+        mem[e.index][o:o + p.rate] = tokens
+      count[key] += p.rate
+  expanded = []
+  for body, deltas, reps in loops:
+    for i in range(reps):
+      expanded.extend((n, dict((key, off + i * delta[key]) for key, off in offs.items()))
+                      for (n, offs), delta in zip(body, deltas))
+  check([(n.name, offs) for n, offs in expanded] == [(n.name, offs) for n, offs in placed],
+        'the loops do not expand to the schedule')
+
+
+def selftest():
+  """Checks the repetitions, FIFO sizes and offsets generated for the example graph and for a
+  graph with rates which do not divide each other."""
+  with open(os.path.join(os.path.dirname(os.path.abspath(__file__)), 'example_graph.json')) as f:
+    example = json.load(f)
+  cases = (
+    (example,
+     {'mic': 98, 'dec': 98, 'win': 49, 'fft': 49, 'mel': 49, 'net': 1, 'out': 1},
+     {'mic.o0': 160, 'dec.o0': 160, 'win.o0': 256, 'fft.o0': 512, 'mel.o0': 490, 'net.o0': 12},
+     None),
+    (RATES_GRAPH,
+     {'a': 3, 'b': 2, 'c': 1},
+     {'a.o0': 6, 'b.o0': 2},
+     [('a', {'o0': 0}), ('a', {'o0': 2}), ('b', {'i0': 0, 'o0': 0}),
+      ('a', {'o0': 4}), ('b', {'i0': 3, 'o0': 1}), ('c', {'i0': 0})]))
+  for desc, reps, sizes, offsets in cases:
+    g = Graph(desc)
+    placed = g.place()
+    check(dict((n.name, n.reps) for n in g.nodes) == reps, '%s repetitions' % g.name)
+    check(dict((e.src.name(), e.size) for e in g.edges) == sizes, '%s FIFO sizes' % g.name)
+    if offsets is not None:
+      check([(n.name, offs) for n, offs in placed] == offsets, '%s offsets' % g.name)
+    check_fifos(g, placed, g.loops(placed))
+  # The mel features of the 49 frames fill the input of the network in order
+  check([offs['o0'] for n, offs in Graph(example).place() if n.name == 'mel'] == list(range(0, 490, 10)),
+        'kws mel offsets')
+  print('self-test passed')
+
+
+def main(argv):
+  if len(argv) == 2 and argv[1] == '--selftest':
+    try:
+      selftest()
+    except SDFError as err:
+      sys.stderr.write('%s\n' % err)
+      return 1
+    return 0
+  if len(argv) not in (2, 4) or (len(argv) == 4 and argv[2] != '-o'):
+    sys.stderr.write(__doc__.split('\n\n')[1] + '\n')
+    return 2
+  outdir = argv[3] if len(argv) == 4 else '.'
+  try:
+    with open(argv[1]) as f:
+      Graph(json.load(f)).emit(outdir)
+  except SDFError as err:
+    sys.stderr.write('%s: %s\n' % (argv[1], err))
+    return 1
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv))
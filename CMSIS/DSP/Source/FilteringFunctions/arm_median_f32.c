@@ -0,0 +1,261 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_f32.c
+ * Description:  Floating-point running median filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup Median Running Median Filter
+ *
+ * Replaces every input sample with the median of the last <code>winSize</code> input samples.
+ * The filter removes impulse noise while preserving edges, which a linear
+ * filter of the same length cannot do.
+ *
+ * <pre>
+ *    y[n] = median(x[n-winSize+1], ..., x[n-1], x[n])
+ * </pre>
+ *
+ * Until <code>winSize</code> samples have been received, the median of the samples
+ * received so far is returned. When that number is even the mean of the two
+ * middle samples is returned.
+ *
+ * \par Algorithm
+ * The window is kept in a double heap centered on the median: a max-heap holds the
+ * samples below the median and a min-heap the samples above it. Every window sample
+ * remembers its position in the heaps, so the oldest sample is overwritten in place
+ * by the new one and only the path from that position to the root or to a leaf is
+ * restored. Each output therefore costs <code>O(log(winSize))</code> compares
+ * instead of the <code>O(winSize)</code> of an insertion sort over the window.
+ *
+ * \par Instance Structure
+ * The window, the heap positions and the heap are stored in an instance data structure.
+ * A separate instance structure must be defined for each filter.
+ * There are separate instance structure declarations for each of the 3 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Checks that the window length is odd.
+ * - Zeros out the window and builds the initial heap layout.
+ *
+ * \par
+ * <code>pState</code> points to a buffer of length <code>winSize</code> and
+ * <code>pIndex</code> to a buffer of length <code>2*winSize</code>.
+ * The instance structure cannot be placed into a const data section, and it is
+ * recommended to use the initialization function.
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief Compare-exchange of the samples at heap positions i and j.
+ * @return 1 if the sample at position i is smaller and the samples were swapped, 0 otherwise.
+ */
+static uint32_t arm_median_cmp_exch_f32(
+  arm_median_instance_f32 * S,
+  int32_t i,
+  int32_t j)
+{
+  int16_t *pHeap = S->pHeap;
+  int16_t t;
+
+  if (S->pState[pHeap[i]] < S->pState[pHeap[j]])
+  {
+    t = pHeap[i];
+    pHeap[i] = pHeap[j];
+    pHeap[j] = t;
+    S->pPos[pHeap[i]] = (int16_t) i;
+    S->pPos[pHeap[j]] = (int16_t) j;
+    return 1U;
+  }
+
+  return 0U;
+}
+
+/**
+ * @brief Restores the min-heap below position i/2.
+ */
+static void arm_median_min_down_f32(
+  arm_median_instance_f32 * S,
+  int32_t i)
+{
+  int32_t minCnt = ((int32_t) S->count - 1) / 2;
+
+  for (; i <= minCnt; i *= 2)
+  {
+    /* Pick the smaller of the two children */
+    if ((i > 1) && (i < minCnt) &&
+        (S->pState[S->pHeap[i + 1]] < S->pState[S->pHeap[i]]))
+    {
+      i++;
+    }
+
+    if (arm_median_cmp_exch_f32(S, i, i / 2) == 0U)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Restores the max-heap below position i/2.
+ */
+static void arm_median_max_down_f32(
+  arm_median_instance_f32 * S,
+  int32_t i)
+{
+  int32_t maxCnt = (int32_t) S->count / 2;
+
+  for (; i >= -maxCnt; i *= 2)
+  {
+    /* Pick the larger of the two children */
+    if ((i < -1) && (i > -maxCnt) &&
+        (S->pState[S->pHeap[i]] < S->pState[S->pHeap[i - 1]]))
+    {
+      i--;
+    }
+
+    if (arm_median_cmp_exch_f32(S, i / 2, i) == 0U)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Processing function for the floating-point running median filter.
+ * @param[in,out] *S points to an instance of the floating-point running median filter structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of output data.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_median_f32(
+  arm_median_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* Window samples */
+  int16_t *pHeap = S->pHeap;                     /* Root of the double heap */
+  float32_t in, old, out;                        /* Temporary variables */
+  int32_t i;                                     /* Heap position of the replaced sample */
+  uint32_t isNew;                                /* Window is still filling up */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Overwrite the oldest sample of the window */
+    isNew = (S->count < S->winSize) ? 1U : 0U;
+    i = S->pPos[S->index];
+    old = pState[S->index];
+    pState[S->index] = in;
+    S->index = (S->index + 1U == S->winSize) ? 0U : (S->index + 1U);
+    S->count += (uint16_t) isNew;
+
+    if (i > 0)
+    {
+      /* Sample is in the min-heap */
+      if ((isNew == 0U) && (old < in))
+      {
+        arm_median_min_down_f32(S, i * 2);
+      }
+      else
+      {
+        while ((i > 0) && (arm_median_cmp_exch_f32(S, i, i / 2) != 0U))
+        {
+          i /= 2;
+        }
+
+        /* The sample has become the median */
+        if (i == 0)
+        {
+          arm_median_max_down_f32(S, -1);
+        }
+      }
+    }
+    else if (i < 0)
+    {
+      /* Sample is in the max-heap */
+      if ((isNew == 0U) && (in < old))
+      {
+        arm_median_max_down_f32(S, i * 2);
+      }
+      else
+      {
+        while ((i < 0) && (arm_median_cmp_exch_f32(S, i / 2, i) != 0U))
+        {
+          i /= 2;
+        }
+
+        /* The sample has become the median */
+        if (i == 0)
+        {
+          arm_median_min_down_f32(S, 1);
+        }
+      }
+    }
+    else
+    {
+      /* Sample is the median */
+      if (S->count > 1U)
+      {
+        arm_median_max_down_f32(S, -1);
+      }
+      if (S->count > 2U)
+      {
+        arm_median_min_down_f32(S, 1);
+      }
+    }
+
+    /* The median is the root, averaged with the max-heap top for an even count */
+    out = pState[pHeap[0]];
+    if ((S->count & 1U) == 0U)
+    {
+      out = 0.5f * (out + pState[pHeap[-1]]);
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Median group
+ */
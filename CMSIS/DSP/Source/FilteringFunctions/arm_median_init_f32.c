@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_init_f32.c
+ * Description:  Floating-point running median filter initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point running median filter.
+ * @param[in,out] *S points to an instance of the floating-point running median filter structure.
+ * @param[in] winSize  length of the sliding window.
+ * @param[in] *pState points to the window buffer.
+ * @param[in] *pIndex points to the heap index buffer.
+ * @return    The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>winSize</code> is not odd.
+ *
+ * <b>Description:</b>
+ * \par
+ * <code>pState</code> points to the array of window samples, of length <code>winSize</code>.
+ * <code>pIndex</code> points to an array of length <code>2*winSize</code> which holds the
+ * heap position of every window sample followed by the double heap itself.
+ */
+
+arm_status arm_median_init_f32(
+  arm_median_instance_f32 * S,
+  uint16_t winSize,
+  float32_t * pState,
+  int16_t * pIndex)
+{
+  arm_status status;
+  int32_t i;
+
+  /* The window must be odd so that a full window has a single middle sample */
+  if ((winSize & 1U) == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign window length */
+    S->winSize = winSize;
+
+    /* The window is empty */
+    S->count = 0U;
+    S->index = 0U;
+
+    /* Clear the window */
+    memset(pState, 0, winSize * sizeof(float32_t));
+
+    /* Assign state pointers, the heap root is in the middle of its storage */
+    S->pState = pState;
+    S->pPos = pIndex;
+    S->pHeap = pIndex + winSize + (winSize / 2U);
+
+    /* Fill pattern of the heap: median, max-heap, min-heap, max-heap, ... */
+    for (i = (int32_t) winSize - 1; i >= 0; i--)
+    {
+      S->pPos[i] = (int16_t) (((i + 1) / 2) * (((i & 1) != 0) ? -1 : 1));
+      S->pHeap[S->pPos[i]] = (int16_t) i;
+    }
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Median group
+ */
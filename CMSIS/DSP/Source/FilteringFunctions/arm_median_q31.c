@@ -0,0 +1,220 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_median_q31.c
+ * Description:  Floating-point running median filter
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup Median
+ * @{
+ */
+
+/**
+ * @brief Compare-exchange of the samples at heap positions i and j.
+ * @return 1 if the sample at position i is smaller and the samples were swapped, 0 otherwise.
+ */
+static uint32_t arm_median_cmp_exch_q31(
+  arm_median_instance_q31 * S,
+  int32_t i,
+  int32_t j)
+{
+  int16_t *pHeap = S->pHeap;
+  int16_t t;
+
+  if (S->pState[pHeap[i]] < S->pState[pHeap[j]])
+  {
+    t = pHeap[i];
+    pHeap[i] = pHeap[j];
+    pHeap[j] = t;
+    S->pPos[pHeap[i]] = (int16_t) i;
+    S->pPos[pHeap[j]] = (int16_t) j;
+    return 1U;
+  }
+
+  return 0U;
+}
+
+/**
+ * @brief Restores the min-heap below position i/2.
+ */
+static void arm_median_min_down_q31(
+  arm_median_instance_q31 * S,
+  int32_t i)
+{
+  int32_t minCnt = ((int32_t) S->count - 1) / 2;
+
+  for (; i <= minCnt; i *= 2)
+  {
+    /* Pick the smaller of the two children */
+    if ((i > 1) && (i < minCnt) &&
+        (S->pState[S->pHeap[i + 1]] < S->pState[S->pHeap[i]]))
+    {
+      i++;
+    }
+
+    if (arm_median_cmp_exch_q31(S, i, i / 2) == 0U)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Restores the max-heap below position i/2.
+ */
+static void arm_median_max_down_q31(
+  arm_median_instance_q31 * S,
+  int32_t i)
+{
+  int32_t maxCnt = (int32_t) S->count / 2;
+
+  for (; i >= -maxCnt; i *= 2)
+  {
+    /* Pick the larger of the two children */
+    if ((i < -1) && (i > -maxCnt) &&
+        (S->pState[S->pHeap[i]] < S->pState[S->pHeap[i - 1]]))
+    {
+      i--;
+    }
+
+    if (arm_median_cmp_exch_q31(S, i / 2, i) == 0U)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @brief Processing function for the Q31 running median filter.
+ * @param[in,out] *S points to an instance of the Q31 running median filter structure.
+ * @param[in]     *pSrc points to the block of input data.
+ * @param[out]    *pDst points to the block of output data.
+ * @param[in]     blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_median_q31(
+  arm_median_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pState = S->pState;                     /* Window samples */
+  int16_t *pHeap = S->pHeap;                     /* Root of the double heap */
+  q31_t in, old, out;                            /* Temporary variables */
+  int32_t i;                                     /* Heap position of the replaced sample */
+  uint32_t isNew;                                /* Window is still filling up */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    in = *pSrc++;
+
+    /* Overwrite the oldest sample of the window */
+    isNew = (S->count < S->winSize) ? 1U : 0U;
+    i = S->pPos[S->index];
+    old = pState[S->index];
+    pState[S->index] = in;
+    S->index = (S->index + 1U == S->winSize) ? 0U : (S->index + 1U);
+    S->count += (uint16_t) isNew;
+
+    if (i > 0)
+    {
+      /* Sample is in the min-heap */
+      if ((isNew == 0U) && (old < in))
+      {
+        arm_median_min_down_q31(S, i * 2);
+      }
+      else
+      {
+        while ((i > 0) && (arm_median_cmp_exch_q31(S, i, i / 2) != 0U))
+        {
+          i /= 2;
+        }
+
+        /* The sample has become the median */
+        if (i == 0)
+        {
+          arm_median_max_down_q31(S, -1);
+        }
+      }
+    }
+    else if (i < 0)
+    {
+      /* Sample is in the max-heap */
+      if ((isNew == 0U) && (in < old))
+      {
+        arm_median_max_down_q31(S, i * 2);
+      }
+      else
+      {
+        while ((i < 0) && (arm_median_cmp_exch_q31(S, i / 2, i) != 0U))
+        {
+          i /= 2;
+        }
+
+        /* The sample has become the median */
+        if (i == 0)
+        {
+          arm_median_min_down_q31(S, 1);
+        }
+      }
+    }
+    else
+    {
+      /* Sample is the median */
+      if (S->count > 1U)
+      {
+        arm_median_max_down_q31(S, -1);
+      }
+      if (S->count > 2U)
+      {
+        arm_median_min_down_q31(S, 1);
+      }
+    }
+
+    /* The median is the root, averaged with the max-heap top for an even count */
+    out = pState[pHeap[0]];
+    if ((S->count & 1U) == 0U)
+    {
+      out = (q31_t) (((q63_t) out + pState[pHeap[-1]]) >> 1);
+    }
+
+    *pDst++ = out;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of Median group
+ */
@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_cubic_interp_block_f32.c
+ * Description:  Floating-point cubic interpolation of a block of samples
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup CubicInterpolate Cubic Interpolation
+ *
+ * Cubic interpolation fits a third order polynomial through the four table values which
+ * surround the input sample, which gives a continuous first derivative instead of the
+ * corners of linear interpolation.
+ * The Catmull-Rom spline is used, so that the curve passes through the table values:
+ *
+ * <pre>
+ *     y = y0 + 0.5 * t * (y1 - ym1 + t * (2*ym1 - 5*y0 + 4*y1 - y2 + t * (3*(y0 - y1) + y2 - ym1)))
+ * </pre>
+ *
+ * where <code>y0</code> and <code>y1</code> are the table values on each side of the sample,
+ * <code>ym1</code> and <code>y2</code> their outer neighbors, and <code>t</code> the
+ * fractional position of the sample between <code>y0</code> and <code>y1</code>.
+ * Outer neighbors beyond the ends of the table are replaced by the first or the last table value.
+ *
+ * \par
+ * The table is described by the same instance structure as for linear interpolation,
+ * and the functions operate on a block of samples.
+ * Samples outside of the table return the first or the last table value.
+ */
+
+/**
+ * @addtogroup CubicInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point cubic interpolation of a block of samples.
+ * @param[in]  *S points to an instance of the floating-point Linear Interpolation structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[out] *pDst points to the block of interpolated output samples.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ */
+
+void arm_cubic_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pYData = S->pYData;                 /* Pointer to output table */
+  float32_t x1 = S->x1;                          /* First input value of the table */
+  float32_t invSpacing = 1.0f / S->xSpacing;     /* Reciprocal of the spacing between input values */
+  int32_t last = (int32_t) S->nValues - 1;       /* Index of the last table value */
+  float32_t t;                                   /* Table position and fractional part */
+  float32_t ym1, y0, y1, y2;                     /* Four nearest output values */
+  int32_t i;                                     /* Index variable */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* Position of the sample in the table */
+    t = (*pSrc++ - x1) * invSpacing;
+
+    if (t < 0.0f)
+    {
+      *pDst++ = pYData[0];
+    }
+    else if (t >= (float32_t) last)
+    {
+      *pDst++ = pYData[last];
+    }
+    else
+    {
+      /* Read the four nearest output values, repeating the ends of the table */
+      i = (int32_t) t;
+      t -= (float32_t) i;
+      y0 = pYData[i];
+      y1 = pYData[i + 1];
+      ym1 = (i > 0) ? pYData[i - 1] : y0;
+      y2 = ((i + 1) < last) ? pYData[i + 2] : y1;
+
+      /* Catmull-Rom spline in Horner form */
+      *pDst++ = y0 + 0.5f * t * ((y1 - ym1) +
+                t * (((2.0f * ym1) - (5.0f * y0) + (4.0f * y1) - y2) +
+                t * ((3.0f * (y0 - y1)) + y2 - ym1)));
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of CubicInterpolate group
+ */
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_f32.c
+ * Description:  Floating-point linear interpolation of a block of samples
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Floating-point linear interpolation of a block of samples.
+ * @param[in]  *S points to an instance of the floating-point Linear Interpolation structure.
+ * @param[in]  *pSrc points to the block of input samples.
+ * @param[out] *pDst points to the block of interpolated output samples.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The function computes the same values as <code>arm_linear_interp_f32()</code> for every sample of the block.
+ * The reciprocal of the table spacing is computed once per block, so that every sample costs
+ * a multiplication instead of two divisions. Samples below the table range return the first
+ * table value and samples at or above the last table point return the last table value.
+ */
+
+void arm_linear_interp_block_f32(
+  arm_linear_interp_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pYData = S->pYData;                 /* Pointer to output table */
+  float32_t x1 = S->x1;                          /* First input value of the table */
+  float32_t invSpacing = 1.0f / S->xSpacing;     /* Reciprocal of the spacing between input values */
+  float32_t yFirst = pYData[0];                  /* Output below the table range */
+  float32_t yLast = pYData[S->nValues - 1U];     /* Output above the table range */
+  int32_t last = (int32_t) S->nValues - 1;       /* Index of the last table value */
+  float32_t t, y0;                               /* Table position and nearest output value */
+  int32_t i;                                     /* Index variable */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    /* Position of the sample in the table */
+    t = (*pSrc++ - x1) * invSpacing;
+
+    if (t < 0.0f)
+    {
+      *pDst++ = yFirst;
+    }
+    else if (t >= (float32_t) last)
+    {
+      *pDst++ = yLast;
+    }
+    else
+    {
+      /* Interpolate between the two nearest output values */
+      i = (int32_t) t;
+      y0 = pYData[i];
+      *pDst++ = y0 + (t - (float32_t) i) * (pYData[i + 1] - y0);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_linear_interp_block_q15.c
+ * Description:  Q15 linear interpolation of a block of samples
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup LinearInterpolate
+ * @{
+ */
+
+/**
+ * @brief  Q15 linear interpolation of a block of samples.
+ * @param[in]  *pYData points to the Q15 Linear Interpolation table.
+ * @param[in]  *pSrc points to the block of input samples, in 12.20 format.
+ * @param[out] *pDst points to the block of interpolated output samples.
+ * @param[in]  nValues number of table values.
+ * @param[in]  blockSize number of samples to process.
+ * @return none.
+ *
+ * \par
+ * Input samples are in 12.20 format, with 12 bits for the table index and 20 bits for the
+ * fractional part, as for <code>arm_linear_interp_q15()</code>. Samples outside of the table
+ * return the first or the last table value.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The output is computed as <code>y0 + (((y1 - y0) * fract) >> 20)</code>, with a single
+ * 32 x 32 multiplication per sample instead of two, and cannot overflow.
+ * The result may differ from <code>arm_linear_interp_q15()</code> by one LSB.
+ */
+
+void arm_linear_interp_block_q15(
+  q15_t * pYData,
+  q31_t * pSrc,
+  q15_t * pDst,
+  uint32_t nValues,
+  uint32_t blockSize)
+{
+  q31_t x;                                       /* Input sample */
+  q31_t y0;                                      /* Nearest output value */
+  int32_t index;                                 /* Index to read nearest output values */
+  int32_t last = (int32_t) nValues - 1;          /* Index of the last table value */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while (blkCnt > 0U)
+  {
+    x = *pSrc++;
+
+    /* 12 bits for the table index */
+    index = x >> 20;
+
+    if (index >= last)
+    {
+      *pDst++ = pYData[last];
+    }
+    else if (index < 0)
+    {
+      *pDst++ = pYData[0];
+    }
+    else
+    {
+      /* Interpolate with the 20 bits of the fractional part */
+      y0 = pYData[index];
+      *pDst++ = (q15_t) (y0 + (q31_t) (((q63_t) (pYData[index + 1] - y0) * (x & 0x000FFFFF)) >> 20));
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+}
+
+/**
+ * @} end of LinearInterpolate group
+ */
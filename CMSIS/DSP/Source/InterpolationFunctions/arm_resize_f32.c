@@ -0,0 +1,184 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resize_f32.c
+ * Description:  Floating-point image resize
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @defgroup Resize Image Resize
+ *
+ * Resizes an image sampled on a uniform grid, with bilinear or cubic interpolation.
+ * The image is stored in row order, with the <code>numChannels</code> samples of a pixel
+ * interleaved, which is the HWC layout of the NN library.
+ *
+ * \par
+ * The centers of the output pixels are mapped on the source grid:
+ * <pre>
+ *     src = (dst + 0.5) * srcSize / dstSize - 0.5
+ * </pre>
+ * in both directions, and the output pixel is computed from the 2 x 2 (bilinear) or
+ * 4 x 4 (cubic) nearest source pixels, repeating the pixels of the image border.
+ * Cubic interpolation uses the Catmull-Rom spline, which is sharper than the bilinear one
+ * on downscaled images.
+ *
+ * \par Algorithm
+ * Since the grid is uniform, the source rows and columns of every output row and column
+ * and their weights only depend on the image dimensions. The initialization function
+ * computes them once and stores them in the tap buffers of the instance.
+ * The processing function then reads the taps of the current row once per row and the
+ * taps of the current column once per pixel, for all the channels, without any division,
+ * rounding or boundary test per sample. On cores with DSP extension the bilinear Q15 and Q7
+ * versions compute both horizontal and the vertical interpolations with dual multiplies.
+ *
+ * \par Instance Structure
+ * The image dimensions and the tap buffers are stored in an instance data structure.
+ * There are separate instance structure declarations for the floating-point, Q15 and Q7 data types.
+ * An instance can be reused for any number of images of the same dimensions.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * <code>pIndex</code> and <code>pCoef</code> point to buffers of
+ * <code>(dstRows + dstCols) * numTaps</code> elements, where <code>numTaps</code> is 2 for
+ * bilinear and 4 for cubic interpolation.
+ * The weights of the fixed-point versions are stored in 2.14 format.
+ */
+
+/**
+ * @addtogroup Resize
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point image resize.
+ * @param[in]  *S points to an instance of the floating-point image resize structure.
+ * @param[in]  *pSrc points to the source image, of <code>srcRows * srcCols * numChannels</code> samples.
+ * @param[out] *pDst points to the output image, of <code>dstRows * dstCols * numChannels</code> samples.
+ * @return none.
+ */
+
+void arm_resize_f32(
+  const arm_resize_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst)
+{
+  uint32_t numTaps = S->numTaps;                 /* Taps per direction */
+  uint32_t numChannels = S->numChannels;         /* Channels per pixel */
+  uint32_t rowStride = (uint32_t) S->srcCols * numChannels; /* Samples per source row */
+  uint16_t *pRowIdx = S->pIndex;                 /* Source rows of the output row */
+  float32_t *pRowCoef = S->pCoef;                /* Weights of the source rows */
+  uint16_t *pColIdx;                             /* Source columns of the output column */
+  float32_t *pColCoef;                           /* Weights of the source columns */
+  float32_t *pRow[4];                            /* Source rows of the taps */
+  float32_t *p00, *p01, *p10, *p11;              /* Source pixels of the bilinear taps */
+  float32_t h, acc;                              /* Horizontal and vertical accumulators */
+  uint32_t rowCnt, colCnt, ch, k, u;             /* Loop counters */
+
+  rowCnt = S->dstRows;
+
+  while (rowCnt > 0U)
+  {
+    for (k = 0U; k < numTaps; k++)
+    {
+      pRow[k] = pSrc + (pRowIdx[k] * rowStride);
+    }
+
+    pColIdx = S->pIndex + ((uint32_t) S->dstRows * numTaps);
+    pColCoef = S->pCoef + ((uint32_t) S->dstRows * numTaps);
+    colCnt = S->dstCols;
+
+    if (numTaps == 2U)
+    {
+      /* Bilinear interpolation */
+      while (colCnt > 0U)
+      {
+        p00 = pRow[0] + pColIdx[0];
+        p01 = pRow[0] + pColIdx[1];
+        p10 = pRow[1] + pColIdx[0];
+        p11 = pRow[1] + pColIdx[1];
+
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+          /* Interpolate both source rows, then between them */
+          acc = ((*p00++ * pColCoef[0]) + (*p01++ * pColCoef[1])) * pRowCoef[0];
+          acc += ((*p10++ * pColCoef[0]) + (*p11++ * pColCoef[1])) * pRowCoef[1];
+
+          *pDst++ = acc;
+        }
+
+        pColIdx += 2U;
+        pColCoef += 2U;
+
+        /* Decrement the loop counter */
+        colCnt--;
+      }
+    }
+    else
+    {
+      /* Cubic interpolation */
+      while (colCnt > 0U)
+      {
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+          acc = 0.0f;
+
+          for (k = 0U; k < numTaps; k++)
+          {
+            /* Interpolate the source row, then accumulate it */
+            h = 0.0f;
+            for (u = 0U; u < numTaps; u++)
+            {
+              h += pRow[k][pColIdx[u] + ch] * pColCoef[u];
+            }
+            acc += h * pRowCoef[k];
+          }
+
+          *pDst++ = acc;
+        }
+
+        pColIdx += numTaps;
+        pColCoef += numTaps;
+
+        /* Decrement the loop counter */
+        colCnt--;
+      }
+    }
+
+    pRowIdx += numTaps;
+    pRowCoef += numTaps;
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+}
+
+/**
+ * @} end of Resize group
+ */
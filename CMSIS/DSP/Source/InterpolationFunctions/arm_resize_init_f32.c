@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resize_init_f32.c
+ * Description:  Floating-point image resize initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup Resize
+ * @{
+ */
+
+/**
+ * @brief Computes the source taps and their weights along one direction.
+ * @param[out] *pIndex source index of every tap, multiplied by <code>scale</code>.
+ * @param[out] *pCoef  weight of every tap.
+ * @param[in]  srcSize number of source samples.
+ * @param[in]  dstSize number of output samples.
+ * @param[in]  numTaps 2 or 4.
+ * @param[in]  scale   distance between two source samples in the buffer.
+ */
+static void arm_resize_taps_f32(
+  uint16_t * pIndex,
+  float32_t * pCoef,
+  uint16_t srcSize,
+  uint16_t dstSize,
+  uint16_t numTaps,
+  uint16_t scale)
+{
+  float32_t step = (float32_t) srcSize / (float32_t) dstSize;  /* Source step */
+  float32_t pos, t;                              /* Source position and fractional part */
+  float32_t w[4];                                /* Tap weights */
+  int32_t i0, idx;                               /* First source sample and tap index */
+  uint32_t d, k;                                 /* Loop counters */
+
+  for (d = 0U; d < dstSize; d++)
+  {
+    /* Centers of the output samples mapped on the source grid */
+    pos = (((float32_t) d + 0.5f) * step) - 0.5f;
+    i0 = (pos < 0.0f) ? -1 : (int32_t) pos;
+    t = pos - (float32_t) i0;
+
+    if (numTaps == 2U)
+    {
+      w[0] = 1.0f - t;
+      w[1] = t;
+    }
+    else
+    {
+      /* Catmull-Rom weights */
+      i0 -= 1;
+      w[0] = ((-0.5f * t + 1.0f) * t - 0.5f) * t;
+      w[1] = (1.5f * t - 2.5f) * t * t + 1.0f;
+      w[2] = ((-1.5f * t + 2.0f) * t + 0.5f) * t;
+      w[3] = (0.5f * t - 0.5f) * t * t;
+    }
+
+    for (k = 0U; k < numTaps; k++)
+    {
+      /* Repeat the edge samples */
+      idx = i0 + (int32_t) k;
+      idx = (idx < 0) ? 0 : ((idx >= (int32_t) srcSize) ? ((int32_t) srcSize - 1) : idx);
+
+      *pIndex++ = (uint16_t) (idx * scale);
+      *pCoef++ = w[k];
+    }
+  }
+}
+
+/**
+ * @brief  Initialization function for the floating-point image resize.
+ * @param[in,out] *S points to an instance of the floating-point image resize structure.
+ * @param[in] srcRows  number of rows of the source image.
+ * @param[in] srcCols  number of columns of the source image.
+ * @param[in] dstRows  number of rows of the output image.
+ * @param[in] dstCols  number of columns of the output image.
+ * @param[in] numChannels  number of interleaved channels of a pixel.
+ * @param[in] mode  interpolation method, bilinear or cubic.
+ * @param[in] *pIndex points to the tap index buffer, of length <code>(dstRows + dstCols) * numTaps</code>.
+ * @param[in] *pCoef  points to the tap weight buffer, of length <code>(dstRows + dstCols) * numTaps</code>.
+ * @return    The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * a dimension is zero or a source row holds more than 65536 samples.
+ *
+ * \par
+ * <code>numTaps</code> is 2 for bilinear and 4 for cubic interpolation.
+ */
+
+arm_status arm_resize_init_f32(
+  arm_resize_instance_f32 * S,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode,
+  uint16_t * pIndex,
+  float32_t * pCoef)
+{
+  arm_status status;
+  uint16_t numTaps = (mode == ARM_RESIZE_CUBIC) ? 4U : 2U;
+
+  if ((srcRows == 0U) || (srcCols == 0U) || (dstRows == 0U) || (dstCols == 0U) ||
+      (numChannels == 0U) || (((uint32_t) srcCols * numChannels) > 65536U))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the image dimensions */
+    S->srcRows = srcRows;
+    S->srcCols = srcCols;
+    S->dstRows = dstRows;
+    S->dstCols = dstCols;
+    S->numChannels = numChannels;
+    S->numTaps = numTaps;
+
+    /* Row taps first, then column taps as offsets of the first channel of the pixel */
+    arm_resize_taps_f32(pIndex, pCoef, srcRows, dstRows, numTaps, 1U);
+    arm_resize_taps_f32(pIndex + (dstRows * numTaps), pCoef + (dstRows * numTaps),
+                        srcCols, dstCols, numTaps, numChannels);
+
+    /* Assign tap pointers */
+    S->pIndex = pIndex;
+    S->pCoef = pCoef;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Resize group
+ */
@@ -0,0 +1,113 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resize_init_q7.c
+ * Description:  Q7 image resize initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+extern void arm_resize_taps_q15(
+  uint16_t * pIndex,
+  q15_t * pCoef,
+  uint16_t srcSize,
+  uint16_t dstSize,
+  uint16_t numTaps,
+  uint16_t scale);
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup Resize
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q7 image resize.
+ * @param[in,out] *S points to an instance of the Q7 image resize structure.
+ * @param[in] srcRows  number of rows of the source image.
+ * @param[in] srcCols  number of columns of the source image.
+ * @param[in] dstRows  number of rows of the output image.
+ * @param[in] dstCols  number of columns of the output image.
+ * @param[in] numChannels  number of interleaved channels of a pixel.
+ * @param[in] mode  interpolation method, bilinear or cubic.
+ * @param[in] *pIndex points to the tap index buffer, of length <code>(dstRows + dstCols) * numTaps</code>.
+ * @param[in] *pCoef  points to the tap weight buffer, of length <code>(dstRows + dstCols) * numTaps</code>.
+ * @return    The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * a dimension is zero or a source row holds more than 65536 samples.
+ *
+ * \par
+ * <code>numTaps</code> is 2 for bilinear and 4 for cubic interpolation.
+ */
+
+arm_status arm_resize_init_q7(
+  arm_resize_instance_q7 * S,
+  uint16_t srcRows,
+  uint16_t srcCols,
+  uint16_t dstRows,
+  uint16_t dstCols,
+  uint16_t numChannels,
+  arm_resize_mode mode,
+  uint16_t * pIndex,
+  q15_t * pCoef)
+{
+  arm_status status;
+  uint16_t numTaps = (mode == ARM_RESIZE_CUBIC) ? 4U : 2U;
+
+  if ((srcRows == 0U) || (srcCols == 0U) || (dstRows == 0U) || (dstCols == 0U) ||
+      (numChannels == 0U) || (((uint32_t) srcCols * numChannels) > 65536U))
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the image dimensions */
+    S->srcRows = srcRows;
+    S->srcCols = srcCols;
+    S->dstRows = dstRows;
+    S->dstCols = dstCols;
+    S->numChannels = numChannels;
+    S->numTaps = numTaps;
+
+    /* Row taps first, then column taps as offsets of the first channel of the pixel */
+    arm_resize_taps_q15(pIndex, pCoef, srcRows, dstRows, numTaps, 1U);
+    arm_resize_taps_q15(pIndex + (dstRows * numTaps), pCoef + (dstRows * numTaps),
+                        srcCols, dstCols, numTaps, numChannels);
+
+    /* Assign tap pointers */
+    S->pIndex = pIndex;
+    S->pCoef = pCoef;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of Resize group
+ */
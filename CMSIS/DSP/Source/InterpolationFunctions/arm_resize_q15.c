@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_resize_q15.c
+ * Description:  Q15 image resize
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupInterpolation
+ */
+
+/**
+ * @addtogroup Resize
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q15 image resize.
+ * @param[in]  *S points to an instance of the Q15 image resize structure.
+ * @param[in]  *pSrc points to the source image, of <code>srcRows * srcCols * numChannels</code> samples.
+ * @param[out] *pDst points to the output image, of <code>dstRows * dstCols * numChannels</code> samples.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The weights are in 2.14 format. Every row tap is first interpolated horizontally and rounded
+ * back to 1.15 format, then the row taps are combined, rounded and saturated to 1.15 format.
+ * All the intermediate results fit in 32 bits. Bilinear outputs cannot saturate, cubic outputs
+ * saturate where the spline overshoots the range of the 1.15 format.
+ * The weights are rounded to 2.14 format, so the outputs are not exact to the last bit: compared
+ * with an interpolation in double precision, they differ by up to 5 LSB in bilinear mode and
+ * up to 9 LSB in cubic mode on full scale inputs.
+ */
+
+void arm_resize_q15(
+  const arm_resize_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst)
+{
+  uint32_t numTaps = S->numTaps;                 /* Taps per direction */
+  uint32_t numChannels = S->numChannels;         /* Channels per pixel */
+  uint32_t rowStride = (uint32_t) S->srcCols * numChannels; /* Samples per source row */
+  uint16_t *pRowIdx = S->pIndex;                 /* Source rows of the output row */
+  q15_t *pRowCoef = S->pCoef;                    /* Weights of the source rows */
+  uint16_t *pColIdx;                             /* Source columns of the output column */
+  q15_t *pColCoef;                               /* Weights of the source columns */
+  q15_t *pRow[4];                                /* Source rows of the taps */
+  q31_t h, acc;                                  /* Horizontal and vertical accumulators */
+  uint32_t rowCnt, colCnt, ch, k, u;             /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t wr, wc;                                  /* Packed weights of the two taps */
+  q31_t h0, h1;                                  /* Horizontal results of the two row taps */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  rowCnt = S->dstRows;
+
+  while (rowCnt > 0U)
+  {
+    for (k = 0U; k < numTaps; k++)
+    {
+      pRow[k] = pSrc + (pRowIdx[k] * rowStride);
+    }
+
+    pColIdx = S->pIndex + ((uint32_t) S->dstRows * numTaps);
+    pColCoef = S->pCoef + ((uint32_t) S->dstRows * numTaps);
+    colCnt = S->dstCols;
+
+    if (numTaps == 2U)
+    {
+      /* Bilinear interpolation */
+#if defined (ARM_MATH_DSP)
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      wr = __PKHBT(pRowCoef[0], pRowCoef[1], 16);
+
+      while (colCnt > 0U)
+      {
+        wc = __PKHBT(pColCoef[0], pColCoef[1], 16);
+
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+          /* Interpolate both source rows with a dual multiply, then between them */
+          h0 = (q31_t) __SMUAD(__PKHBT(pRow[0][pColIdx[0] + ch], pRow[0][pColIdx[1] + ch], 16), wc);
+          h1 = (q31_t) __SMUAD(__PKHBT(pRow[1][pColIdx[0] + ch], pRow[1][pColIdx[1] + ch], 16), wc);
+          acc = (q31_t) __SMUAD(__PKHBT((h0 + 0x2000) >> 14, (h1 + 0x2000) >> 14, 16), wr);
+
+          *pDst++ = (q15_t) __SSAT((acc + 0x2000) >> 14, 16);
+        }
+
+        pColIdx += 2U;
+        pColCoef += 2U;
+
+        /* Decrement the loop counter */
+        colCnt--;
+      }
+
+#else
+      /* Run the below code for Cortex-M0 */
+
+      while (colCnt > 0U)
+      {
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+          /* Interpolate both source rows, then between them */
+          h = ((pRow[0][pColIdx[0] + ch] * pColCoef[0]) +
+               (pRow[0][pColIdx[1] + ch] * pColCoef[1]) + 0x2000) >> 14;
+          acc = h * pRowCoef[0];
+          h = ((pRow[1][pColIdx[0] + ch] * pColCoef[0]) +
+               (pRow[1][pColIdx[1] + ch] * pColCoef[1]) + 0x2000) >> 14;
+          acc += h * pRowCoef[1];
+
+          *pDst++ = (q15_t) __SSAT((acc + 0x2000) >> 14, 16);
+        }
+
+        pColIdx += 2U;
+        pColCoef += 2U;
+
+        /* Decrement the loop counter */
+        colCnt--;
+      }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+    }
+    else
+    {
+      /* Cubic interpolation */
+      while (colCnt > 0U)
+      {
+        for (ch = 0U; ch < numChannels; ch++)
+        {
+          acc = 0;
+
+          for (k = 0U; k < numTaps; k++)
+          {
+            /* Interpolate the source row, then accumulate it */
+            h = 0x2000;
+            for (u = 0U; u < numTaps; u++)
+            {
+              h += pRow[k][pColIdx[u] + ch] * pColCoef[u];
+            }
+            acc += (h >> 14) * pRowCoef[k];
+          }
+
+          *pDst++ = (q15_t) __SSAT((acc + 0x2000) >> 14, 16);
+        }
+
+        pColIdx += numTaps;
+        pColCoef += numTaps;
+
+        /* Decrement the loop counter */
+        colCnt--;
+      }
+    }
+
+    pRowIdx += numTaps;
+    pRowCoef += numTaps;
+
+    /* Decrement the loop counter */
+    rowCnt--;
+  }
+}
+
+/**
+ * @} end of Resize group
+ */
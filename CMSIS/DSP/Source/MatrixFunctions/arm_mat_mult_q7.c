@@ -0,0 +1,291 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_mult_q7.c
+ * Description:  Q7 matrix multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixMult
+ * @{
+ */
+
+/**
+ * @brief Q7 matrix multiplication
+ * @param[in]       *pSrcA points to the first input matrix structure
+ * @param[in]       *pSrcB points to the second input matrix structure
+ * @param[out]      *pDst points to output matrix structure
+ * @param[in]       *pState points to the array for storing the transpose of <code>pSrcB</code>
+ * @return          The function returns either
+ * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The function is implemented using a 32-bit internal accumulator. The inputs to the
+ * multiplications are in 1.7 format and multiplications yield a 2.14 result.
+ * The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
+ * Since <code>numColsA</code> is at most 65535 there is no risk of overflow.
+ * The 18.14 result is then truncated to 18.7 format by discarding the low 7 bits
+ * and then saturated to 1.7 format.
+ *
+ * \par
+ * On Cortex-M3 and Cortex-M4 <code>pSrcB</code> is first transposed into <code>pState</code>,
+ * which must hold <code>numRowsB * numColsB</code> samples, so that both operands
+ * of the dot products are read four samples at a time. Each sample pair is widened
+ * with <code>__SXTB16</code> and accumulated with <code>__SMLAD</code>, and every
+ * row of <code>pSrcA</code> is unpacked once for two columns of <code>pSrcB</code>.
+ * <code>pState</code> is not used on Cortex-M0.
+ */
+
+arm_status arm_mat_mult_q7(
+  const arm_matrix_instance_q7 * pSrcA,
+  const arm_matrix_instance_q7 * pSrcB,
+  arm_matrix_instance_q7 * pDst,
+  q7_t * pState)
+{
+  q7_t *pInA;                                    /* input data matrix pointer A */
+  q7_t *pInB;                                    /* input data matrix pointer B */
+  q7_t *pOut = pDst->pData;                      /* output data matrix pointer */
+  uint16_t numRowsA = pSrcA->numRows;            /* number of rows of input matrix A    */
+  uint16_t numColsB = pSrcB->numCols;            /* number of columns of input matrix B */
+  uint16_t numColsA = pSrcA->numCols;            /* number of columns of input matrix A */
+  uint16_t col, row, colCnt;                     /* loop counters */
+  q31_t sum;                                     /* accumulator */
+  arm_status status;                             /* status of matrix multiplication */
+
+#if defined (ARM_MATH_DSP)
+
+  arm_matrix_instance_q7 srcBT;                  /* transpose of matrix B */
+  q7_t *pInB2;                                   /* second column of B */
+  q31_t sum2;                                    /* accumulator of the second column */
+  q31_t inA, inB;                                /* four packed input samples */
+  q31_t inA1, inA2, inB1, inB2;                  /* sample pairs widened to 16 bits */
+
+#else
+
+  q7_t *pA, *pB;                                 /* dot product pointers */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if ((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /* #ifdef ARM_MATH_MATRIX_CHECK */
+
+  {
+#if defined (ARM_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Transpose B so that its columns are contiguous */
+    srcBT.numRows = numColsB;
+    srcBT.numCols = pSrcB->numRows;
+    srcBT.pData = pState;
+    (void) arm_mat_trans_q7(pSrcB, &srcBT);
+
+    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
+    pInA = pSrcA->pData;
+    row = numRowsA;
+
+    while (row > 0U)
+    {
+      /* Two columns of B are processed at a time */
+      pInB = pState;
+      col = numColsB >> 1U;
+
+      while (col > 0U)
+      {
+        pInB2 = pInB + numColsA;
+        sum = 0;
+        sum2 = 0;
+
+        /* Apply loop unrolling and compute 4 MACs per column simultaneously. */
+        colCnt = numColsA >> 2U;
+
+        while (colCnt > 0U)
+        {
+          /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+          /* Read four samples of the row of A and widen them into two sample pairs */
+          inA = *__SIMD32(pInA)++;
+          inA1 = __SXTB16(__ROR(inA, 8));
+          inA2 = __SXTB16(inA);
+
+          /* Multiply and accumulate with the first column */
+          inB = *__SIMD32(pInB)++;
+          inB1 = __SXTB16(__ROR(inB, 8));
+          inB2 = __SXTB16(inB);
+          sum = __SMLAD(inA1, inB1, sum);
+          sum = __SMLAD(inA2, inB2, sum);
+
+          /* Multiply and accumulate with the second column */
+          inB = *__SIMD32(pInB2)++;
+          inB1 = __SXTB16(__ROR(inB, 8));
+          inB2 = __SXTB16(inB);
+          sum2 = __SMLAD(inA1, inB1, sum2);
+          sum2 = __SMLAD(inA2, inB2, sum2);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* process remaining column samples */
+        colCnt = numColsA & 3U;
+
+        while (colCnt > 0U)
+        {
+          sum += (q15_t) * pInA * *pInB++;
+          sum2 += (q15_t) * pInA++ * *pInB2++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Saturate and store the results in the destination buffer */
+        *pOut++ = (q7_t) __SSAT((sum >> 7), 8);
+        *pOut++ = (q7_t) __SSAT((sum2 >> 7), 8);
+
+        /* Rewind the row of A and move to the next pair of columns */
+        pInA -= numColsA;
+        pInB = pInB2;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Last column when the number of columns of B is odd */
+      if ((numColsB & 1U) != 0U)
+      {
+        sum = 0;
+        colCnt = numColsA >> 2U;
+
+        while (colCnt > 0U)
+        {
+          inA = *__SIMD32(pInA)++;
+          inB = *__SIMD32(pInB)++;
+          sum = __SMLAD(__SXTB16(__ROR(inA, 8)), __SXTB16(__ROR(inB, 8)), sum);
+          sum = __SMLAD(__SXTB16(inA), __SXTB16(inB), sum);
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        colCnt = numColsA & 3U;
+
+        while (colCnt > 0U)
+        {
+          sum += (q15_t) * pInA++ * *pInB++;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        *pOut++ = (q7_t) __SSAT((sum >> 7), 8);
+        pInA -= numColsA;
+      }
+
+      /* Move to the next row of A */
+      pInA += numColsA;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* pState is only used by the transpose of the DSP version */
+    (void) pState;
+
+    /* The following loop performs the dot-product of each row in pSrcA with each column in pSrcB */
+    pInA = pSrcA->pData;
+    row = numRowsA;
+
+    while (row > 0U)
+    {
+      pInB = pSrcB->pData;
+      col = numColsB;
+
+      while (col > 0U)
+      {
+        /* c(m,n) = a(1,1)*b(1,1) + a(1,2) * b(2,1) + .... + a(m,p)*b(p,n) */
+        sum = 0;
+        pA = pInA;
+        pB = pInB;
+        colCnt = numColsA;
+
+        while (colCnt > 0U)
+        {
+          sum += (q15_t) * pA++ * *pB;
+          pB += numColsB;
+
+          /* Decrement the loop counter */
+          colCnt--;
+        }
+
+        /* Saturate and store the result in the destination buffer */
+        *pOut++ = (q7_t) __SSAT((sum >> 7), 8);
+
+        /* Move to the next column of B */
+        pInB++;
+
+        /* Decrement the column loop counter */
+        col--;
+      }
+
+      /* Move to the next row of A */
+      pInA += numColsA;
+
+      /* Decrement the row loop counter */
+      row--;
+    }
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    /* set status as ARM_MATH_SUCCESS */
+    status = ARM_MATH_SUCCESS;
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixMult group
+ */
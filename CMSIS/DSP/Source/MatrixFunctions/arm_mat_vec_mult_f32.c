@@ -0,0 +1,185 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_f32.c
+ * Description:  Floating-point matrix and vector multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixVectMult Matrix Vector Multiplication
+ *
+ * Multiplies a matrix and a vector.
+ *
+ * <pre>
+ *     y[i] = A(i,0) * x[0] + A(i,1) * x[1] + ... + A(i,numCols-1) * x[numCols-1]
+ * </pre>
+ *
+ * The vector <code>pVec</code> holds <code>numCols</code> samples and the output
+ * vector <code>pDst</code> holds <code>numRows</code> samples.
+ * The rows of the matrix are processed two at a time, so that every sample
+ * of the vector is loaded once for two outputs.
+ * Functions are provided for floating-point, Q31, Q15 and Q7 data types.
+ *
+ * \par
+ * The vectors have no size information, so no size checking is done
+ * and the functions do not return a status.
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Floating-point matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @return none.
+ */
+
+void arm_mat_vec_mult_f32(
+  const arm_matrix_instance_f32 * pSrcMat,
+  float32_t * pVec,
+  float32_t * pDst)
+{
+  float32_t *pInA1 = pSrcMat->pData;             /* first row of the matrix */
+  float32_t *pInVec;                             /* input vector pointer */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+  float32_t sum;                                 /* accumulator */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t *pInA2;                              /* second row of the matrix */
+  float32_t sum2;                                /* accumulator of the second row */
+  float32_t in;                                  /* vector sample */
+
+  /* Two rows are processed at a time */
+  row = (uint32_t) numRows >> 1U;
+
+  while (row > 0U)
+  {
+    pInA2 = pInA1 + numCols;
+    pInVec = pVec;
+    sum = 0.0f;
+    sum2 = 0.0f;
+
+    /* Loop unrolling */
+    colCnt = (uint32_t) numCols >> 2U;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] for two rows sharing the vector samples */
+      in = *pInVec++;
+      sum += *pInA1++ * in;
+      sum2 += *pInA2++ * in;
+
+      in = *pInVec++;
+      sum += *pInA1++ * in;
+      sum2 += *pInA2++ * in;
+
+      in = *pInVec++;
+      sum += *pInA1++ * in;
+      sum2 += *pInA2++ * in;
+
+      in = *pInVec++;
+      sum += *pInA1++ * in;
+      sum2 += *pInA2++ * in;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* If the number of columns is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    colCnt = (uint32_t) numCols % 0x4U;
+
+    while (colCnt > 0U)
+    {
+      in = *pInVec++;
+      sum += *pInA1++ * in;
+      sum2 += *pInA2++ * in;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Store the results in the destination buffer */
+    *pDst++ = sum;
+    *pDst++ = sum2;
+
+    /* Skip the second row */
+    pInA1 = pInA2;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Last row when the number of rows is odd */
+  row = (uint32_t) numRows & 1U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (row > 0U)
+  {
+    pInVec = pVec;
+    sum = 0.0f;
+    colCnt = numCols;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] */
+      sum += *pInA1++ * *pInVec++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Store the result in the destination buffer */
+    *pDst++ = sum;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,196 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q15.c
+ * Description:  Q15 matrix and vector multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q15 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator. The inputs to the
+ * multiplications are in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * This approach provides 33 guard bits and there is no risk of overflow. The 34.30 result
+ * is then truncated to 34.15 format by discarding the low 15 bits and then saturated to
+ * 1.15 format.
+ */
+
+void arm_mat_vec_mult_q15(
+  const arm_matrix_instance_q15 * pSrcMat,
+  q15_t * pVec,
+  q15_t * pDst)
+{
+  q15_t *pInA1 = pSrcMat->pData;                 /* first row of the matrix */
+  q15_t *pInVec;                                 /* input vector pointer */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+  q63_t sum;                                     /* accumulator */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q15_t *pInA2;                                  /* second row of the matrix */
+  q63_t sum2;                                    /* accumulator of the second row */
+
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+  q31_t inV;                                     /* two packed vector samples */
+
+#else
+
+  q15_t inV;                                     /* vector sample */
+
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
+  /* Two rows are processed at a time */
+  row = (uint32_t) numRows >> 1U;
+
+  while (row > 0U)
+  {
+    pInA2 = pInA1 + numCols;
+    pInVec = pVec;
+    sum = 0;
+    sum2 = 0;
+
+    /* Loop unrolling */
+    colCnt = (uint32_t) numCols >> 2U;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] for two rows sharing the vector samples */
+#ifndef UNALIGNED_SUPPORT_DISABLE
+
+      inV = *__SIMD32(pInVec)++;
+      sum = __SMLALD(*__SIMD32(pInA1)++, inV, sum);
+      sum2 = __SMLALD(*__SIMD32(pInA2)++, inV, sum2);
+
+      inV = *__SIMD32(pInVec)++;
+      sum = __SMLALD(*__SIMD32(pInA1)++, inV, sum);
+      sum2 = __SMLALD(*__SIMD32(pInA2)++, inV, sum2);
+
+#else
+
+      inV = *pInVec++;
+      sum += (q31_t) * pInA1++ * inV;
+      sum2 += (q31_t) * pInA2++ * inV;
+
+      inV = *pInVec++;
+      sum += (q31_t) * pInA1++ * inV;
+      sum2 += (q31_t) * pInA2++ * inV;
+
+      inV = *pInVec++;
+      sum += (q31_t) * pInA1++ * inV;
+      sum2 += (q31_t) * pInA2++ * inV;
+
+      inV = *pInVec++;
+      sum += (q31_t) * pInA1++ * inV;
+      sum2 += (q31_t) * pInA2++ * inV;
+
+#endif /* #ifndef UNALIGNED_SUPPORT_DISABLE */
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* If the number of columns is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    colCnt = (uint32_t) numCols % 0x4U;
+
+    while (colCnt > 0U)
+    {
+      sum += (q31_t) * pInA1++ * *pInVec;
+      sum2 += (q31_t) * pInA2++ * *pInVec++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Saturate and store the results in the destination buffer */
+    *pDst++ = (q15_t) __SSAT((sum >> 15), 16);
+    *pDst++ = (q15_t) __SSAT((sum2 >> 15), 16);
+
+    /* Skip the second row */
+    pInA1 = pInA2;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Last row when the number of rows is odd */
+  row = (uint32_t) numRows & 1U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (row > 0U)
+  {
+    pInVec = pVec;
+    sum = 0;
+    colCnt = numCols;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] */
+      sum += (q31_t) * pInA1++ * *pInVec++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Saturate and store the result in the destination buffer */
+    *pDst++ = (q15_t) __SSAT((sum >> 15), 16);
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q31.c
+ * Description:  Q31 matrix and vector multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q31 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using an internal 64-bit accumulator.
+ * The accumulator has a 2.62 format and maintains full precision of the intermediate
+ * multiplication results but provides only a single guard bit. There is no saturation
+ * on intermediate additions. Thus, if the accumulator overflows it wraps around and
+ * distorts the result. The input signals should be scaled down to avoid intermediate
+ * overflows. The 2.62 accumulator is right shifted by 31 bits and saturated to 1.31
+ * format to yield the final result.
+ */
+
+void arm_mat_vec_mult_q31(
+  const arm_matrix_instance_q31 * pSrcMat,
+  q31_t * pVec,
+  q31_t * pDst)
+{
+  q31_t *pInA1 = pSrcMat->pData;                 /* first row of the matrix */
+  q31_t *pInVec;                                 /* input vector pointer */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+  q63_t sum;                                     /* accumulator */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t *pInA2;                                  /* second row of the matrix */
+  q63_t sum2;                                    /* accumulator of the second row */
+  q31_t in;                                      /* vector sample */
+
+  /* Two rows are processed at a time */
+  row = (uint32_t) numRows >> 1U;
+
+  while (row > 0U)
+  {
+    pInA2 = pInA1 + numCols;
+    pInVec = pVec;
+    sum = 0;
+    sum2 = 0;
+
+    /* Loop unrolling */
+    colCnt = (uint32_t) numCols >> 2U;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] for two rows sharing the vector samples */
+      in = *pInVec++;
+      sum += (q63_t) * pInA1++ * in;
+      sum2 += (q63_t) * pInA2++ * in;
+
+      in = *pInVec++;
+      sum += (q63_t) * pInA1++ * in;
+      sum2 += (q63_t) * pInA2++ * in;
+
+      in = *pInVec++;
+      sum += (q63_t) * pInA1++ * in;
+      sum2 += (q63_t) * pInA2++ * in;
+
+      in = *pInVec++;
+      sum += (q63_t) * pInA1++ * in;
+      sum2 += (q63_t) * pInA2++ * in;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* If the number of columns is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    colCnt = (uint32_t) numCols % 0x4U;
+
+    while (colCnt > 0U)
+    {
+      in = *pInVec++;
+      sum += (q63_t) * pInA1++ * in;
+      sum2 += (q63_t) * pInA2++ * in;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the results from 2.62 to 1.31 format and store them in the destination buffer */
+    *pDst++ = clip_q63_to_q31(sum >> 31);
+    *pDst++ = clip_q63_to_q31(sum2 >> 31);
+
+    /* Skip the second row */
+    pInA1 = pInA2;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Last row when the number of rows is odd */
+  row = (uint32_t) numRows & 1U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (row > 0U)
+  {
+    pInVec = pVec;
+    sum = 0;
+    colCnt = numCols;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] */
+      sum += (q63_t) * pInA1++ * *pInVec++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Convert the result from 2.62 to 1.31 format and store it in the destination buffer */
+    *pDst++ = clip_q63_to_q31(sum >> 31);
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
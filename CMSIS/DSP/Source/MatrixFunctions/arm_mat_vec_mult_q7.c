@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_mat_vec_mult_q7.c
+ * Description:  Q7 matrix and vector multiplication
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixVectMult
+ * @{
+ */
+
+/**
+ * @brief Q7 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix structure
+ * @param[in]       *pVec points to the input vector
+ * @param[out]      *pDst points to the output vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 32-bit internal accumulator. The inputs to the
+ * multiplications are in 1.7 format and multiplications yield a 2.14 result.
+ * The 2.14 intermediate results are accumulated in a 32-bit accumulator in 18.14 format.
+ * Since <code>numCols</code> is at most 65535 there is no risk of overflow.
+ * The 18.14 result is then truncated to 18.7 format by discarding the low 7 bits
+ * and then saturated to 1.7 format.
+ *
+ * \par
+ * On Cortex-M3 and Cortex-M4 four samples are read at a time, widened in pairs
+ * with <code>__SXTB16</code> and accumulated with <code>__SMLAD</code>.
+ */
+
+void arm_mat_vec_mult_q7(
+  const arm_matrix_instance_q7 * pSrcMat,
+  q7_t * pVec,
+  q7_t * pDst)
+{
+  q7_t *pInA1 = pSrcMat->pData;                  /* first row of the matrix */
+  q7_t *pInVec;                                  /* input vector pointer */
+  uint16_t numRows = pSrcMat->numRows;           /* number of rows of the matrix */
+  uint16_t numCols = pSrcMat->numCols;           /* number of columns of the matrix */
+  uint32_t row, colCnt;                          /* loop counters */
+  q31_t sum;                                     /* accumulator */
+
+#if defined (ARM_MATH_DSP)
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q7_t *pInA2;                                   /* second row of the matrix */
+  q31_t sum2;                                    /* accumulator of the second row */
+  q31_t in;                                      /* four packed input samples */
+  q31_t inV1, inV2, inA1, inA2;                  /* sample pairs widened to 16 bits */
+
+  /* Two rows are processed at a time */
+  row = (uint32_t) numRows >> 1U;
+
+  while (row > 0U)
+  {
+    pInA2 = pInA1 + numCols;
+    pInVec = pVec;
+    sum = 0;
+    sum2 = 0;
+
+    /* Loop unrolling */
+    colCnt = (uint32_t) numCols >> 2U;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] for two rows sharing the vector samples */
+      /* Read four vector samples and widen them into two sample pairs */
+      in = *__SIMD32(pInVec)++;
+      inV1 = __SXTB16(__ROR(in, 8));
+      inV2 = __SXTB16(in);
+
+      /* Multiply and accumulate with the first row */
+      in = *__SIMD32(pInA1)++;
+      inA1 = __SXTB16(__ROR(in, 8));
+      inA2 = __SXTB16(in);
+      sum = __SMLAD(inA1, inV1, sum);
+      sum = __SMLAD(inA2, inV2, sum);
+
+      /* Multiply and accumulate with the second row */
+      in = *__SIMD32(pInA2)++;
+      inA1 = __SXTB16(__ROR(in, 8));
+      inA2 = __SXTB16(in);
+      sum2 = __SMLAD(inA1, inV1, sum2);
+      sum2 = __SMLAD(inA2, inV2, sum2);
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* If the number of columns is not a multiple of 4, compute any remaining samples here.
+     ** No loop unrolling is used. */
+    colCnt = (uint32_t) numCols % 0x4U;
+
+    while (colCnt > 0U)
+    {
+      sum += (q15_t) * pInA1++ * *pInVec;
+      sum2 += (q15_t) * pInA2++ * *pInVec++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Saturate and store the results in the destination buffer */
+    *pDst++ = (q7_t) __SSAT((sum >> 7), 8);
+    *pDst++ = (q7_t) __SSAT((sum2 >> 7), 8);
+
+    /* Skip the second row */
+    pInA1 = pInA2;
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+
+  /* Last row when the number of rows is odd */
+  row = (uint32_t) numRows & 1U;
+
+#else
+
+  /* Run the below code for Cortex-M0 */
+
+  row = numRows;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (row > 0U)
+  {
+    pInVec = pVec;
+    sum = 0;
+    colCnt = numCols;
+
+    while (colCnt > 0U)
+    {
+      /* y[i] += A(i,j) * x[j] */
+      sum += (q15_t) * pInA1++ * *pInVec++;
+
+      /* Decrement the loop counter */
+      colCnt--;
+    }
+
+    /* Saturate and store the result in the destination buffer */
+    *pDst++ = (q7_t) __SSAT((sum >> 7), 8);
+
+    /* Decrement the row loop counter */
+    row--;
+  }
+}
+
+/**
+ * @} end of MatrixVectMult group
+ */
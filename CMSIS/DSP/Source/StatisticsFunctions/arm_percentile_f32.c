@@ -0,0 +1,97 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_f32.c
+ * Description:  Percentile of a floating-point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup select
+ * @{
+ */
+
+
+/**
+ * @brief Percentile of a floating-point vector.
+ * @param[in,out]   *pSrc points to the input vector, reordered on return
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       fraction requested percentile as a fraction of one, in the range [0, 1]
+ * @param[out]      *pResult percentile value returned here
+ * @return none.
+ *
+ * \par
+ * The percentile is interpolated linearly between the samples of rank
+ * <code>floor(fraction*(blockSize-1))</code> and the next one.
+ * <code>fraction = 0.5</code> returns the median of the vector.
+ * An empty vector returns 0.
+ */
+
+void arm_percentile_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t fraction,
+  float32_t * pResult)
+{
+  float32_t pos, out, next;                      /* Temporary variables */
+  uint32_t k, i;                                 /* Rank and loop counter */
+
+  if (blockSize == 0U)
+  {
+    *pResult = 0.0f;
+    return;
+  }
+
+  /* Saturate the fraction to [0, 1] */
+  fraction = (fraction < 0.0f) ? 0.0f : ((fraction > 1.0f) ? 1.0f : fraction);
+
+  pos = fraction * (float32_t) (blockSize - 1U);
+  k = (uint32_t) pos;
+  pos -= (float32_t) k;
+
+  arm_select_f32(pSrc, blockSize, k, &out);
+
+  if ((pos > 0.0f) && ((k + 1U) < blockSize))
+  {
+    /* The next rank is the minimum of the samples placed after rank k */
+    next = pSrc[k + 1U];
+    for (i = k + 2U; i < blockSize; i++)
+    {
+      next = (pSrc[i] < next) ? pSrc[i] : next;
+    }
+
+    out += pos * (next - out);
+  }
+
+  *pResult = out;
+}
+
+/**
+ * @} end of select group
+ */
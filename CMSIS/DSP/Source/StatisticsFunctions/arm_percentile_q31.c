@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_percentile_q31.c
+ * Description:  Percentile of a Q31 vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup select
+ * @{
+ */
+
+
+/**
+ * @brief Percentile of a Q31 vector.
+ * @param[in,out]   *pSrc points to the input vector, reordered on return
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       fraction requested percentile as a fraction of one in 1.15 format
+ * @param[out]      *pResult percentile value returned here
+ * @return none.
+ *
+ * \par
+ * The percentile is interpolated linearly between the samples of rank
+ * <code>floor(fraction*(blockSize-1))</code> and the next one, and rounded to the nearest LSB.
+ * Negative fractions select the minimum. <code>fraction = 0x4000</code> returns the median of the vector.
+ * An empty vector returns 0.
+ */
+
+void arm_percentile_q31(
+  q31_t * pSrc,
+  uint32_t blockSize,
+  q15_t fraction,
+  q31_t * pResult)
+{
+  q31_t out, next;                               /* Temporary variables */
+  uint64_t pos;                                  /* Position in 17.15 format */
+  uint32_t k, i;                                 /* Rank and loop counter */
+  uint32_t frac;                                 /* Fractional part of the position */
+
+  if (blockSize == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Position of the percentile in 17.15 format, negative fractions select the minimum */
+  pos = (fraction > 0) ? ((uint64_t) fraction * (blockSize - 1U)) : 0U;
+  k = (uint32_t) (pos >> 15U);
+  frac = (uint32_t) pos & 0x7FFFU;
+
+  arm_select_q31(pSrc, blockSize, k, &out);
+
+  if ((frac != 0U) && ((k + 1U) < blockSize))
+  {
+    /* The next rank is the minimum of the samples placed after rank k */
+    next = pSrc[k + 1U];
+    for (i = k + 2U; i < blockSize; i++)
+    {
+      next = (pSrc[i] < next) ? pSrc[i] : next;
+    }
+
+    /* next >= out, so the rounded difference is not negative */
+    out += (q31_t) ((((q63_t) next - out) * frac + 0x4000) >> 15U);
+  }
+
+  *pResult = out;
+}
+
+/**
+ * @} end of select group
+ */
@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_select_f32.c
+ * Description:  k-th smallest value of a floating-point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup select Order Statistics
+ *
+ * Finds the k-th smallest value of the input vector, with <code>k</code> counted from zero.
+ * <code>k = 0</code> returns the minimum, <code>k = blockSize-1</code> the maximum and
+ * <code>k = blockSize/2</code> the median of an odd length vector.
+ *
+ * The functions use Hoare's selection algorithm with a median-of-three pivot:
+ * the vector is partitioned around the pivot and only the part which holds rank
+ * <code>k</code> is processed further. The average cost is linear in <code>blockSize</code>,
+ * against <code>blockSize*log2(blockSize)</code> for a full sort.
+ *
+ * The selection reorders the input vector in place. On return <code>pSrc[k]</code>
+ * holds the result, all samples before it are smaller or equal and all samples
+ * after it are larger or equal.
+ *
+ * The percentile functions are built on top of the selection. All versions
+ * interpolate linearly between the samples of rank <code>floor(fraction*(blockSize-1))</code>
+ * and the next one, the fixed-point versions rounding the interpolated value to
+ * the nearest output LSB. <code>fraction</code> one half thus returns the median of
+ * both odd and even length vectors.
+ *
+ * There are separate functions for floating-point, Q31, and Q15 data types.
+ */
+
+/**
+ * @addtogroup select
+ * @{
+ */
+
+
+/**
+ * @brief k-th smallest value of a floating-point vector.
+ * @param[in,out]   *pSrc points to the input vector, reordered on return
+ * @param[in]       blockSize length of the input vector
+ * @param[in]       k zero based rank of the requested value
+ * @param[out]      *pResult k-th smallest value returned here
+ * @return none.
+ *
+ * \par
+ * An empty vector returns 0. A rank <code>k</code> beyond the vector is saturated to <code>blockSize-1</code>.
+ */
+
+void arm_select_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  uint32_t k,
+  float32_t * pResult)
+{
+  float32_t pivot, in;                           /* Temporary variables */
+  int32_t left, right, mid, i, j;                /* Partition bounds */
+
+  if (blockSize == 0U)
+  {
+    *pResult = 0;
+    return;
+  }
+
+  /* Saturate the rank to the last sample */
+  k = (k < blockSize) ? k : (blockSize - 1U);
+
+  left = 0;
+  right = (int32_t) blockSize - 1;
+
+  while (left < right)
+  {
+    /* Order the first, middle and last samples and use the middle one as pivot */
+    mid = left + ((right - left) >> 1);
+
+    if (pSrc[mid] < pSrc[left])
+    {
+      in = pSrc[mid];
+      pSrc[mid] = pSrc[left];
+      pSrc[left] = in;
+    }
+    if (pSrc[right] < pSrc[left])
+    {
+      in = pSrc[right];
+      pSrc[right] = pSrc[left];
+      pSrc[left] = in;
+    }
+    if (pSrc[right] < pSrc[mid])
+    {
+      in = pSrc[right];
+      pSrc[right] = pSrc[mid];
+      pSrc[mid] = in;
+    }
+
+    pivot = pSrc[mid];
+    i = left;
+    j = right;
+
+    /* Partition, the outer samples act as sentinels of the scans */
+    do
+    {
+      while (pSrc[i] < pivot)
+      {
+        i++;
+      }
+      while (pivot < pSrc[j])
+      {
+        j--;
+      }
+
+      if (i <= j)
+      {
+        in = pSrc[i];
+        pSrc[i] = pSrc[j];
+        pSrc[j] = in;
+        i++;
+        j--;
+      }
+    } while (i <= j);
+
+    /* Continue in the part which holds rank k */
+    if (j < (int32_t) k)
+    {
+      left = i;
+    }
+    if ((int32_t) k < i)
+    {
+      right = j;
+    }
+  }
+
+  *pResult = pSrc[k];
+}
+
+/**
+ * @} end of select group
+ */
@@ -0,0 +1,208 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectral_features_f32.c
+ * Description:  Spectral centroid, rolloff, flux and flatness of a floating-point spectrum
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup SpectralFeatures Spectral Features
+ *
+ * Computes the audio descriptors of one frame from its magnitude or power spectrum
+ * <code>X[k]</code>, <code>0 <= k < numBins</code>, in a single read of the spectrum:
+ *
+ * <pre>
+ *    centroid = sum(k * X[k]) / (numBins * sum(X[k]))
+ *    rolloff  = r / numBins, with r the first bin for which X[0] + ... + X[r] >= rolloffRatio * sum(X[k])
+ *    flux     = sum((X[k] - Xprev[k])^2)
+ *    flatness = exp(mean(log(X[k]))) / mean(X[k])
+ * </pre>
+ *
+ * where <code>Xprev</code> is the spectrum passed to the previous call.
+ * Centroid and rolloff are returned as fractions of <code>numBins</code>, so that
+ * multiplying them by the frequency of bin <code>numBins</code> gives a frequency in Hz.
+ * The descriptors of an all zero spectrum are zero, with the exception of the flux.
+ *
+ * \par Algorithm
+ * All the sums are accumulated in the same loop over the bins. The loop copies the
+ * spectrum into the state buffer for the flux of the next frame, and records the running sum
+ * at 32 evenly spaced checkpoints. The rolloff bin is found by locating the
+ * checkpoint interval which crosses the threshold and scanning only that interval of
+ * the copy, so the rolloff costs at most <code>numBins/32</code> additional reads.
+ * The geometric mean of the flatness is computed as a running product whose exponent is
+ * moved to an integer accumulator after every bin, so that no logarithm is evaluated per bin.
+ *
+ * \par
+ * The time domain descriptors of the same frame are computed by <code>arm_zcr_energy_f32()</code>.
+ *
+ * \par Instance Structure
+ * The number of bins, the rolloff ratio and the spectrum of the previous frame are stored
+ * in an instance data structure. A separate instance structure must be defined for each stream.
+ * There are separate instance structure declarations for the floating-point and Q15 data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function checks the number of bins and zeros out the previous
+ * spectrum, so the flux of the first frame is the sum of its squared bins.
+ */
+
+/**
+ * @addtogroup SpectralFeatures
+ * @{
+ */
+
+/**
+ * @brief Computes the spectral descriptors of a floating-point spectrum.
+ * @param[in,out] *S points to an instance of the floating-point spectral features structure.
+ * @param[in]     *pSrc points to the magnitude or power spectrum, of length <code>numBins</code>.
+ * @param[out]    *pDesc points to the structure receiving the descriptors.
+ * @return none.
+ *
+ * \par
+ * The bins of the spectrum must not be negative.
+ */
+
+void arm_spectral_features_f32(
+  arm_spectral_features_instance_f32 * S,
+  float32_t * pSrc,
+  arm_spectral_desc_f32 * pDesc)
+{
+  float32_t *pState = S->pState;                 /* Previous spectrum, then copy of the current one */
+  float32_t cum[32];                             /* Running sum at the end of every checkpoint interval */
+  float32_t sum = 0.0f;                          /* Sum of the bins */
+  float32_t wsum = 0.0f;                         /* Sum of the bins weighted by their index */
+  float32_t flux = 0.0f;                         /* Sum of the squared differences */
+  float32_t in, diff, thr;                       /* Temporary variables */
+  union
+  {
+    float32_t f;
+    uint32_t u;
+  } prod;                                        /* Mantissa of the running product of the bins */
+  int32_t expSum = 0;                            /* Exponent of the running product of the bins */
+  uint32_t isZero = 0U;                          /* A bin is zero, the geometric mean is zero */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t step = (numBins + 31U) >> 5U;         /* Length of a checkpoint interval */
+  uint32_t k = 0U;                               /* Bin index */
+  uint32_t c = 0U;                               /* Checkpoint index */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  prod.f = 1.0f;
+
+  while (k < numBins)
+  {
+    /* Length of the checkpoint interval */
+    blkCnt = ((numBins - k) < step) ? (numBins - k) : step;
+
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+
+      /* Running sums of the centroid */
+      sum += in;
+      wsum += (float32_t) k * in;
+
+      /* Flux against the previous spectrum, which is replaced by the current one */
+      diff = in - *pState;
+      flux += diff * diff;
+      *pState++ = in;
+
+      /* Running product of the geometric mean, renormalized to [1, 2).
+         Bins below the smallest normal number are treated as zero */
+      if (in < 1.17549435e-38f)
+      {
+        isZero = 1U;
+      }
+      else
+      {
+        prod.f *= in;
+        expSum += (int32_t) ((prod.u >> 23U) & 0xFFU) - 127;
+        prod.u = (prod.u & 0x807FFFFFU) | 0x3F800000U;
+      }
+
+      k++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    cum[c++] = sum;
+  }
+
+  pDesc->flux = flux;
+
+  if (sum <= 0.0f)
+  {
+    pDesc->centroid = 0.0f;
+    pDesc->rolloff = 0.0f;
+    pDesc->flatness = 0.0f;
+    return;
+  }
+
+  pDesc->centroid = wsum / (sum * (float32_t) numBins);
+
+  /* Locate the checkpoint interval which crosses the rolloff threshold */
+  thr = S->rolloffRatio * sum;
+  c = 0U;
+  while ((c < ((numBins - 1U) / step)) && (cum[c] < thr))
+  {
+    c++;
+  }
+
+  /* Scan that interval in the copy of the spectrum */
+  k = c * step;
+  pState = S->pState + k;
+  in = (c > 0U) ? cum[c - 1U] : 0.0f;
+  while (k < (numBins - 1U))
+  {
+    in += *pState++;
+    if (in >= thr)
+    {
+      break;
+    }
+    k++;
+  }
+
+  pDesc->rolloff = (float32_t) k / (float32_t) numBins;
+
+  /* Geometric over arithmetic mean, evaluated in the log domain */
+  if (isZero != 0U)
+  {
+    pDesc->flatness = 0.0f;
+  }
+  else
+  {
+    in = (((float32_t) expSum * 0.693147181f) + logf(prod.f)) / (float32_t) numBins;
+    pDesc->flatness = expf(in - logf(sum / (float32_t) numBins));
+  }
+}
+
+/**
+ * @} end of SpectralFeatures group
+ */
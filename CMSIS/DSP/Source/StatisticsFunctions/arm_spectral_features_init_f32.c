@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectral_features_init_f32.c
+ * Description:  Floating-point spectral features initialization function
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SpectralFeatures
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the floating-point spectral features.
+ * @param[in,out] *S points to an instance of the floating-point spectral features structure.
+ * @param[in] numBins  number of bins of the spectrum.
+ * @param[in] rolloffRatio  share of the spectrum sum found up to the rolloff bin, typically 0.85.
+ * @param[in] *pState points to the previous spectrum buffer, of length <code>numBins</code>.
+ * @return    The function returns ARM_MATH_SUCCESS if initialization was successful or ARM_MATH_ARGUMENT_ERROR if
+ * <code>numBins</code> is zero.
+ */
+
+arm_status arm_spectral_features_init_f32(
+  arm_spectral_features_instance_f32 * S,
+  uint16_t numBins,
+  float32_t rolloffRatio,
+  float32_t * pState)
+{
+  arm_status status;
+
+  if (numBins == 0U)
+  {
+    /* Set status as ARM_MATH_ARGUMENT_ERROR */
+    status = ARM_MATH_ARGUMENT_ERROR;
+  }
+  else
+  {
+    /* Assign the number of bins and the rolloff ratio */
+    S->numBins = numBins;
+    S->rolloffRatio = rolloffRatio;
+
+    /* Clear the previous spectrum */
+    memset(pState, 0, numBins * sizeof(float32_t));
+
+    /* Assign state pointer */
+    S->pState = pState;
+
+    status = ARM_MATH_SUCCESS;
+  }
+
+  return (status);
+}
+
+/**
+ * @} end of SpectralFeatures group
+ */
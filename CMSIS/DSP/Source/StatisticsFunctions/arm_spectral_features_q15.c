@@ -0,0 +1,306 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_spectral_features_q15.c
+ * Description:  Spectral centroid, rolloff, flux and flatness of a Q15 spectrum
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SpectralFeatures
+ * @{
+ */
+
+/**
+ * @brief 2^(-2^-i) in 1.31 format, for i = 1..16.
+ */
+static const q31_t arm_spectral_exp2_tbl_q31[16] = {
+  0x5A82799A,  0x6BA27E65,  0x75606374,  0x7A92BE8B,
+  0x7D41D96E,  0x7E9F0606,  0x7F4F08AE,  0x7FA765AD,
+  0x7FD3AB29,  0x7FE9D3A9,  0x7FF4E959,  0x7FFA748E,
+  0x7FFD3A3F,  0x7FFE9D1E,  0x7FFF4E8E,  0x7FFFA747
+};
+
+/**
+ * @brief Multiplies the running product of the geometric mean by one bin.
+ * @param[in,out] *pProd mantissa of the product in 1.31 format, kept in [0.5, 1).
+ * @param[in,out] *pExp  base 2 exponent of the product.
+ * @param[in]     in     bin value, a zero bin clears the product for the rest of the spectrum.
+ */
+__STATIC_INLINE void arm_spectral_prod_q15(
+  q31_t * pProd,
+  int32_t * pExp,
+  q15_t in)
+{
+  q31_t m = in;
+  uint32_t shift;
+  q31_t p;
+
+  /* The geometric mean of a spectrum with a zero bin is zero */
+  if (m <= 0)
+  {
+    *pProd = 0;
+    return;
+  }
+  shift = (uint32_t) __CLZ((uint32_t) m) - 17U;
+
+  /* Normalize the bin to [0.5, 1) and multiply */
+  p = (q31_t) (((q63_t) *pProd * (m << shift)) >> 15);
+  *pExp -= (int32_t) shift;
+
+  /* The product is in [0.25, 1), renormalize it to [0.5, 1). A cleared product stays zero */
+  if (p < 0x40000000)
+  {
+    p <<= 1;
+    (*pExp)--;
+  }
+
+  *pProd = p;
+}
+
+/**
+ * @brief Base 2 logarithm of a positive integer, in 16.16 format.
+ */
+static q31_t arm_spectral_log2_q15(
+  uint32_t x)
+{
+  uint32_t n = 31U - (uint32_t) __CLZ(x);        /* Integer part */
+  uint32_t m;                                    /* Mantissa in [1, 2), 2.30 format */
+  q31_t y = (q31_t) (n << 16);
+  uint32_t i;
+
+  m = (n < 31U) ? (x << (30U - n)) : (x >> 1U);
+
+  /* One fractional bit per squaring of the mantissa */
+  for (i = 0U; i < 16U; i++)
+  {
+    m = (uint32_t) (((uint64_t) m * m) >> 30);
+    if (m >= 0x80000000U)
+    {
+      m >>= 1U;
+      y |= (q31_t) (0x8000U >> i);
+    }
+  }
+
+  return (y);
+}
+
+/**
+ * @brief Computes the spectral descriptors of a Q15 spectrum.
+ * @param[in,out] *S points to an instance of the Q15 spectral features structure.
+ * @param[in]     *pSrc points to the magnitude or power spectrum, of length <code>numBins</code>.
+ * @param[out]    *pDesc points to the structure receiving the descriptors.
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The bins of the spectrum are in 1.15 format and must not be negative.
+ * Centroid, rolloff and flatness are returned in 1.15 format, a flatness of 1 saturates to 0x7FFF.
+ * The flux is accumulated without saturation in a 64-bit accumulator and returned in 34.30 format,
+ * like the result of <code>arm_power_q15()</code>.
+ * The sums of the centroid use 32-bit and 64-bit accumulators which cannot overflow for the
+ * supported <code>numBins</code>.
+ * \par
+ * A spectrum with a bin equal to zero has a flatness of zero, like in <code>arm_spectral_features_f32()</code>.
+ */
+
+void arm_spectral_features_q15(
+  arm_spectral_features_instance_q15 * S,
+  q15_t * pSrc,
+  arm_spectral_desc_q15 * pDesc)
+{
+  q15_t *pState = S->pState;                     /* Previous spectrum, then copy of the current one */
+  q31_t cum[32];                                 /* Running sum at the end of every checkpoint interval */
+  q31_t sum = 0;                                 /* Sum of the bins */
+  q63_t wsum = 0;                                /* Sum of the bins weighted by their index */
+  q63_t flux = 0;                                /* Sum of the squared differences */
+  q31_t prod = 0x40000000;                       /* Mantissa of the running product of the bins */
+  int32_t expSum = 1;                            /* Exponent of the running product of the bins */
+  q31_t thr, lgGeo, lgMean, y;                   /* Temporary variables */
+  q15_t in, diff;                                /* Temporary variables */
+  uint32_t numBins = S->numBins;                 /* Number of bins */
+  uint32_t step = ((numBins + 63U) >> 6U) << 1U; /* Even length of a checkpoint interval */
+  uint32_t k = 0U;                               /* Bin index */
+  uint32_t c = 0U;                               /* Checkpoint index */
+  uint32_t len, blkCnt, i;                       /* Loop counters */
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in32, diff32, idx;                       /* Packed bins, differences and indexes */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (k < numBins)
+  {
+    /* Length of the checkpoint interval */
+    len = ((numBins - k) < step) ? (numBins - k) : step;
+
+#if defined (ARM_MATH_DSP)
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    /* Two bins at a time, with the pair of bin indexes packed in one word */
+    idx = (q31_t) __PKHBT(k, k + 1U, 16);
+    blkCnt = len >> 1U;
+
+    while (blkCnt > 0U)
+    {
+      in32 = *__SIMD32(pSrc)++;
+
+      /* Running sums of the centroid */
+      sum = __SMLAD(in32, 0x00010001, sum);
+      wsum = __SMLALD(idx, in32, wsum);
+
+      /* Flux against the previous spectrum, which is replaced by the current one */
+      diff32 = __QSUB16(in32, *__SIMD32(pState));
+      flux = __SMLALD(diff32, diff32, flux);
+      *__SIMD32(pState)++ = in32;
+
+      /* Running product of the geometric mean */
+      arm_spectral_prod_q15(&prod, &expSum, (q15_t) in32);
+      arm_spectral_prod_q15(&prod, &expSum, (q15_t) (in32 >> 16));
+
+      idx = __SADD16(idx, 0x00020002);
+      k += 2U;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* Odd number of bins in the last interval */
+    blkCnt = len & 1U;
+
+#else
+    /* Run the below code for Cortex-M0 */
+
+    blkCnt = len;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+      in = *pSrc++;
+
+      /* Running sums of the centroid */
+      sum += in;
+      wsum += (q31_t) k * in;
+
+      /* Flux against the previous spectrum, which is replaced by the current one */
+      diff = in - *pState;
+      flux += (q31_t) diff * diff;
+      *pState++ = in;
+
+      /* Running product of the geometric mean */
+      arm_spectral_prod_q15(&prod, &expSum, in);
+
+      k++;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    cum[c++] = sum;
+  }
+
+  /* Store the flux in 34.30 format */
+  pDesc->flux = flux;
+
+  if (sum <= 0)
+  {
+    pDesc->centroid = 0;
+    pDesc->rolloff = 0;
+    pDesc->flatness = 0;
+    return;
+  }
+
+  /* The index is below numBins, so the centroid is below one */
+  pDesc->centroid = (q15_t) ((wsum << 15) / ((q63_t) sum * numBins));
+
+  /* Locate the checkpoint interval which crosses the rolloff threshold */
+  thr = (q31_t) (((q63_t) sum * S->rolloffRatio) >> 15);
+  c = 0U;
+  while ((c < ((numBins - 1U) / step)) && (cum[c] < thr))
+  {
+    c++;
+  }
+
+  /* Scan that interval in the copy of the spectrum */
+  k = c * step;
+  pState = S->pState + k;
+  y = (c > 0U) ? cum[c - 1U] : 0;
+  while (k < (numBins - 1U))
+  {
+    y += *pState++;
+    if (y >= thr)
+    {
+      break;
+    }
+    k++;
+  }
+
+  pDesc->rolloff = (q15_t) ((k << 15) / numBins);
+
+  /* Geometric over arithmetic mean, zero when a bin is zero */
+  if (prod == 0)
+  {
+    pDesc->flatness = 0;
+    return;
+  }
+
+  /* Base 2 logarithms of the geometric and arithmetic means, in 16.16 format */
+  lgGeo = (q31_t) ((((q63_t) expSum * 65536) + arm_spectral_log2_q15((uint32_t) prod) - (31 << 16)) / (int32_t) numBins);
+  lgMean = arm_spectral_log2_q15((uint32_t) sum) - arm_spectral_log2_q15(numBins) - (15 << 16);
+
+  /* Flatness = 2^(lgGeo - lgMean), with lgGeo <= lgMean */
+  thr = (lgMean > lgGeo) ? (lgMean - lgGeo) : 0;
+  y = 0x7FFFFFFF;
+
+  if ((thr >> 16) > 30)
+  {
+    y = 0;
+  }
+  else
+  {
+    for (i = 0U; i < 16U; i++)
+    {
+      if ((thr & (0x8000 >> i)) != 0)
+      {
+        y = (q31_t) (((q63_t) y * arm_spectral_exp2_tbl_q31[i]) >> 31);
+      }
+    }
+    y >>= (thr >> 16);
+  }
+
+  /* Round to 1.15 format */
+  pDesc->flatness = (q15_t) __SSAT(((y >> 15) + 1) >> 1, 16);
+}
+
+/**
+ * @} end of SpectralFeatures group
+ */
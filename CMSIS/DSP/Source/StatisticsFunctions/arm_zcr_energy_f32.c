@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_zcr_energy_f32.c
+ * Description:  Zero-crossing rate and energy of a floating-point frame
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup ZcrEnergy Zero-Crossing Rate and Energy
+ *
+ * Computes the time domain descriptors of an audio frame in one read of the samples:
+ *
+ * <pre>
+ *    zcr    = (number of n with sign(x[n]) != sign(x[n-1])) / (blockSize - 1)
+ *    energy = x[0] * x[0] + x[1] * x[1] + ... + x[blockSize-1] * x[blockSize-1]
+ * </pre>
+ *
+ * Zero is counted as a positive sample. The energy is the result of the power functions.
+ * The spectral descriptors of the same frame are computed by the SpectralFeatures functions.
+ *
+ * There are separate functions for floating point and Q15 data types.
+ */
+
+/**
+ * @addtogroup ZcrEnergy
+ * @{
+ */
+
+/**
+ * @brief Zero-crossing rate and energy of a floating-point vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pZcr zero-crossing rate returned here
+ * @param[out]      *pEnergy sum of the squares value returned here
+ * @return none.
+ *
+ */
+
+void arm_zcr_energy_f32(
+  float32_t * pSrc,
+  uint32_t blockSize,
+  float32_t * pZcr,
+  float32_t * pEnergy)
+{
+  float32_t sum = 0.0f;                          /* Accumulator */
+  float32_t in;                                  /* Temporary variable to store input value */
+  uint32_t sign, prev;                           /* Sign of the current and previous samples */
+  uint32_t count = 0U;                           /* Number of sign changes */
+  uint32_t blkCnt;                               /* Loop counter */
+
+  if (blockSize == 0U)
+  {
+    *pZcr = 0.0f;
+    *pEnergy = 0.0f;
+    return;
+  }
+
+  /* The first sample has no predecessor */
+  prev = (*pSrc < 0.0f) ? 1U : 0U;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Accumulate the squares and count the sign changes */
+    in = *pSrc++;
+    sum += in * in;
+    sign = (in < 0.0f) ? 1U : 0U;
+    count += sign ^ prev;
+    in = *pSrc++;
+    sum += in * in;
+    prev = (in < 0.0f) ? 1U : 0U;
+    count += sign ^ prev;
+    in = *pSrc++;
+    sum += in * in;
+    sign = (in < 0.0f) ? 1U : 0U;
+    count += sign ^ prev;
+    in = *pSrc++;
+    sum += in * in;
+    prev = (in < 0.0f) ? 1U : 0U;
+    count += sign ^ prev;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Accumulate the squares and count the sign changes */
+    in = *pSrc++;
+    sum += in * in;
+    sign = (in < 0.0f) ? 1U : 0U;
+    count += sign ^ prev;
+    prev = sign;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Normalize the count by the number of sample pairs */
+  *pZcr = (blockSize > 1U) ? ((float32_t) count / (float32_t) (blockSize - 1U)) : 0.0f;
+  *pEnergy = sum;
+}
+
+/**
+ * @} end of ZcrEnergy group
+ */
@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_zcr_energy_q15.c
+ * Description:  Zero-crossing rate and energy of a Q15 frame
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup ZcrEnergy
+ * @{
+ */
+
+/**
+ * @brief Zero-crossing rate and energy of a Q15 vector.
+ * @param[in]       *pSrc points to the input vector
+ * @param[in]       blockSize length of the input vector
+ * @param[out]      *pZcr zero-crossing rate returned here
+ * @param[out]      *pEnergy sum of the squares value returned here
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * The zero-crossing rate is returned in 1.15 format, a rate of 1 saturates to 0x7FFF.
+ * The energy is computed like <code>arm_power_q15()</code>, in a 64-bit accumulator
+ * without risk of overflow, and returned in 34.30 format.
+ * \par
+ * On cores with DSP extension two sign changes are detected per word by an exclusive or
+ * of the packed samples with the same samples delayed by one.
+ */
+
+void arm_zcr_energy_q15(
+  q15_t * pSrc,
+  uint32_t blockSize,
+  q15_t * pZcr,
+  q63_t * pEnergy)
+{
+  q63_t sum = 0;                                 /* Temporary result storage */
+  q15_t in;                                      /* Temporary variable to store input value */
+  q15_t prev;                                    /* Previous sample */
+  uint32_t count = 0U;                           /* Number of sign changes */
+  uint32_t blkCnt;                               /* Loop counter */
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  q31_t in32;                                    /* Packed samples */
+  uint32_t diff;                                 /* Sign changes in bits 15 and 31 */
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  if (blockSize == 0U)
+  {
+    *pZcr = 0;
+    *pEnergy = 0;
+    return;
+  }
+
+  /* The first sample has no predecessor */
+  prev = *pSrc;
+
+#if defined (ARM_MATH_DSP)
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  /* loop Unrolling */
+  blkCnt = blockSize >> 2U;
+
+  /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+   ** a second loop below computes the remaining 1 to 3 samples. */
+  while (blkCnt > 0U)
+  {
+    /* Accumulate the squares of x[n], x[n+1] and compare their signs
+       with the ones of x[n-1], x[n] */
+    in32 = *__SIMD32(pSrc)++;
+    sum = __SMLALD(in32, in32, sum);
+    diff = (uint32_t) (in32 ^ __PKHBT(prev, in32, 16));
+    count += ((diff >> 15U) & 1U) + (diff >> 31U);
+    prev = (q15_t) (in32 >> 16);
+
+    in32 = *__SIMD32(pSrc)++;
+    sum = __SMLALD(in32, in32, sum);
+    diff = (uint32_t) (in32 ^ __PKHBT(prev, in32, 16));
+    count += ((diff >> 15U) & 1U) + (diff >> 31U);
+    prev = (q15_t) (in32 >> 16);
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+   ** No loop unrolling is used. */
+  blkCnt = blockSize % 0x4U;
+
+#else
+  /* Run the below code for Cortex-M0 */
+
+  /* Loop over blockSize number of values */
+  blkCnt = blockSize;
+
+#endif /* #if defined (ARM_MATH_DSP) */
+
+  while (blkCnt > 0U)
+  {
+    /* Accumulate the squares and count the sign changes */
+    in = *pSrc++;
+    sum += ((q31_t) in * in);
+    count += ((uint32_t) (uint16_t) (in ^ prev)) >> 15U;
+    prev = in;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Normalize the count by the number of sample pairs, in 1.15 format */
+  *pZcr = (blockSize > 1U) ? (q15_t) __SSAT((q31_t) (((uint64_t) count << 15) / (blockSize - 1U)), 16) : 0;
+
+  /* Store the energy in 34.30 format */
+  *pEnergy = sum;
+}
+
+/**
+ * @} end of ZcrEnergy group
+ */
@@ -0,0 +1,257 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_f32.c
+ * Description:  Sorts the elements of a floating-point vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @defgroup Sort Vector Sort
+ *
+ * Sorts the elements of a vector in ascending or descending order.
+ *
+ * The sort is done in two stages. The input is first cut into runs of
+ * 8 samples which are ordered by an optimal 19 compare-exchange sorting network,
+ * built from the <code>arm_cmp_exch_xxx()</code> primitives. On cores with DSP
+ * extension the Q15 version evaluates two networks at once on packed halfwords
+ * with <code>arm_cmp_exch_q15x2()</code>.
+ * The runs are then combined by bottom-up merge passes which alternate between
+ * the output vector and the scratch buffer of the instance, so that the last
+ * pass always ends in the output vector.
+ *
+ * \par Instance Structure
+ * The sort direction and the scratch buffer are stored in an instance data structure.
+ * The scratch buffer holds <code>blockSize</code> samples.
+ * There are separate instance structure declarations and initialization functions
+ * for floating-point, Q31, and Q15 data types.
+ *
+ * \par
+ * The input and output vectors may be the same buffer.
+ * The scratch buffer must not overlap with either of them.
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief Merges two sorted floating-point runs.
+ */
+static void arm_sort_merge_f32(
+  float32_t * pA,
+  uint32_t lenA,
+  float32_t * pB,
+  uint32_t lenB,
+  float32_t * pOut)
+{
+  float32_t a, b;
+
+  if ((lenA > 0U) && (lenB > 0U))
+  {
+    a = *pA;
+    b = *pB;
+
+    while (1)
+    {
+      if (b < a)
+      {
+        *pOut++ = b;
+        if (--lenB == 0U)
+        {
+          break;
+        }
+        b = *++pB;
+      }
+      else
+      {
+        *pOut++ = a;
+        if (--lenA == 0U)
+        {
+          break;
+        }
+        a = *++pA;
+      }
+    }
+
+    /* Skip the head of the run which was consumed last */
+    if (lenA == 0U)
+    {
+      pA = pB;
+      lenA = lenB;
+    }
+  }
+  else if (lenA == 0U)
+  {
+    pA = pB;
+    lenA = lenB;
+  }
+
+  /* Copy the remaining samples */
+  while (lenA > 0U)
+  {
+    *pOut++ = *pA++;
+    lenA--;
+  }
+}
+
+/**
+ * @brief Sorts a floating-point vector.
+ * @param[in]       *S points to an instance of the sort structure.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the sorted output vector
+ * @param[in]       blockSize length of the vectors
+ * @return none.
+ */
+
+void arm_sort_f32(
+  const arm_sort_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t x[8];                                /* Samples of the run ordered by the network */
+  float32_t *pIn, *pOut, *pTmp;                  /* Ping-pong pointers of the merge passes */
+  float32_t in;                                  /* Temporary variable */
+  uint32_t width, passes;                        /* Run length and number of merge passes */
+  uint32_t blkCnt, i, j;                         /* Loop counters */
+
+  /* Count the merge passes which follow the sorting network stage */
+  passes = 0U;
+  for (width = 8U; width < blockSize; width <<= 1U)
+  {
+    passes++;
+  }
+
+  /* Start in the buffer which makes the last merge pass end in pDst */
+  pOut = ((passes & 1U) != 0U) ? S->pBuffer : pDst;
+
+  /* Sort runs of 8 samples with the sorting network */
+  blkCnt = blockSize >> 3U;
+  pIn = pSrc;
+  pTmp = pOut;
+
+  while (blkCnt > 0U)
+  {
+    for (i = 0U; i < 8U; i++)
+    {
+      x[i] = pIn[i];
+    }
+
+    arm_cmp_exch_f32(&x[0], &x[2]);
+    arm_cmp_exch_f32(&x[1], &x[3]);
+    arm_cmp_exch_f32(&x[4], &x[6]);
+    arm_cmp_exch_f32(&x[5], &x[7]);
+    arm_cmp_exch_f32(&x[0], &x[4]);
+    arm_cmp_exch_f32(&x[1], &x[5]);
+    arm_cmp_exch_f32(&x[2], &x[6]);
+    arm_cmp_exch_f32(&x[3], &x[7]);
+    arm_cmp_exch_f32(&x[0], &x[1]);
+    arm_cmp_exch_f32(&x[2], &x[3]);
+    arm_cmp_exch_f32(&x[4], &x[5]);
+    arm_cmp_exch_f32(&x[6], &x[7]);
+    arm_cmp_exch_f32(&x[2], &x[4]);
+    arm_cmp_exch_f32(&x[3], &x[5]);
+    arm_cmp_exch_f32(&x[1], &x[4]);
+    arm_cmp_exch_f32(&x[3], &x[6]);
+    arm_cmp_exch_f32(&x[1], &x[2]);
+    arm_cmp_exch_f32(&x[3], &x[4]);
+    arm_cmp_exch_f32(&x[5], &x[6]);
+
+    for (i = 0U; i < 8U; i++)
+    {
+      pTmp[i] = x[i];
+    }
+
+    pIn += 8U;
+    pTmp += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Insertion sort of the last, incomplete run */
+  blkCnt = blockSize % 0x8U;
+
+  for (i = 0U; i < blkCnt; i++)
+  {
+    in = pIn[i];
+    for (j = i; (j > 0U) && (in < pTmp[j - 1U]); j--)
+    {
+      pTmp[j] = pTmp[j - 1U];
+    }
+    pTmp[j] = in;
+  }
+
+  /* Bottom-up merge passes, doubling the run length every time */
+  pIn = pOut;
+  pOut = (pIn == pDst) ? S->pBuffer : pDst;
+
+  for (width = 8U; width < blockSize; width <<= 1U)
+  {
+    for (i = 0U; i < blockSize; i += 2U * width)
+    {
+      if ((blockSize - i) <= width)
+      {
+        arm_sort_merge_f32(pIn + i, blockSize - i, pIn, 0U, pOut + i);
+      }
+      else
+      {
+        arm_sort_merge_f32(pIn + i, width, pIn + i + width,
+                           ((blockSize - i - width) < width) ? (blockSize - i - width) : width,
+                           pOut + i);
+      }
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* Reverse the ascending result for a descending sort */
+  if (S->dir == ARM_SORT_DESCENDING)
+  {
+    i = 0U;
+    j = blockSize;
+
+    while (j > (i + 1U))
+    {
+      j--;
+      in = pDst[i];
+      pDst[i] = pDst[j];
+      pDst[j] = in;
+      i++;
+    }
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
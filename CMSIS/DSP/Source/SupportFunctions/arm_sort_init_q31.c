@@ -0,0 +1,67 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_init_q31.c
+ * Description:  Initialization function for the Q31 sort
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+  /**
+   * @brief  Initialization function for the Q31 sort.
+   * @param[in,out] *S             points to an instance of the Q31 sort structure.
+   * @param[in]     dir            sort direction.
+   * @param[in]     *pBuffer       points to the scratch buffer.
+   * @return        none
+   *
+   * <b>Description:</b>
+   * \par
+   * <code>pBuffer</code> points to a scratch buffer of <code>blockSize</code> samples,
+   * where <code>blockSize</code> is the largest vector length passed to <code>arm_sort_q31()</code>.
+   */
+
+void arm_sort_init_q31(
+  arm_sort_instance_q31 * S,
+  arm_sort_dir dir,
+  q31_t * pBuffer)
+{
+  /* Assign sort direction */
+  S->dir = dir;
+
+  /* Assign scratch buffer pointer */
+  S->pBuffer = pBuffer;
+}
+
+/**
+ * @} end of Sort group
+ */
@@ -0,0 +1,232 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_sort_q31.c
+ * Description:  Sorts the elements of a Q31 vector
+ *
+ * $Date:        18. October 2026
+ * $Revision:    V.1.5.3
+ *
+ * Target Processor: Cortex-M cores
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2010-2018 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupSupport
+ */
+
+/**
+ * @addtogroup Sort
+ * @{
+ */
+
+/**
+ * @brief Merges two sorted Q31 runs.
+ */
+static void arm_sort_merge_q31(
+  q31_t * pA,
+  uint32_t lenA,
+  q31_t * pB,
+  uint32_t lenB,
+  q31_t * pOut)
+{
+  q31_t a, b;
+
+  if ((lenA > 0U) && (lenB > 0U))
+  {
+    a = *pA;
+    b = *pB;
+
+    while (1)
+    {
+      if (b < a)
+      {
+        *pOut++ = b;
+        if (--lenB == 0U)
+        {
+          break;
+        }
+        b = *++pB;
+      }
+      else
+      {
+        *pOut++ = a;
+        if (--lenA == 0U)
+        {
+          break;
+        }
+        a = *++pA;
+      }
+    }
+
+    /* Skip the head of the run which was consumed last */
+    if (lenA == 0U)
+    {
+      pA = pB;
+      lenA = lenB;
+    }
+  }
+  else if (lenA == 0U)
+  {
+    pA = pB;
+    lenA = lenB;
+  }
+
+  /* Copy the remaining samples */
+  while (lenA > 0U)
+  {
+    *pOut++ = *pA++;
+    lenA--;
+  }
+}
+
+/**
+ * @brief Sorts a Q31 vector.
+ * @param[in]       *S points to an instance of the sort structure.
+ * @param[in]       *pSrc points to the input vector
+ * @param[out]      *pDst points to the sorted output vector
+ * @param[in]       blockSize length of the vectors
+ * @return none.
+ */
+
+void arm_sort_q31(
+  const arm_sort_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t x[8];                                    /* Samples of the run ordered by the network */
+  q31_t *pIn, *pOut, *pTmp;                      /* Ping-pong pointers of the merge passes */
+  q31_t in;                                      /* Temporary variable */
+  uint32_t width, passes;                        /* Run length and number of merge passes */
+  uint32_t blkCnt, i, j;                         /* Loop counters */
+
+  /* Count the merge passes which follow the sorting network stage */
+  passes = 0U;
+  for (width = 8U; width < blockSize; width <<= 1U)
+  {
+    passes++;
+  }
+
+  /* Start in the buffer which makes the last merge pass end in pDst */
+  pOut = ((passes & 1U) != 0U) ? S->pBuffer : pDst;
+
+  /* Sort runs of 8 samples with the sorting network */
+  blkCnt = blockSize >> 3U;
+  pIn = pSrc;
+  pTmp = pOut;
+
+  while (blkCnt > 0U)
+  {
+    for (i = 0U; i < 8U; i++)
+    {
+      x[i] = pIn[i];
+    }
+
+    arm_cmp_exch_q31(&x[0], &x[2]);
+    arm_cmp_exch_q31(&x[1], &x[3]);
+    arm_cmp_exch_q31(&x[4], &x[6]);
+    arm_cmp_exch_q31(&x[5], &x[7]);
+    arm_cmp_exch_q31(&x[0], &x[4]);
+    arm_cmp_exch_q31(&x[1], &x[5]);
+    arm_cmp_exch_q31(&x[2], &x[6]);
+    arm_cmp_exch_q31(&x[3], &x[7]);
+    arm_cmp_exch_q31(&x[0], &x[1]);
+    arm_cmp_exch_q31(&x[2], &x[3]);
+    arm_cmp_exch_q31(&x[4], &x[5]);
+    arm_cmp_exch_q31(&x[6], &x[7]);
+    arm_cmp_exch_q31(&x[2], &x[4]);
+    arm_cmp_exch_q31(&x[3], &x[5]);
+    arm_cmp_exch_q31(&x[1], &x[4]);
+    arm_cmp_exch_q31(&x[3], &x[6]);
+    arm_cmp_exch_q31(&x[1], &x[2]);
+    arm_cmp_exch_q31(&x[3], &x[4]);
+    arm_cmp_exch_q31(&x[5], &x[6]);
+
+    for (i = 0U; i < 8U; i++)
+    {
+      pTmp[i] = x[i];
+    }
+
+    pIn += 8U;
+    pTmp += 8U;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Insertion sort of the last, incomplete run */
+  blkCnt = blockSize % 0x8U;
+
+  for (i = 0U; i < blkCnt; i++)
+  {
+    in = pIn[i];
+    for (j = i; (j > 0U) && (in < pTmp[j - 1U]); j--)
+    {
+      pTmp[j] = pTmp[j - 1U];
+    }
+    pTmp[j] = in;
+  }
+
+  /* Bottom-up merge passes, doubling the run length every time */
+  pIn = pOut;
+  pOut = (pIn == pDst) ? S->pBuffer : pDst;
+
+  for (width = 8U; width < blockSize; width <<= 1U)
+  {
+    for (i = 0U; i < blockSize; i += 2U * width)
+    {
+      if ((blockSize - i) <= width)
+      {
+        arm_sort_merge_q31(pIn + i, blockSize - i, pIn, 0U, pOut + i);
+      }
+      else
+      {
+        arm_sort_merge_q31(pIn + i, width, pIn + i + width,
+                           ((blockSize - i - width) < width) ? (blockSize - i - width) : width,
+                           pOut + i);
+      }
+    }
+
+    pTmp = pIn;
+    pIn = pOut;
+    pOut = pTmp;
+  }
+
+  /* Reverse the ascending result for a descending sort */
+  if (S->dir == ARM_SORT_DESCENDING)
+  {
+    i = 0U;
+    j = blockSize;
+
+    while (j > (i + 1U))
+    {
+      j--;
+      in = pDst[i];
+      pDst[i] = pDst[j];
+      pDst[j] = in;
+      i++;
+    }
+  }
+}
+
+/**
+ * @} end of Sort group
+ */
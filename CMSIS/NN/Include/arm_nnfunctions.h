@@ -818,6 +818,15 @@ extern    "C"
 	 * @param[in,out]   vec_buffer  pointer to buffer space for input
 	 * @return     The function returns <code>ARM_MATH_SUCCESS</code>
 	 *
+	 * @details
+	 *
+	 * Unlike arm_fully_connected_q7, pM is row-interleaved: for each pair of
+	 * rows, 4 bytes of the first row are followed by the 4 bytes at the same
+	 * columns of the second row, then the leftover bytes of the first and of
+	 * the second row. An odd last row is stored in order. Weights stored
+	 * row by row must be repacked with convert_to_interleaved_uint8_weights
+	 * in fully_connected_opt_weight_generation.py.
+	 *
 	 */
     arm_status arm_fully_connected_asym_uint8(const uint8_t * pV,
                                const uint8_t * pM,
@@ -1106,6 +1115,17 @@ extern    "C"
 								const int16_t * pThreshold,
 								int8_t * bufferB);
 
+  /**
+   * @brief INT2 convolution function
+   *
+   * The weights wt are packed 4xINT2 per byte, first weight in the LSBs, and
+   * row-interleaved: for each pair of output channels, one 32-bit word
+   * (16xINT2) of the first row is followed by the word at the same column
+   * of the second row. Pack them with convert_to_interleaved_int2_weights
+   * in fully_connected_opt_weight_generation.py; weights stored row by row
+   * must be repacked. See arm_convolve_HWC_int2.c for the parameters.
+   */
+
     arm_status arm_convolve_HWC_int2(
     							const int8_t * Im_in,
                                 const uint16_t dim_im_in,
@@ -1121,6 +1141,17 @@ extern    "C"
                                 const int16_t * pThreshold,
                                 int8_t * bufferB);
 
+  /**
+   * @brief INT4 convolution function
+   *
+   * The weights wt are packed 2xINT4 per byte, first weight in the LSBs, and
+   * row-interleaved: for each pair of output channels, one 32-bit word
+   * (8xINT4) of the first row is followed by the word at the same column
+   * of the second row. Pack them with convert_to_interleaved_int4_weights
+   * in fully_connected_opt_weight_generation.py; weights stored row by row
+   * must be repacked. See arm_convolve_HWC_int4.c for the parameters.
+   */
+
     arm_status arm_convolve_HWC_int4(
     							const int8_t * Im_in,
                                 const uint16_t dim_im_in,
@@ -1136,6 +1167,36 @@ extern    "C"
                                 const int16_t * pThreshold,
                                 int8_t * bufferB);
 
+    arm_status arm_convolve_HWC_int2_RGB(
+    							const int8_t * Im_in,
+                                const uint16_t dim_im_in,
+                                const uint16_t ch_im_in,
+                                const int8_t * wt,
+                                const uint16_t ch_im_out,
+                                const uint16_t dim_kernel,
+                                const uint16_t padding,
+                                const uint16_t stride,
+                                int8_t * Im_out,
+                                const uint16_t dim_im_out,
+                                int16_t * bufferA,
+                                const int16_t * pThreshold,
+                                int8_t * bufferB);
+
+    arm_status arm_convolve_HWC_int4_RGB(
+    							const int8_t * Im_in,
+                                const uint16_t dim_im_in,
+                                const uint16_t ch_im_in,
+                                const int8_t * wt,
+                                const uint16_t ch_im_out,
+                                const uint16_t dim_kernel,
+                                const uint16_t padding,
+                                const uint16_t stride,
+                                int8_t * Im_out,
+                                const uint16_t dim_im_out,
+                                int16_t * bufferA,
+                                const int16_t * pThreshold,
+                                int8_t * bufferB);
+
     int8_t *arm_nn_mat_mult_kernel_int2_int16_reordered(
     							const int8_t * pA,
 								const int16_t * pInBuffer,
@@ -1185,6 +1246,18 @@ extern    "C"
 								int16_t * bufferA,
 								uint8_t * bufferB);
 
+  /**
+   * @brief Asymmetric UINT8 convolution function
+   *
+   * The weights wt are row-interleaved: for each pair of output channels,
+   * 4 bytes of the first row are followed by the 4 bytes at the same columns
+   * of the second row, then the leftover bytes of the first and of the
+   * second row. An odd last row is stored in order. Pack them with
+   * convert_to_interleaved_uint8_weights in fully_connected_opt_weight_generation.py;
+   * weights stored row by row must be repacked. See arm_convolve_HWC_asym_uint8.c
+   * for the parameters.
+   */
+
     arm_status arm_convolve_HWC_asym_uint8(
     							const uint8_t * Im_in,
 								const uint16_t dim_im_in,
@@ -1208,6 +1281,29 @@ extern    "C"
 								int16_t * bufferA,
 								uint8_t * bufferB);
 
+    arm_status arm_convolve_HWC_asym_uint8_RGB(
+    							const uint8_t * Im_in,
+								const uint16_t dim_im_in,
+								const uint16_t ch_im_in,
+								const uint8_t * wt,
+								const uint8_t z_wt,
+								const uint8_t z_in,
+								const uint8_t z_out,
+								const int32_t m_zero,
+								const uint16_t n_zero,
+								const uint16_t ch_im_out,
+								const uint16_t dim_kernel,
+								const uint8_t left_padding,
+								const uint8_t right_padding,
+								const uint8_t top_padding,
+								const uint8_t bottom_padding,
+								const uint16_t stride,
+								const int32_t * bias,
+								uint8_t * Im_out,
+								const uint16_t dim_im_out,
+								int16_t * bufferA,
+								uint8_t * bufferB);
+
     arm_status arm_depthwise_separable_conv_HWC_asym_uint8(
 								const uint8_t * Im_in,
 								const uint16_t dim_im_in,
@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+/*
+ * Sub-byte tensors pack 8/bits values per byte, first value in the LSBs.
+ * The output is the number of thresholds of the channel the sum is above,
+ * offset to signed, which matches the tree search of the optimized kernels
+ * for ascending thresholds.
+ */
+static void arm_convolve_HWC_intq_ref(const int8_t * Im_in,  // packed input image
+                                      const uint16_t dim_im_in, // input image dimention
+                                      const uint16_t ch_im_in,  // number of input image channels
+                                      const q7_t * wt,  // kernel weights, one per byte, row by row
+                                      const uint16_t ch_im_out, // number of filters, i.e., output image channels
+                                      const uint16_t dim_kernel,    // filter kernel size
+                                      const uint16_t padding,   // padding sizes
+                                      const uint16_t stride,    // stride
+                                      int8_t * Im_out,  // packed output image
+                                      const uint16_t dim_im_out,    // output image dimension
+                                      const int16_t * pThreshold,   // 2^bits thresholds per channel
+                                      const uint16_t bits)  // 4 for INT4, 2 for INT2
+{
+    int       i, j, k, l, m, n, t;
+    int32_t   conv_out;
+    int       in_row, in_col, idx, q;
+    int       per_byte = 8 / bits;
+    int       mask = (1 << bits) - 1;
+
+    for (i = 0; i < ch_im_out; i++)
+    {
+        for (j = 0; j < dim_im_out; j++)
+        {
+            for (k = 0; k < dim_im_out; k++)
+            {
+                conv_out = 0;
+                for (m = 0; m < dim_kernel; m++)
+                {
+                    for (n = 0; n < dim_kernel; n++)
+                    {
+                        in_row = stride * j + m - padding;
+                        in_col = stride * k + n - padding;
+                        if (in_row >= 0 && in_col >= 0 && in_row < dim_im_in && in_col < dim_im_in)
+                        {
+                            for (l = 0; l < ch_im_in; l++)
+                            {
+                                idx = (in_row * dim_im_in + in_col) * ch_im_in + l;
+                                // sign-extend the sub-byte value
+                                int8_t    in = (int8_t) ((uint8_t) Im_in[idx / per_byte] << (8 - bits - (idx % per_byte) * bits)) >> (8 - bits);
+                                conv_out += in * wt[i * ch_im_in * dim_kernel * dim_kernel + (m * dim_kernel + n) * ch_im_in + l];
+                            }
+                        }
+                    }
+                }
+                q = -(1 << (bits - 1));
+                for (t = 0; t < mask; t++)
+                {
+                    if ((int16_t) conv_out > pThreshold[(i << bits) + t])
+                    {
+                        q++;
+                    }
+                }
+                idx = i + (j * dim_im_out + k) * ch_im_out;
+                Im_out[idx / per_byte] = (int8_t) ((Im_out[idx / per_byte] & ~(mask << ((idx % per_byte) * bits)))
+                                                   | ((q & mask) << ((idx % per_byte) * bits)));
+            }
+        }
+    }
+}
+
+void arm_convolve_HWC_int4_ref(const int8_t * Im_in, const uint16_t dim_im_in, const uint16_t ch_im_in,
+                               const q7_t * wt, const uint16_t ch_im_out, const uint16_t dim_kernel,
+                               const uint16_t padding, const uint16_t stride, int8_t * Im_out,
+                               const uint16_t dim_im_out, const int16_t * pThreshold)
+{
+    arm_convolve_HWC_intq_ref(Im_in, dim_im_in, ch_im_in, wt, ch_im_out, dim_kernel, padding, stride,
+                              Im_out, dim_im_out, pThreshold, 4);
+}
+
+void arm_convolve_HWC_int2_ref(const int8_t * Im_in, const uint16_t dim_im_in, const uint16_t ch_im_in,
+                               const q7_t * wt, const uint16_t ch_im_out, const uint16_t dim_kernel,
+                               const uint16_t padding, const uint16_t stride, int8_t * Im_out,
+                               const uint16_t dim_im_out, const int16_t * pThreshold)
+{
+    arm_convolve_HWC_intq_ref(Im_in, dim_im_in, ch_im_in, wt, ch_im_out, dim_kernel, padding, stride,
+                              Im_out, dim_im_out, pThreshold, 2);
+}
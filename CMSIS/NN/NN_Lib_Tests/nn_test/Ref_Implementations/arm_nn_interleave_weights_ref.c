@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ref_functions.h"
+
+/*
+ * C version of convert_to_interleaved_int4/int2/uint8_weights in
+ * Scripts/NNFunctions/fully_connected_opt_weight_generation.py
+ */
+
+static uint8_t packed_byte(const q7_t * wt, const uint16_t num_of_cols, const uint16_t bits, int row, int j)
+{
+    int       per_byte = 8 / bits;
+    int       col;
+    uint8_t   byte = 0;
+
+    for (int k = 0; k < per_byte; k++)
+    {
+        // rows are zero-padded to whole bytes and words
+        col = j * per_byte + k;
+        if (col < num_of_cols)
+        {
+            byte |= (wt[row * num_of_cols + col] & ((1 << bits) - 1)) << (k * bits);
+        }
+    }
+    return byte;
+}
+
+void arm_nn_interleave_weights_ref(const q7_t * wt, // weights, one per byte, row by row
+                                   const uint16_t num_of_rows,  // number of rows
+                                   const uint16_t num_of_cols,  // number of weights per row
+                                   const uint16_t bits, // 8, 4 or 2
+                                   q7_t * pOut) // packed and interleaved weights
+{
+    int       per_word = 32 / bits;
+    int       num_of_bytes = bits == 8 ? num_of_cols : (num_of_cols + per_word - 1) / per_word * 4;
+    int       i, j, k;
+
+    for (i = 0; i + 1 < num_of_rows; i += 2)
+    {
+        // 32-bit words of the two rows in turn
+        for (j = 0; j < num_of_bytes - num_of_bytes % 4; j += 4)
+        {
+            for (k = 0; k < 4; k++)
+            {
+                *pOut++ = (q7_t) packed_byte(wt, num_of_cols, bits, i, j + k);
+            }
+            for (k = 0; k < 4; k++)
+            {
+                *pOut++ = (q7_t) packed_byte(wt, num_of_cols, bits, i + 1, j + k);
+            }
+        }
+        // then the leftover bytes of the first and of the second row
+        for (k = 0; k < 2; k++)
+        {
+            for (j = num_of_bytes - num_of_bytes % 4; j < num_of_bytes; j++)
+            {
+                *pOut++ = (q7_t) packed_byte(wt, num_of_cols, bits, i + k, j);
+            }
+        }
+    }
+
+    // the last odd row is in order, so a single row packs a tensor
+    if (num_of_rows % 2)
+    {
+        for (j = 0; j < num_of_bytes; j++)
+        {
+            *pOut++ = (q7_t) packed_byte(wt, num_of_cols, bits, num_of_rows - 1, j);
+        }
+    }
+}
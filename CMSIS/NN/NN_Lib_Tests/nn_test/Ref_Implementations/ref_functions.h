@@ -143,6 +143,57 @@ extern    "C"
                                                                 q7_t * bufferB  //buffer space for output
         );
 
+    void      arm_convolve_HWC_asym_uint8_ref(const uint8_t * Im_in,  // input image
+                                              const uint16_t dim_im_in,  // input image dimention
+                                              const uint16_t ch_im_in,   // number of input image channels
+                                              const uint8_t * wt,    // kernel weights, row by row
+                                              const uint8_t z_wt,    // weights offset
+                                              const uint8_t z_in,    // input offset
+                                              const uint8_t z_out,   // output offset
+                                              const int32_t m_zero,  // output multiplier
+                                              const uint16_t n_zero, // output right-shift
+                                              const uint16_t ch_im_out,  // number of filters, i.e., output image channels
+                                              const uint16_t dim_kernel, // filter kernel size
+                                              const uint16_t padding,    // padding sizes
+                                              const uint16_t stride, // stride
+                                              const int32_t * bias,  // bias
+                                              uint8_t * Im_out,  // output image
+                                              const uint16_t dim_im_out  // output image dimension
+        );
+
+    void      arm_convolve_HWC_int4_ref(const int8_t * Im_in,  // packed input image
+                                        const uint16_t dim_im_in, // input image dimention
+                                        const uint16_t ch_im_in,  // number of input image channels
+                                        const q7_t * wt,  // kernel weights, one per byte, row by row
+                                        const uint16_t ch_im_out, // number of filters, i.e., output image channels
+                                        const uint16_t dim_kernel,    // filter kernel size
+                                        const uint16_t padding,   // padding sizes
+                                        const uint16_t stride,    // stride
+                                        int8_t * Im_out,  // packed output image
+                                        const uint16_t dim_im_out,    // output image dimension
+                                        const int16_t * pThreshold    // ascending thresholds, 16 per channel
+        );
+
+    void      arm_convolve_HWC_int2_ref(const int8_t * Im_in,  // packed input image
+                                        const uint16_t dim_im_in, // input image dimention
+                                        const uint16_t ch_im_in,  // number of input image channels
+                                        const q7_t * wt,  // kernel weights, one per byte, row by row
+                                        const uint16_t ch_im_out, // number of filters, i.e., output image channels
+                                        const uint16_t dim_kernel,    // filter kernel size
+                                        const uint16_t padding,   // padding sizes
+                                        const uint16_t stride,    // stride
+                                        int8_t * Im_out,  // packed output image
+                                        const uint16_t dim_im_out,    // output image dimension
+                                        const int16_t * pThreshold    // ascending thresholds, 4 per channel
+        );
+
+    void      arm_nn_interleave_weights_ref(const q7_t * wt, // weights, one per byte, row by row
+                                            const uint16_t num_of_rows,  // number of rows
+                                            const uint16_t num_of_cols,  // number of weights per row
+                                            const uint16_t bits, // 8, 4 or 2
+                                            q7_t * pOut  // packed and interleaved weights
+        );
+
 /*
  *
  * Fully-connected reference implemenation
@@ -46,6 +46,7 @@
 #define TEST_CONV
 #define TEST_NONSQUARE
 #define TEST_NNMULT
+#define TEST_INTQ_RGB
 
 int test_index = 0;
 q7_t test_flags[50];
@@ -781,6 +782,152 @@ int main()
     delete[]test3;
     delete[]test4;
 
+#endif
+
+// the INT-Q and asym uint8 kernels are for little-endian cores with the DSP extension
+#if defined (TEST_INTQ_RGB) && defined (ARM_MATH_DSP) && !defined (ARM_MATH_BIG_ENDIAN)
+
+// odd input and output sizes, so the last output pixel is a left-over
+#define RGB_IM_DIM 9
+#define RGB_KER_DIM 3
+#define RGB_OUT_CH 8
+#define RGB_OUT_DIM 5
+#define RGB_PADDING 1
+#define RGB_STRIDE 2
+#define RGB_COL (3 * RGB_KER_DIM * RGB_KER_DIM)
+#define RGB_COL_PADDED ((RGB_COL + 15) & ~15)
+#define RGB_WT_SIZE (RGB_OUT_CH * RGB_COL)
+#define RGB_IM_SIZE (RGB_IM_DIM * RGB_IM_DIM * 3)
+#define RGB_OUT_SIZE (RGB_OUT_DIM * RGB_OUT_DIM * RGB_OUT_CH)
+
+    test1 = new q7_t[2 * RGB_WT_SIZE];
+    test2 = new q15_t[2 * RGB_COL_PADDED + 16 * RGB_OUT_CH];
+    test3 = new q7_t[RGB_COL_PADDED + 2 * RGB_OUT_SIZE + 2 * RGB_IM_SIZE];
+    q31_t    *rgb_bias = new q31_t[RGB_OUT_CH];
+
+    // bufferA and bufferB first, to keep them 32-bit aligned
+    q7_t     *rgb_weight_packed = test1;
+    q7_t     *rgb_weight = test1 + RGB_WT_SIZE;
+    q15_t    *rgb_buf = test2;
+    q15_t    *rgb_threshold = test2 + 2 * RGB_COL_PADDED;
+    q7_t     *rgb_col_buf = test3;
+    q7_t     *rgb_im_out_ref = test3 + RGB_COL_PADDED;
+    q7_t     *rgb_im_out_opt = test3 + RGB_COL_PADDED + RGB_OUT_SIZE;
+    q7_t     *rgb_im_in = test3 + RGB_COL_PADDED + 2 * RGB_OUT_SIZE;
+    q7_t     *rgb_im_in_packed = test3 + RGB_COL_PADDED + 2 * RGB_OUT_SIZE + RGB_IM_SIZE;
+
+    // 1 and 3 channels give an odd number of columns for asym uint8
+    for (int ch = 1; ch <= 3; ch++)
+    {
+        int       col = ch * RGB_KER_DIM * RGB_KER_DIM;
+
+        for (int i = 0; i < RGB_OUT_CH * col; i++)
+        {
+            rgb_weight[i] = rand() % 256;
+        }
+        for (int i = 0; i < RGB_IM_DIM * RGB_IM_DIM * ch; i++)
+        {
+            rgb_im_in[i] = rand() % 256;
+        }
+        for (int i = 0; i < RGB_OUT_CH; i++)
+        {
+            rgb_bias[i] = rand() % 20000 - 10000;
+        }
+        arm_nn_interleave_weights_ref(rgb_weight, RGB_OUT_CH, col, 8, rgb_weight_packed);
+
+        initialize_results_q7(rgb_im_out_ref, rgb_im_out_opt, RGB_OUT_SIZE);
+
+        printf("start asym uint8 ref implementation for %d channels\n", ch);
+
+        arm_convolve_HWC_asym_uint8_ref((uint8_t *) rgb_im_in, RGB_IM_DIM, ch, (uint8_t *) rgb_weight,
+                                        120, 130, 128, 1518500250, 8, RGB_OUT_CH, RGB_KER_DIM, RGB_PADDING,
+                                        RGB_STRIDE, rgb_bias, (uint8_t *) rgb_im_out_ref, RGB_OUT_DIM);
+
+        printf("start asym uint8 RGB implementation for %d channels\n", ch);
+
+        arm_convolve_HWC_asym_uint8_RGB((uint8_t *) rgb_im_in, RGB_IM_DIM, ch, (uint8_t *) rgb_weight_packed,
+                                        120, 130, 128, 1518500250, 8, RGB_OUT_CH, RGB_KER_DIM, RGB_PADDING,
+                                        RGB_PADDING, RGB_PADDING, RGB_PADDING, RGB_STRIDE, rgb_bias,
+                                        (uint8_t *) rgb_im_out_opt, RGB_OUT_DIM, rgb_buf, (uint8_t *) rgb_col_buf);
+
+        verify_results_q7(rgb_im_out_ref, rgb_im_out_opt, RGB_OUT_SIZE);
+
+        // INT4, the thresholds of each channel are ascending
+        for (int i = 0; i < RGB_OUT_CH * col; i++)
+        {
+            rgb_weight[i] = rand() % 16 - 8;
+        }
+        for (int i = 0; i < RGB_IM_DIM * RGB_IM_DIM * ch; i++)
+        {
+            rgb_im_in[i] = rand() % 16 - 8;
+        }
+        for (int i = 0; i < RGB_OUT_CH; i++)
+        {
+            rgb_threshold[i * 16] = rand() % 20 - 150;
+            for (int j = 1; j < 16; j++)
+            {
+                rgb_threshold[i * 16 + j] = rgb_threshold[i * 16 + j - 1] + rand() % 20 + 1;
+            }
+        }
+        arm_nn_interleave_weights_ref(rgb_weight, RGB_OUT_CH, col, 4, rgb_weight_packed);
+        arm_nn_interleave_weights_ref(rgb_im_in, 1, RGB_IM_DIM * RGB_IM_DIM * ch, 4, rgb_im_in_packed);
+
+        initialize_results_q7(rgb_im_out_ref, rgb_im_out_opt, RGB_OUT_SIZE);
+
+        printf("start int4 ref implementation for %d channels\n", ch);
+
+        arm_convolve_HWC_int4_ref(rgb_im_in_packed, RGB_IM_DIM, ch, rgb_weight, RGB_OUT_CH, RGB_KER_DIM,
+                                  RGB_PADDING, RGB_STRIDE, rgb_im_out_ref, RGB_OUT_DIM, rgb_threshold);
+
+        printf("start int4 RGB implementation for %d channels\n", ch);
+
+        arm_convolve_HWC_int4_RGB(rgb_im_in_packed, RGB_IM_DIM, ch, rgb_weight_packed, RGB_OUT_CH, RGB_KER_DIM,
+                                  RGB_PADDING, RGB_STRIDE, rgb_im_out_opt, RGB_OUT_DIM, rgb_buf, rgb_threshold,
+                                  rgb_col_buf);
+
+        verify_results_q7(rgb_im_out_ref, rgb_im_out_opt, RGB_OUT_SIZE / 2);
+
+        // INT2
+        for (int i = 0; i < RGB_OUT_CH * col; i++)
+        {
+            rgb_weight[i] = rand() % 4 - 2;
+        }
+        for (int i = 0; i < RGB_IM_DIM * RGB_IM_DIM * ch; i++)
+        {
+            rgb_im_in[i] = rand() % 4 - 2;
+        }
+        for (int i = 0; i < RGB_OUT_CH; i++)
+        {
+            rgb_threshold[i * 4] = rand() % 3 - 6;
+            for (int j = 1; j < 4; j++)
+            {
+                rgb_threshold[i * 4 + j] = rgb_threshold[i * 4 + j - 1] + rand() % 4 + 1;
+            }
+        }
+        arm_nn_interleave_weights_ref(rgb_weight, RGB_OUT_CH, col, 2, rgb_weight_packed);
+        arm_nn_interleave_weights_ref(rgb_im_in, 1, RGB_IM_DIM * RGB_IM_DIM * ch, 2, rgb_im_in_packed);
+
+        initialize_results_q7(rgb_im_out_ref, rgb_im_out_opt, RGB_OUT_SIZE);
+
+        printf("start int2 ref implementation for %d channels\n", ch);
+
+        arm_convolve_HWC_int2_ref(rgb_im_in_packed, RGB_IM_DIM, ch, rgb_weight, RGB_OUT_CH, RGB_KER_DIM,
+                                  RGB_PADDING, RGB_STRIDE, rgb_im_out_ref, RGB_OUT_DIM, rgb_threshold);
+
+        printf("start int2 RGB implementation for %d channels\n", ch);
+
+        arm_convolve_HWC_int2_RGB(rgb_im_in_packed, RGB_IM_DIM, ch, rgb_weight_packed, RGB_OUT_CH, RGB_KER_DIM,
+                                  RGB_PADDING, RGB_STRIDE, rgb_im_out_opt, RGB_OUT_DIM, rgb_buf, rgb_threshold,
+                                  rgb_col_buf);
+
+        verify_results_q7(rgb_im_out_ref, rgb_im_out_opt, RGB_OUT_SIZE / 4);
+    }
+
+    delete[]test1;
+    delete[]test2;
+    delete[]test3;
+    delete[]rgb_bias;
+
 #endif
 
     test_pass = true;
@@ -109,6 +109,57 @@ def convert_q7_q15_weights(weights):
         counter = counter + 4
     return new_weights
 
+def pack_int_weights(weights, bits):
+    # pack the sub-byte weights of each row, first weight in the LSBs;
+    # rows are zero-padded to 32-bit words (e.g. for the _RGB kernels)
+    [r, h, w, c] = weights.shape
+    weights = np.reshape(weights, (r, h*w*c))
+    per_byte = 8//bits
+    per_word = 4*per_byte
+    num_of_cols = ((h*w*c + per_word - 1)//per_word)*per_word
+    weights = np.pad(weights, ((0, 0), (0, num_of_cols - h*w*c)), 'constant')
+    num_of_bytes = num_of_cols//per_byte
+    new_weights = np.zeros((r, num_of_bytes), dtype=np.uint8)
+    for i in range(r):
+      for j in range(num_of_bytes):
+        byte = 0
+        for k in range(per_byte):
+          byte = byte | ((int(weights[i][j*per_byte+k]) & ((1<<bits)-1)) << (k*bits))
+        new_weights[i][j] = byte
+    return new_weights
+
+def interleave_rows(weights):
+    # interleave every 2 rows by 32-bit words, the leftover bytes of the
+    # first row are followed by the ones of the second row
+    [num_of_rows, num_of_bytes] = weights.shape
+    new_weights = np.zeros((num_of_rows*num_of_bytes), dtype=weights.dtype)
+    counter = 0
+    for i in range(num_of_rows//2):
+      row_base = 2*i
+      for j in range(num_of_bytes//4):
+        column_base = 4*j
+        new_weights[counter:counter+4]   = weights[row_base  ][column_base:column_base+4]
+        new_weights[counter+4:counter+8] = weights[row_base+1][column_base:column_base+4]
+        counter = counter + 8
+      for k in range(2):
+        for j in range(num_of_bytes-num_of_bytes%4, num_of_bytes):
+          new_weights[counter] = weights[row_base+k][j]
+          counter = counter + 1
+    # the last odd row is in order
+    if num_of_rows % 2:
+      new_weights[counter:] = weights[num_of_rows-1]
+    return new_weights
+
+def convert_to_interleaved_int4_weights(weights):
+    return interleave_rows(pack_int_weights(weights, 4))
+
+def convert_to_interleaved_int2_weights(weights):
+    return interleave_rows(pack_int_weights(weights, 2))
+
+def convert_to_interleaved_uint8_weights(weights):
+    [r, h, w, c] = weights.shape
+    return interleave_rows(np.reshape(weights, (r, h*w*c)).astype(np.uint8))
+
 # input dimensions
 vec_dim = 127
 row_dim = 127
@@ -69,7 +69,11 @@
    * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
    *
    * @details
-   * TBD
+   *
+   * The computation kernel arm_nn_mat_mult_kernel_asym_uint8_int16_reordered
+   * does the GEMM computation with the reordered columns. The weights wt are
+   * row-interleaved as described in the kernel, see
+   * convert_to_interleaved_uint8_weights in fully_connected_opt_weight_generation.py.
    */
 
 arm_status
@@ -330,10 +334,13 @@ arm_convolve_HWC_asym_uint8(const uint8_t * Im_in,
 		 const int32_t *v_za_ptr = (int32_t *) v_za;
 		 int32_t 		inzA = *__SIMD32(v_za_ptr);
 
-        for (i = 0; i < ch_im_out; i++)
+        /* the weights are row-interleaved, so two rows are computed at once */
+        for (i = 0; i < ch_im_out; i += 2)
         {
-        	int32_t sum = bias[i];
+        	int32_t sum  = bias[i];
+        	int32_t sum2 = bias[i + 1];
         	int16_t *pB = bufferA;
+        	const uint8_t *pA2;
 
             /* each time it process 4 entries */
             uint16_t  colCnt = ch_im_in * dim_kernel * dim_kernel >> 2;
@@ -341,36 +348,46 @@ arm_convolve_HWC_asym_uint8(const uint8_t * Im_in,
             while (colCnt)
             {
 
-            	int32_t inA1, inA2;
+            	int32_t inA11, inA12, inA21, inA22;
             	int32_t inB1, inB2;
 
-                pA = (uint8_t *) read_and_pad_reordered_uint8((void *)pA, &inA1, &inA2);
+                pA = (uint8_t *) read_and_pad_reordered_uint8((void *)pA, &inA11, &inA12);
+                pA = (uint8_t *) read_and_pad_reordered_uint8((void *)pA, &inA21, &inA22);
 
                 inB1 = *__SIMD32(pB)++;
-				inA1 = __SSUB16(inA1, inzA);
-				inA2 = __SSUB16(inA2, inzA);
-                sum = __SMLAD(inA1, inB1, sum);
+				inA11 = __SSUB16(inA11, inzA);
+				inA21 = __SSUB16(inA21, inzA);
+                sum = __SMLAD(inA11, inB1, sum);
+                sum2 = __SMLAD(inA21, inB1, sum2);
+
                 inB2 = *__SIMD32(pB)++;
-                sum = __SMLAD(inA2, inB2, sum);
+				inA12 = __SSUB16(inA12, inzA);
+				inA22 = __SSUB16(inA22, inzA);
+                sum = __SMLAD(inA12, inB2, sum);
+                sum2 = __SMLAD(inA22, inB2, sum2);
 
                 colCnt--;
             }
             colCnt = ch_im_in * dim_kernel * dim_kernel & 0x3;
+            pA2 = pA + colCnt;
             while (colCnt)
             {
-            	int16_t inA1 = (int16_t)*pA++;
+            	int16_t inA1 = (int16_t)*pA++ - z_wt;
+            	int16_t inA2 = (int16_t)*pA2++ - z_wt;
             	int16_t inB1 = *pB++;
 
                 sum += inA1 * inB1;
+                sum2 += inA2 * inB1;
 
                 colCnt--;
             }
+            pA = pA2;
 
-    		sum = ((__HI_SMULL(sum,m_zero)) >> n_zero) + z_out;
-
-            *pOut = (uint8_t) __USAT(sum , 8);
-            pOut++;
+    		sum  = ((__HI_SMULL(sum,m_zero)) >> n_zero) + z_out;
+    		sum2 = ((__HI_SMULL(sum2,m_zero)) >> n_zero) + z_out;
 
+            *pOut++ = (uint8_t) __USAT(sum , 8);
+            *pOut++ = (uint8_t) __USAT(sum2, 8);
         }
 
     }
@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ * Modifications Copyright (C) 2018 University of Bologna
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library - INT-Q extension
+ * Title:        arm_convolve_HWC_asym_uint8_RGB.c
+ * Description:  Asymmetric UINT8 Convolution for 1 to 3 input channels
+ *
+ * $Date:        18. October 2026
+ * $Authors:     Alessandro Capotondi - alessandro.capotondi@unibo.it
+ *               Manuele Rusci - manuele.rusci@unibo.it
+ *
+ * Target Processor:  Cortex-M cores
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief Asymmetric UINT8 convolution function for 1 to 3 input channels
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       z_wt        weights offset
+   * @param[in]       z_in        input offset
+   * @param[in]       z_out       output offset
+   * @param[in]       m_zero      m zero quantization param
+   * @param[in]       n_zero      n zero quantization param
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       left_pad    padding sizes
+   * @param[in]       right_pad   padding sizes
+   * @param[in]       top_pad     padding sizes
+   * @param[in]       bottom_pad  padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in]       bias        pointer to bias
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in,out]   bufferB     pointer to buffer space for the receptive field
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * bufferA size: 2*ch_im_in*dim_kernel*dim_kernel
+   *
+   * bufferB size: ch_im_in*dim_kernel*dim_kernel
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * ch_im_in is 1, 2 or 3
+   *
+   * ch_im_out is multiple of 2    ( because 2x2 mat_mult kernel )
+   *
+   * This kernel is written for the first layer of CNNs, whose input is a
+   * grayscale image, a single-channel spectrogram or an RGB image. Instead
+   * of the channels, the whole receptive field of ch_im_in*dim_kernel*dim_kernel
+   * entries is gathered in bufferB, padded with z_in, and expanded at once with
+   * arm_asym_uint8_to_int16_reordered_no_shift. Each 32-bit word of the column
+   * thus packs consecutive kernel taps.
+   *
+   * numCol is not rounded up, so for an odd numCol the second column in
+   * bufferA and the weight rows are read with unaligned 32-bit loads, as
+   * in arm_convolve_HWC_q7_RGB. Cortex-M4 and Cortex-M7 support them.
+   *
+   * The weights wt are row-interleaved as for arm_convolve_HWC_asym_uint8.
+   */
+
+arm_status
+arm_convolve_HWC_asym_uint8_RGB(const uint8_t * Im_in,
+                         const uint16_t dim_im_in,
+                         const uint16_t ch_im_in,
+                         const uint8_t * wt,
+						 const uint8_t z_wt,
+						 const uint8_t z_in,
+						 const uint8_t z_out,
+						 const int32_t m_zero,
+						 const uint16_t n_zero,
+                         const uint16_t ch_im_out,
+                         const uint16_t dim_kernel,
+                         const uint8_t left_padding,
+						 const uint8_t right_padding,
+						 const uint8_t top_padding,
+						 const uint8_t bottom_padding,
+                         const uint16_t stride,
+                         const int32_t * bias,
+                         uint8_t * Im_out,
+                         const uint16_t dim_im_out,
+						 int16_t * bufferA,
+						 uint8_t * bufferB)
+{
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    int16_t   i_out_y, i_out_x, i_ker_y;
+    int16_t  *pBuffer = bufferA;
+    uint8_t  *pOut = Im_out;
+    uint16_t  numCol = ch_im_in * dim_kernel * dim_kernel;
+
+    if (ch_im_in == 0 || ch_im_in > 3 || ch_im_out % 2 != 0)
+    {
+        /* check if the input dimension meets the constraints */
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+        {
+            int16_t   base_x = i_out_x * stride - left_padding;
+            int16_t   start_x = base_x < 0 ? 0 : base_x;
+            int16_t   end_x = base_x + dim_kernel > dim_im_in ? dim_im_in : base_x + dim_kernel;
+            uint8_t  *pCol = bufferB;
+
+            /* This part implements the im2col function on the whole receptive field */
+            for (i_ker_y = i_out_y * stride - top_padding; i_ker_y < i_out_y * stride - top_padding + dim_kernel; i_ker_y++)
+            {
+                if (i_ker_y < 0 || i_ker_y >= dim_im_in || start_x >= end_x)
+                {
+                    memset(pCol, z_in, ch_im_in * dim_kernel);
+                }
+                else
+                {
+                    /* left padding, valid pixels and right padding of the kernel row */
+                    memset(pCol, z_in, ch_im_in * (start_x - base_x));
+                    memcpy(pCol + ch_im_in * (start_x - base_x),
+                           Im_in + (i_ker_y * dim_im_in + start_x) * ch_im_in,
+                           ch_im_in * (end_x - start_x));
+                    memset(pCol + ch_im_in * (end_x - base_x), z_in, ch_im_in * (base_x + dim_kernel - end_x));
+                }
+                pCol += ch_im_in * dim_kernel;
+            }
+
+            arm_asym_uint8_to_int16_reordered_no_shift(bufferB, z_in, pBuffer, numCol);
+            pBuffer += numCol;
+
+            if (pBuffer == bufferA + 2 * numCol)
+            {
+                pOut =
+                    arm_nn_mat_mult_kernel_asym_uint8_int16_reordered(wt,
+                                                            bufferA,
+															z_wt,
+															z_in,
+															z_out,
+															m_zero,
+															n_zero,
+                                                            ch_im_out,
+                                                            numCol, bias, pOut);
+                /* counter reset */
+                pBuffer = bufferA;
+            }
+        }
+    }
+
+    /* check if there is left-over for compute */
+    if (pBuffer != bufferA)
+    {
+        const uint8_t *pA = wt;
+        int       i;
+
+		 int16_t v_za[2] __attribute__((aligned(4))) = {z_wt,z_wt};
+		 const int32_t *v_za_ptr = (int32_t *) v_za;
+		 int32_t 		inzA = *__SIMD32(v_za_ptr);
+
+        /* the weights are row-interleaved, so two rows are computed at once */
+        for (i = 0; i < ch_im_out; i += 2)
+        {
+        	int32_t sum  = bias[i];
+        	int32_t sum2 = bias[i + 1];
+        	int16_t *pB = bufferA;
+        	const uint8_t *pA2;
+
+            /* each time it process 4 entries */
+            uint16_t  colCnt = numCol >> 2;
+
+            while (colCnt)
+            {
+
+            	int32_t inA11, inA12, inA21, inA22;
+            	int32_t inB1, inB2;
+
+                pA = (uint8_t *) read_and_pad_reordered_uint8((void *)pA, &inA11, &inA12);
+                pA = (uint8_t *) read_and_pad_reordered_uint8((void *)pA, &inA21, &inA22);
+
+                inB1 = *__SIMD32(pB)++;
+				inA11 = __SSUB16(inA11, inzA);
+				inA21 = __SSUB16(inA21, inzA);
+                sum = __SMLAD(inA11, inB1, sum);
+                sum2 = __SMLAD(inA21, inB1, sum2);
+
+                inB2 = *__SIMD32(pB)++;
+				inA12 = __SSUB16(inA12, inzA);
+				inA22 = __SSUB16(inA22, inzA);
+                sum = __SMLAD(inA12, inB2, sum);
+                sum2 = __SMLAD(inA22, inB2, sum2);
+
+                colCnt--;
+            }
+            colCnt = numCol & 0x3;
+            pA2 = pA + colCnt;
+            while (colCnt)
+            {
+            	int16_t inA1 = (int16_t)*pA++ - z_wt;
+            	int16_t inA2 = (int16_t)*pA2++ - z_wt;
+            	int16_t inB1 = *pB++;
+
+                sum += inA1 * inB1;
+                sum2 += inA2 * inB1;
+
+                colCnt--;
+            }
+            pA = pA2;
+
+    		sum  = ((__HI_SMULL(sum,m_zero)) >> n_zero) + z_out;
+    		sum2 = ((__HI_SMULL(sum2,m_zero)) >> n_zero) + z_out;
+
+            *pOut++ = (uint8_t) __USAT(sum , 8);
+            *pOut++ = (uint8_t) __USAT(sum2, 8);
+        }
+
+    }
+#else
+	#error "Cortex-M0 and Cortex-M3 not supported"
+    /* Run the following code as reference implementation for Cortex-M0 and Cortex-M3 */
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
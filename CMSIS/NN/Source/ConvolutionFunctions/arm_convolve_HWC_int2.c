@@ -80,6 +80,8 @@
    *
    * The computation kernel arm_nn_mat_mult_kernel_int2_int16_reordered does the
    * GEMM computation with the reordered columns.
+   * The weights wt are row-interleaved as described in the kernel, see
+   * convert_to_interleaved_int2_weights in fully_connected_opt_weight_generation.py.
    *
    * To speed-up the determination of the padding condition, we split the
    * computation into 3x3 parts, i.e., {top, mid, bottom} X {left, mid, right}.
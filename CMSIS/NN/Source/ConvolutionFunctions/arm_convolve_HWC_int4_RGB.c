@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2010-2018 Arm Limited or its affiliates. All rights reserved.
+ * Modifications Copyright (C) 2018 University of Bologna
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS NN Library - INT-Q extension
+ * Title:        arm_convolve_HWC_int4_RGB.c
+ * Description:  INT4 convolution for 1 to 3 input channels
+ *
+ * $Date:        18. October 2026
+ * $Authors:     Manuele Rusci - manuele.rusci@unibo.it
+ *               Alessandro Capotondi - alessandro.capotondi@unibo.it
+ *
+ * Target Processor:  Cortex-M cores
+ * -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_nnfunctions.h"
+
+#define INT4_SIZE(x)	((x)>>1)
+
+/**
+ *  @ingroup groupNN
+ */
+
+/**
+ * @addtogroup NNConv
+ * @{
+ */
+
+  /**
+   * @brief INT4 convolution function for 1 to 3 input channels
+   * @param[in]       Im_in       pointer to input tensor
+   * @param[in]       dim_im_in   input tensor dimension
+   * @param[in]       ch_im_in    number of input tensor channels
+   * @param[in]       wt          pointer to kernel weights
+   * @param[in]       ch_im_out   number of filters, i.e., output tensor channels
+   * @param[in]       dim_kernel  filter kernel size
+   * @param[in]       padding     padding sizes
+   * @param[in]       stride      convolution stride
+   * @param[in,out]   Im_out      pointer to output tensor
+   * @param[in]       dim_im_out  output tensor dimension
+   * @param[in,out]   bufferA     pointer to buffer space for input
+   * @param[in]       pThreshold  pointer to threshold array
+   * @param[in,out]   bufferB     pointer to buffer space for the receptive field
+   * @return     The function returns either
+   * <code>ARM_MATH_SIZE_MISMATCH</code> or <code>ARM_MATH_SUCCESS</code> based on the outcome of size checking.
+   *
+   * @details
+   *
+   * <b>Buffer size:</b>
+   *
+   * With numCol = ch_im_in*dim_kernel*dim_kernel rounded up to a multiple of 8:
+   *
+   * bufferA size: 2*numCol
+   *
+   * bufferB size: max(numCol/2, ch_im_out) bytes, 32-bit aligned
+   *
+   * <b>Input dimension constraints:</b>
+   *
+   * ch_im_in is 1, 2 or 3
+   *
+   * ch_im_out is multiple of 2    ( because 2x2 mat_mult kernel )
+   *
+   * This kernel is written for the first layer of CNNs, whose input is a
+   * grayscale image, a single-channel spectrogram or an RGB image. Instead
+   * of the channels, the whole receptive field is gathered in bufferB as
+   * packed INT4, zero-padded up to numCol, and expanded at once with
+   * arm_int4_to_int16_reordered_no_shift. The ch_im_in nibbles of each
+   * kernel tap are appended to a 32-bit accumulator which is stored once
+   * full, so each word of the column packs consecutive kernel taps and
+   * bufferB is written without clearing it first.
+   *
+   * Each weight row holds numCol INT4 values, the ones past
+   * ch_im_in*dim_kernel*dim_kernel being zero, and the rows are
+   * row-interleaved as for arm_convolve_HWC_int4.
+   */
+
+arm_status
+arm_convolve_HWC_int4_RGB(const int8_t * Im_in,
+                         const uint16_t dim_im_in,
+                         const uint16_t ch_im_in,
+                         const int8_t * wt,
+                         const uint16_t ch_im_out,
+                         const uint16_t dim_kernel,
+                         const uint16_t padding,
+                         const uint16_t stride,
+                         int8_t * Im_out,
+                         const uint16_t dim_im_out,
+                         int16_t * bufferA,
+						 const int16_t * pThreshold,
+                         int8_t * bufferB)
+{
+
+#if defined (ARM_MATH_DSP)
+    /* Run the following code for Cortex-M4 and Cortex-M7 */
+
+    int16_t   i_out_y, i_out_x, i_ker_y, i_ker_x;
+    int16_t  *pBuffer = bufferA;
+    int8_t   *pOut = Im_out;
+    uint16_t  numCol = (ch_im_in * dim_kernel * dim_kernel + 7) & ~7;
+    /* bits and mask of the ch_im_in nibbles of one kernel tap */
+    uint32_t  tap_bits = ch_im_in << 2;
+    uint32_t  tap_mask = (1U << tap_bits) - 1;
+
+    if (ch_im_in == 0 || ch_im_in > 3 || ch_im_out % 2 != 0)
+    {
+        /* check if the input dimension meets the constraints */
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+
+    for (i_out_y = 0; i_out_y < dim_im_out; i_out_y++)
+    {
+        for (i_out_x = 0; i_out_x < dim_im_out; i_out_x++)
+        {
+            uint32_t *pCol = (uint32_t *) bufferB;
+            uint32_t *pColEnd = pCol + (numCol >> 3);
+            uint32_t  acc = 0;
+            uint32_t  acc_bits = 0;
+
+            /* This part implements the im2col function on the whole receptive field */
+            for (i_ker_y = i_out_y * stride - padding; i_ker_y < i_out_y * stride - padding + dim_kernel; i_ker_y++)
+            {
+                for (i_ker_x = i_out_x * stride - padding; i_ker_x < i_out_x * stride - padding + dim_kernel; i_ker_x++)
+                {
+                    uint32_t  tap = 0;
+
+                    if (i_ker_y >= 0 && i_ker_y < dim_im_in && i_ker_x >= 0 && i_ker_x < dim_im_in)
+                    {
+                        /* nibble position of the tap, read its byte pair only as far as needed */
+                        uint32_t  pos = (i_ker_y * dim_im_in + i_ker_x) * ch_im_in;
+                        const uint8_t *pIn = (const uint8_t *) Im_in + INT4_SIZE(pos);
+                        uint32_t  shift = (pos & 1) << 2;
+
+                        tap = pIn[0];
+                        if (shift + tap_bits > 8)
+                        {
+                            tap |= pIn[1] << 8;
+                        }
+                        tap = (tap >> shift) & tap_mask;
+                    }
+
+                    acc |= tap << acc_bits;
+                    acc_bits += tap_bits;
+                    if (acc_bits >= 32)
+                    {
+                        /* the word is full, carry the nibbles that did not fit */
+                        *pCol++ = acc;
+                        acc_bits -= 32;
+                        acc = acc_bits ? tap >> (tap_bits - acc_bits) : 0;
+                    }
+                }
+            }
+
+            /* padding is INT4 zero up to numCol */
+            while (pCol < pColEnd)
+            {
+                *pCol++ = acc;
+                acc = 0;
+            }
+
+            arm_int4_to_int16_reordered_no_shift(bufferB, pBuffer, numCol);
+            pBuffer += numCol;
+
+            if (pBuffer == bufferA + 2 * numCol)
+            {
+                pOut =
+                    arm_nn_mat_mult_kernel_int4_int16_reordered(wt,
+                                                            bufferA,
+                                                            ch_im_out,
+                                                            numCol,
+															pThreshold,
+															pOut);
+                /* counter reset */
+                pBuffer = bufferA;
+            }
+        }
+    }
+
+    /* left-over because odd number of output pixels */
+    if (pBuffer != bufferA)
+    {
+        /* duplicate the column and keep only the first output */
+        memcpy(pBuffer, bufferA, numCol * sizeof(int16_t));
+        arm_nn_mat_mult_kernel_int4_int16_reordered(wt,
+                                                bufferA,
+                                                ch_im_out,
+                                                numCol,
+                                                pThreshold,
+                                                bufferB);
+        memcpy(pOut, bufferB, INT4_SIZE(ch_im_out));
+    }
+
+#else
+    /* Implementation for Cortex-M0 and Cortex-M3: TO BE COMPLETED */
+    #error "Symmetric int4 Convolution Layer not supported (yet) on this device"
+#endif                          /* ARM_MATH_DSP */
+
+    /* Return to application */
+    return ARM_MATH_SUCCESS;
+}
+
+/**
+ * @} end of NNConv group
+ */
@@ -52,6 +52,12 @@
    * @details
    *
    * This function assumes that data in pInBuffer are reordered
+   *
+   * The weights in pA are row-interleaved: for each pair of rows, one
+   * 32-bit word (4xUINT8) of the first row is followed by the word at the
+   * same column of the second row. The numCol_A % 4 leftover weights of
+   * the first row are followed by the ones of the second row. The two rows
+   * are read as a single sequential stream.
    */
 
 uint8_t *arm_nn_mat_mult_kernel_asym_uint8_int16_reordered(const uint8_t * pA,
@@ -81,9 +87,7 @@ uint8_t *arm_nn_mat_mult_kernel_asym_uint8_int16_reordered(const uint8_t * pA,
         /* setup pointers for B */
         const int16_t *pB = pInBuffer;
         const int16_t *pB2 = pB + numCol_A;
-
-        /* align the second pointer for A */
-        const uint8_t *pA2 = pA + numCol_A;
+        const uint8_t *pA2;
 
         int32_t     sum =  bias[i];
         int32_t     sum2 = bias[i];
@@ -100,7 +104,7 @@ uint8_t *arm_nn_mat_mult_kernel_asym_uint8_int16_reordered(const uint8_t * pA,
         	int32_t inB2 = *__SIMD32(pB2)++;
 
             pA = (uint8_t *) read_and_pad_reordered_uint8((void *)pA, &inA11, &inA12);
-            pA2 = (uint8_t *) read_and_pad_reordered_uint8((void *)pA2, &inA21, &inA22);
+            pA = (uint8_t *) read_and_pad_reordered_uint8((void *)pA, &inA21, &inA22);
 
 			inA11 = __SSUB16(inA11, inzA);
 			inA12 = __SSUB16(inA12, inzA);
@@ -126,6 +130,9 @@ uint8_t *arm_nn_mat_mult_kernel_asym_uint8_int16_reordered(const uint8_t * pA,
 
         //*** TO BE TESTED ***
         colCnt = numCol_A & 0x3;
+
+        /* the leftover of the second row follows the one of the first row */
+        pA2 = pA + colCnt;
         while (colCnt)
         {
             int16_t   inA1 = (int16_t)*pA++;
@@ -153,8 +160,8 @@ uint8_t *arm_nn_mat_mult_kernel_asym_uint8_int16_reordered(const uint8_t * pA,
 		*pOut2++ = (uint8_t) __USAT(sum2, 8);
 		*pOut2++ = (uint8_t) __USAT(sum4, 8);
 
-        /* skip the row computed with A2 */
-        pA += numCol_A;
+        /* move to the next pair of rows */
+        pA = pA2;
     }                           /* for over ch_im_out */
 
     pOut += ch_im_out;
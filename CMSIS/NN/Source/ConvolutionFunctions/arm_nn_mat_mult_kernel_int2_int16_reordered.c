@@ -83,6 +83,14 @@ static int8_t int2_quant(int16_t input, const int16_t * pThr){
    * @details
    *
    * This function assumes that data in pInBuffer are reordered
+   *
+   * The weights in pA are row-interleaved: for each pair of rows, one
+   * 32-bit word (16xINT2) of the first row is followed by the word at the
+   * same column of the second row. The two rows are read as a single
+   * sequential stream.
+   *
+   * numCol_A must be a multiple of 16: the callers zero-pad the weight
+   * rows and the columns to whole 32-bit words (16xINT2).
    */
 
 int8_t     *arm_nn_mat_mult_kernel_int2_int16_reordered(const int8_t * pA,		    // weight buffer
@@ -105,9 +113,6 @@ int8_t     *arm_nn_mat_mult_kernel_int2_int16_reordered(const int8_t * pA,
         const int16_t *pB = pInBuffer;
         const int16_t *pB2 = pB + numCol_A;
 
-        /* align the second pointer for A */
-        const int8_t *pA2 = pA + INT2_SIZE( numCol_A);	
-
         /* init the sum as zeros */
         q31_t     sum =  0;
         q31_t     sum2 = 0;
@@ -123,7 +128,7 @@ int8_t     *arm_nn_mat_mult_kernel_int2_int16_reordered(const int8_t * pA,
 			int32_t		inA21, inA22, inA23, inA24, inA25, inA26, inA27, inA28;
 
             pA = (int8_t *) read_and_pad_reordered_int2((void *)pA, &inA11, &inA12, &inA13, &inA14, &inA15, &inA16, &inA17, &inA18);
-            pA2 = (int8_t *) read_and_pad_reordered_int2((void *)pA2, &inA21, &inA22, &inA23, &inA24, &inA25, &inA26, &inA27, &inA28);
+            pA = (int8_t *) read_and_pad_reordered_int2((void *)pA, &inA21, &inA22, &inA23, &inA24, &inA25, &inA26, &inA27, &inA28);
 
     		int32_t     inB1 = *__SIMD32(pB)++;
     		int32_t     inB2 = *__SIMD32(pB2)++;
@@ -189,40 +194,7 @@ int8_t     *arm_nn_mat_mult_kernel_int2_int16_reordered(const int8_t * pA,
             sum3 = __SMLAD(inA28, inB1, sum3);
             sum4 = __SMLAD(inA28, inB2, sum4);
             colCnt--;
-        }                       
-
-        //FIXME fix the handling of remaining cols
-#if 0
-        // check for remaining cols
-        colCnt = numCol_A & 0x10;
-        if(colCnt)
-        {
-            int32_t inA1_32 = *((int32_t *)  pA);
-            int32_t inA2_32 = *((int32_t *)  pA2);
-
-            while (colCnt)
-            {
-                //read and sign-extend INT4 LSB
-                int8_t      inA1 = __SXTB16(__ROR(__SXTB16( inA1_32 <<  6) , 6 ) );
-                int16_t     inB1 = *pB++;
-                int8_t      inA2 = __SXTB16(__ROR(__SXTB16( inA2_32 <<  6) , 6 ) );
-                int16_t     inB2 = *pB2++;
-
-                //convolve
-                sum += inA1 * inB1;
-                sum2 += inA1 * inB2;
-                sum3 += inA2 * inB1;
-                sum4 += inA2 * inB2;
-
-                //shift next value to LSB
-                inA1_32 = __ROR(inA1_32, 2);
-                inA2_32 = __ROR(inA2_32, 2);
-
-                //decrease counter
-                colCnt--;
-            }
         }
-#endif
 
         // quantization of convolution accumulators and results compression
         if(i & 0x0002 ) {	//MSB or-ed with LSB, then increment the pointer
@@ -240,9 +212,6 @@ int8_t     *arm_nn_mat_mult_kernel_int2_int16_reordered(const int8_t * pA,
 			*pOut2 =   ( int2_quant((int16_t) sum2 , &pThreshold[i<<2]) & 0x03 )
 					| (( int2_quant((int16_t) sum4 , &pThreshold[(i+1)<<2]) << 2 ) & 0x0C );
         }
-
-        /* skip the row computed with A2 */
-        pA += INT2_SIZE(numCol_A);
     }
 
     // increment of output pointer given the INT2 precision
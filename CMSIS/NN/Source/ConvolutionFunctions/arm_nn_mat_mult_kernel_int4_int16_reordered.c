@@ -138,6 +138,14 @@ static int8_t int4_quant(int16_t input, const int16_t * pThr)
    * @details
    *
    * This function assumes that data in pInBuffer are reordered
+   *
+   * The weights in pA are row-interleaved: for each pair of rows, one
+   * 32-bit word (8xINT4) of the first row is followed by the word at the
+   * same column of the second row. The two rows are read as a single
+   * sequential stream.
+   *
+   * numCol_A must be a multiple of 8: the callers zero-pad the weight
+   * rows and the columns to whole 32-bit words (8xINT4).
    */
 
 int8_t     *arm_nn_mat_mult_kernel_int4_int16_reordered(const int8_t * pA,			// weight buffer
@@ -161,9 +169,6 @@ int8_t     *arm_nn_mat_mult_kernel_int4_int16_reordered(const int8_t * pA,			//
         const int16_t *pB = pInBuffer;
         const int16_t *pB2 = pB + numCol_A;
 
-        /* align the second pointer for A */
-        const int8_t *pA2 = pA + INT4_SIZE( numCol_A );	
-
         /* init the sum as zeros */
         int32_t     sum =  0;
         int32_t     sum2 = 0;
@@ -179,7 +184,7 @@ int8_t     *arm_nn_mat_mult_kernel_int4_int16_reordered(const int8_t * pA,			//
 			int32_t		inA21, inA22, inA23, inA24;
 
             pA = (int8_t *) read_and_pad_reordered_int4((void *)pA, &inA11, &inA12, &inA13, &inA14);
-            pA2 = (int8_t *) read_and_pad_reordered_int4((void *)pA2, &inA21, &inA22, &inA23, &inA24);
+            pA = (int8_t *) read_and_pad_reordered_int4((void *)pA, &inA21, &inA22, &inA23, &inA24);
 
             int32_t     inB1 = *__SIMD32(pB)++;
             int32_t     inB2 = *__SIMD32(pB2)++;
@@ -214,42 +219,7 @@ int8_t     *arm_nn_mat_mult_kernel_int4_int16_reordered(const int8_t * pA,			//
             sum4 = __SMLAD(inA24, inB2, sum4);
 
             colCnt--;
-        }                       
-
-        //FIXME fix the handling of remaining cols
-#if 0
-        // check for remaining cols
-        colCnt = numCol_A & 0x7;
-        if(colCnt)
-        {
-        	int32_t inA1_32 = *((int32_t *)  pA);
-        	int32_t inA2_32 = *((int32_t *)  pA2);
-
-       		while (colCnt)
-	        {
-	        	//read and sign-extend INT4 LSB 
-	            int16_t     inA1 = __SXTB16(__ROR(__SXTB16( ( inA1_32 <<  4) , 4 ) ) );
-	            int16_t     inB1 = *pB++;
-	            int16_t     inA2 = __SXTB16(__ROR(__SXTB16( ( inA2_32 <<  4) , 4 ) ) );
-	            int16_t     inB2 = *pB2++;
-
-	            //convolve
-	            sum += inA1 * inB1;
-	            sum2 += inA1 * inB2;
-	            sum3 += inA2 * inB1;
-	            sum4 += inA2 * inB2;
-
-	            //shift next value to LSB
-	            inA1_32 = __ROR(inA1_32, 4);
-        		inA2_32 = __ROR(inA2_32, 4);
-
-        		//decrease counter
-	            colCnt--;
-	        }
         }
-#endif
-
-
 
         // quantization of convolution accumulators and results compression
         res1 = int4_quant((int16_t) sum , &pThreshold[i<<4]		);	
@@ -258,10 +228,6 @@ int8_t     *arm_nn_mat_mult_kernel_int4_int16_reordered(const int8_t * pA,			//
         res1 = int4_quant((int16_t) sum2 , &pThreshold[i<<4]);
 		res2 = int4_quant((int16_t) sum4 , &pThreshold[(i+1)<<4]);
         *pOut2++ = ( res1 & 0x0F ) | (( res2 << 4 ) & 0xF0 );
-
-
-        /* skip the row computed with A2 */
-        pA += INT4_SIZE(numCol_A);
     }                          
 
     // increment of output pointer given the INT4 precision
@@ -65,8 +65,12 @@
    *
    * vec_buffer size: dim_vec
    *
-   * This basic function is designed to work with regular weight
-   * matrix without interleaving.
+   * The weight matrix is row-interleaved: for each pair of rows, one
+   * 32-bit word (4xUINT8) of the first row is followed by the word at the
+   * same column of the second row, then the dim_vec % 4 leftover weights
+   * of the first row are followed by the ones of the second row. A last
+   * odd row is stored as is. The whole matrix is read sequentially.
+   * See convert_to_interleaved_uint8_weights in fully_connected_opt_weight_generation.py.
    *
    */
 
@@ -108,13 +112,12 @@ arm_fully_connected_asym_uint8(const uint8_t * pV,
         uint16_t  colCnt = dim_vec >> 2;
 
         pA = vec_buffer;
-        pB2 = pB + dim_vec;
 
         while (colCnt)
         {
         	int32_t     inV, inM11, inM12, inM21, inM22;
             pB = (uint8_t *) read_and_pad_reordered_uint8((void *)pB, &inM11, &inM12);
-            pB2 = (uint8_t *) read_and_pad_reordered_uint8((void *)pB2, &inM21, &inM22);
+            pB = (uint8_t *) read_and_pad_reordered_uint8((void *)pB, &inM21, &inM22);
 
             inV = *__SIMD32(pA)++;
             inM11 = __SSUB16(inM11, inzA);
@@ -131,6 +134,7 @@ arm_fully_connected_asym_uint8(const uint8_t * pV,
             colCnt--;
         }
         colCnt = dim_vec & 0x3;
+        pB2 = pB + colCnt;
         while (colCnt)
         {
         	int16_t   inV  = (int16_t) *pA++;
@@ -150,7 +154,7 @@ arm_fully_connected_asym_uint8(const uint8_t * pV,
 		*pO++ = (uint8_t) __USAT(sum2, 8);
 
         /* adjust the pointers and counters */
-        pB += dim_vec;
+        pB = pB2;
         rowCnt--;
     }
 
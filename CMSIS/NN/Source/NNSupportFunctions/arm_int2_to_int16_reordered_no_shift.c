@@ -113,7 +113,7 @@ void arm_int2_to_int16_reordered_no_shift(const int8_t * pSrc, int16_t * pDst, u
 
     /* If the blockSize is not a multiple of 16, compute any remaining output samples here.    
      ** No loop unrolling is used. */
-    blkCnt = blockSize % 0x16u;
+    blkCnt = blockSize % 0x10u;
 
 #else
 
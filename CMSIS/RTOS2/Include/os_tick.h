@@ -1,8 +1,8 @@
 /**************************************************************************//**
  * @file     os_tick.h
  * @brief    CMSIS OS Tick header file
- * @version  V1.0.1
- * @date     24. November 2017
+ * @version  V1.1.0
+ * @date     18. October 2026
  ******************************************************************************/
 /*
  * Copyright (c) 2017-2017 ARM Limited. All rights reserved.
@@ -68,4 +68,13 @@ uint32_t OS_Tick_GetCount (void);
 /// \return OS Tick overflow status (1 - overflow, 0 - no overflow).
 uint32_t OS_Tick_GetOverflow (void);
 
+/// Program a single OS Tick timer interrupt after a number of ticks (tick-less idle)
+/// \param[in]     ticks        number of ticks until the next RTOS Kernel timeout
+/// \return number of ticks programmed (0 - not programmed, tick interrupt pending).
+uint32_t OS_Tick_Suspend (uint32_t ticks);
+
+/// Return to periodic OS Tick timer interrupts after \ref OS_Tick_Suspend
+/// \return number of complete ticks elapsed since \ref OS_Tick_Suspend.
+uint32_t OS_Tick_Resume (void);
+
 #endif  /* OS_TICK_H */
@@ -27,12 +27,17 @@
  
 #include "cmsis_compiler.h"
 #include "rtx_os.h"
+#include "RTX_Config.h"
  
 // OS Idle Thread
 __WEAK __NO_RETURN void osRtxIdleThread (void *argument) {
   (void)argument;
 
-  for (;;) {}
+  for (;;) {
+#if (OS_TICKLESS_IDLE != 0)
+    osRtxKernelIdle(OS_TICKLESS_MIN_TICKS);
+#endif
+  }
 }
  
 // OS Error Callback function
@@ -42,6 +42,8 @@
  
 //   <o>Global Dynamic Memory size [bytes] <0-1073741824:8>
 //   <i> Defines the combined global dynamic memory size.
+//   <i> Size it with osRtxMemoryHeapSize(blocks, bytes) for the blocks allocated at the same time,
+//   <i> which adds the memory heap overhead. The minimum is osRtxMemoryHeapMin (216 bytes on 32-bit).
 //   <i> Default: 4096
 #ifndef OS_DYNAMIC_MEM_SIZE
 #define OS_DYNAMIC_MEM_SIZE         4096
@@ -69,6 +71,22 @@
  
 //   </e>
  
+//   <e>Tick-less Idle
+//   <i> Suspends the periodic Kernel Tick while the Idle Thread sleeps until the next timeout.
+//   <i> Requires privileged Thread mode and OS_Tick_Suspend/OS_Tick_Resume of the OS Tick timer.
+#ifndef OS_TICKLESS_IDLE
+#define OS_TICKLESS_IDLE            0
+#endif
+ 
+//     <o>Minimum sleep time [ticks] <1-1000>
+//     <i> Defines how many ticks the next timeout must be away to suspend the Kernel Tick.
+//     <i> Default: 2
+#ifndef OS_TICKLESS_MIN_TICKS
+#define OS_TICKLESS_MIN_TICKS       2
+#endif
+ 
+//   </e>
+ 
 //   <o>ISR FIFO Queue 
 //      <4=>  4 entries    <8=>   8 entries   <12=>  12 entries   <16=>  16 entries
 //     <24=> 24 entries   <32=>  32 entries   <48=>  48 entries   <64=>  64 entries
@@ -113,6 +131,7 @@
 //     <o>Total Stack size [bytes] for user Threads with user-provided Stack size <0-1073741824:8>
 //     <i> Defines the combined stack size for user threads with user-provided stack size.
 //     <i> Applies to user threads with user-provided stack size and system provided memory for stack.
+//     <i> The memory heap overhead for OS_THREAD_NUM stacks is added (osRtxMemoryHeapSize).
 //     <i> Default: 0
 #ifndef OS_THREAD_USER_STACK_SIZE
 #define OS_THREAD_USER_STACK_SIZE   0
@@ -300,6 +319,7 @@
 //     <o>Data Storage Memory size [bytes] <0-1073741824:8>
 //     <i> Defines the combined data storage memory size.
 //     <i> Applies to objects with system provided memory for data storage.
+//     <i> The memory heap overhead for OS_MEMPOOL_NUM blocks is added (osRtxMemoryHeapSize).
 //     <i> Default: 0
 #ifndef OS_MEMPOOL_DATA_SIZE
 #define OS_MEMPOOL_DATA_SIZE        0
@@ -328,6 +348,7 @@
 //     <o>Data Storage Memory size [bytes] <0-1073741824:8>
 //     <i> Defines the combined data storage memory size.
 //     <i> Applies to objects with system provided memory for data storage.
+//     <i> The memory heap overhead for OS_MSGQUEUE_NUM blocks is added (osRtxMemoryHeapSize).
 //     <i> Default: 0
 #ifndef OS_MSGQUEUE_DATA_SIZE
 #define OS_MSGQUEUE_DATA_SIZE       0
@@ -470,6 +491,34 @@
  
 //   </e>
  
+//   <e>Binary Trace
+//   <i> Record RTX events in a compact binary trace buffer instead of the Event Recorder.
+//   <i> Each event is one 8-byte record: timestamp, event ID and first event argument.
+//   <i> The trace buffer is decoded on the host (see Utilities/TraceDecoder).
+#ifndef OS_EVR_TRACE
+#define OS_EVR_TRACE                0
+#endif
+ 
+//     <o>Number of records <64-1048576>
+//     <i> Defines the number of records in the trace buffer (power of 2).
+//     <i> Default: 1024
+#ifndef OS_EVR_TRACE_SIZE
+#define OS_EVR_TRACE_SIZE           1024
+#endif
+ 
+//     <h>Trace Event Filter Setup
+//     <i> Event levels recorded in the trace buffer.
+//       <o.0>Error events
+//       <o.1>API function call events
+//       <o.2>Operation events
+//       <o.3>Detailed operation events
+//     </h>
+#ifndef OS_EVR_TRACE_LEVEL
+#define OS_EVR_TRACE_LEVEL          0x05U
+#endif
+ 
+//   </e>
+ 
 //   <h>RTOS Event Generation
 //   <i> Enables event generation for RTX components (requires RTX source variant).
  
@@ -0,0 +1,727 @@
+/* --------------------------------------------------------------------------
+ * Copyright (c) 2013-2018 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *      Name:    main.c
+ *      Purpose: RTX kernel latency benchmarks
+ *
+ *---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "RTE_Components.h"
+#include "cmsis_compiler.h"
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+
+#ifdef RTX_POSIX
+#include <unistd.h>
+#endif
+
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS        10000U
+#endif
+
+#ifndef BENCH_TIMER_ITERATIONS
+#define BENCH_TIMER_ITERATIONS  500U
+#endif
+
+#define FLAG_DONE               0x0001U
+
+int main (void);
+void app_main (void *argument);
+
+typedef struct bench_s {
+  const char *name;
+  uint32_t    cnt;
+  uint64_t    sum;
+  uint32_t    min;
+  uint32_t    max;
+} bench_t;
+
+typedef struct msg_s {
+  uint32_t stamp;
+  uint32_t data;
+} msg_t;
+
+static osThreadId_t       benchThread;
+static osSemaphoreId_t    benchSem;
+static osMutexId_t        benchMutex;
+static osMessageQueueId_t benchQueue;
+
+static osRtxRingBuffer_t  benchRing __ALIGNED(osRtxRingBufferCacheLine);
+static msg_t              benchRingBuf[4];
+
+static osRtxWorkQueue_t   benchWorkQueue;
+static osRtxWork_t        benchWork;
+static uint32_t           benchWorkCount;
+
+static osMemoryPoolId_t   benchPool;
+static void              *benchCacheBuf[8];
+
+static volatile uint32_t  stamp;
+static volatile uint32_t  stampOwner;
+
+static bench_t statSwitch  = { "context_switch", 0U, 0U, 0U, 0U };
+static bench_t statSem     = { "semaphore_wakeup", 0U, 0U, 0U, 0U };
+static bench_t statSemPair = { "semaphore_release_acquire", 0U, 0U, 0U, 0U };
+static bench_t statMtx     = { "mutex_wakeup", 0U, 0U, 0U, 0U };
+static bench_t statMtxPair = { "mutex_acquire_release", 0U, 0U, 0U, 0U };
+static bench_t statMsg     = { "msgqueue_wakeup", 0U, 0U, 0U, 0U };
+static bench_t statMsgPair = { "msgqueue_put_get", 0U, 0U, 0U, 0U };
+static bench_t statMsgDeep = { "msgqueue_put_get_deep", 0U, 0U, 0U, 0U };
+static bench_t statRng     = { "ringbuffer_wakeup", 0U, 0U, 0U, 0U };
+static bench_t statRngPair = { "ringbuffer_push_pop", 0U, 0U, 0U, 0U };
+static bench_t statWork    = { "workqueue_wakeup", 0U, 0U, 0U, 0U };
+static bench_t statTimer   = { "timer_callback", 0U, 0U, 0U, 0U };
+static bench_t statDelay   = { "delay_wakeup", 0U, 0U, 0U, 0U };
+static bench_t statCreate  = { "object_create_delete", 0U, 0U, 0U, 0U };
+static bench_t statPool    = { "mempool_alloc_free", 0U, 0U, 0U, 0U };
+static bench_t statCache   = { "mempool_cache_alloc_free", 0U, 0U, 0U, 0U };
+
+static uint32_t benchErrors;
+
+/*----------------------------------------------------------------------------
+ * Measurement helpers
+ *---------------------------------------------------------------------------*/
+
+// Timestamp in kernel system timer counts
+static uint32_t Now (void) {
+  return osKernelGetSysTimerCount();
+}
+
+// Add one sample to a benchmark
+static void BenchAdd (bench_t *bench, uint32_t count) {
+  if ((bench->cnt == 0U) || (count < bench->min)) {
+    bench->min = count;
+  }
+  if (count > bench->max) {
+    bench->max = count;
+  }
+  bench->sum += count;
+  bench->cnt++;
+}
+
+// Print benchmark results in nanoseconds
+static void BenchPrint (const bench_t *bench) {
+  uint64_t freq = osKernelGetSysTimerFreq();
+
+  if (bench->cnt == 0U) {
+    printf("BENCH %-26s no samples\n", bench->name);
+    benchErrors++;
+    return;
+  }
+  printf("BENCH %-26s n=%-6u min=%-8llu avg=%-8llu max=%-8llu ns\n",
+         bench->name, (unsigned int)bench->cnt,
+         (unsigned long long)(((uint64_t)bench->min * 1000000000U) / freq),
+         (unsigned long long)(((bench->sum / bench->cnt) * 1000000000U) / freq),
+         (unsigned long long)(((uint64_t)bench->max * 1000000000U) / freq));
+}
+
+// Latency from the last kernel tick to now
+static uint32_t TickLatency (void) {
+  uint32_t interval = osKernelGetSysTimerFreq() / osKernelGetTickFreq();
+  uint32_t tick, count;
+
+  do {
+    tick  = osKernelGetTickCount();
+    count = osKernelGetSysTimerCount();
+  } while (tick != osKernelGetTickCount());
+
+  return (count - (tick * interval));
+}
+
+/*----------------------------------------------------------------------------
+ * Context switch: two threads of equal priority yielding to each other
+ *---------------------------------------------------------------------------*/
+
+static void YieldThread (void *argument) {
+  uint32_t id = (uint32_t)(uintptr_t)argument;
+  uint32_t t, i;
+
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    t = Now();
+    if ((stampOwner != 0U) && (stampOwner != id)) {
+      BenchAdd(&statSwitch, t - stamp);
+    }
+    stampOwner = id;
+    stamp      = Now();
+    (void)osThreadYield();
+  }
+
+  stampOwner = 0U;
+  (void)osThreadFlagsSet(benchThread, FLAG_DONE);
+}
+
+static void BenchContextSwitch (void) {
+  stampOwner = 0U;
+  (void)osThreadNew(YieldThread, (void *)1U, NULL);
+  (void)osThreadNew(YieldThread, (void *)2U, NULL);
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAll, osWaitForever);
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAll, osWaitForever);
+}
+
+/*----------------------------------------------------------------------------
+ * Semaphore: release to a higher priority waiting thread
+ *---------------------------------------------------------------------------*/
+
+static const osThreadAttr_t waiterAttr = {
+  .priority = osPriorityAboveNormal
+};
+
+static void SemaphoreThread (void *argument) {
+  uint32_t i;
+  (void)argument;
+
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    if (osSemaphoreAcquire(benchSem, osWaitForever) != osOK) {
+      benchErrors++;
+    }
+    BenchAdd(&statSem, Now() - stamp);
+  }
+}
+
+static void BenchSemaphore (void) {
+  uint32_t t, i;
+
+  benchSem = osSemaphoreNew(1U, 0U, NULL);
+
+  // Wakeup latency
+  (void)osThreadNew(SemaphoreThread, NULL, &waiterAttr);
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    stamp = Now();
+    (void)osSemaphoreRelease(benchSem);
+  }
+
+  // Uncontended release and acquire
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    t = Now();
+    (void)osSemaphoreRelease(benchSem);
+    if (osSemaphoreAcquire(benchSem, 0U) != osOK) {
+      benchErrors++;
+    }
+    BenchAdd(&statSemPair, Now() - t);
+  }
+
+  (void)osSemaphoreDelete(benchSem);
+}
+
+/*----------------------------------------------------------------------------
+ * Mutex: release to a higher priority waiting thread
+ *---------------------------------------------------------------------------*/
+
+static const osMutexAttr_t mutexAttr = {
+  .attr_bits = osMutexPrioInherit
+};
+
+static void MutexThread (void *argument) {
+  uint32_t i;
+  (void)argument;
+
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAny, osWaitForever);
+    if (osMutexAcquire(benchMutex, osWaitForever) != osOK) {
+      benchErrors++;
+    }
+    BenchAdd(&statMtx, Now() - stamp);
+    (void)osMutexRelease(benchMutex);
+  }
+}
+
+static void BenchMutex (void) {
+  osThreadId_t thread;
+  uint32_t     t, i;
+
+  benchMutex = osMutexNew(&mutexAttr);
+
+  // Wakeup latency (owner priority is raised while the waiter is blocked)
+  thread = osThreadNew(MutexThread, NULL, &waiterAttr);
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    if (osMutexAcquire(benchMutex, osWaitForever) != osOK) {
+      benchErrors++;
+    }
+    (void)osThreadFlagsSet(thread, FLAG_DONE);
+    stamp = Now();
+    (void)osMutexRelease(benchMutex);
+  }
+
+  // Uncontended acquire and release
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    t = Now();
+    if (osMutexAcquire(benchMutex, osWaitForever) != osOK) {
+      benchErrors++;
+    }
+    (void)osMutexRelease(benchMutex);
+    BenchAdd(&statMtxPair, Now() - t);
+  }
+
+  (void)osMutexDelete(benchMutex);
+}
+
+/*----------------------------------------------------------------------------
+ * Message queue: put to a higher priority waiting thread
+ *---------------------------------------------------------------------------*/
+
+static void MessageThread (void *argument) {
+  msg_t    msg;
+  uint32_t i;
+  (void)argument;
+
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    if (osMessageQueueGet(benchQueue, &msg, NULL, osWaitForever) != osOK) {
+      benchErrors++;
+    }
+    BenchAdd(&statMsg, Now() - msg.stamp);
+    if (msg.data != i) {
+      benchErrors++;
+    }
+  }
+}
+
+static void BenchMessageQueue (void) {
+  msg_t    msg;
+  uint32_t t, i;
+
+  benchQueue = osMessageQueueNew(4U, sizeof(msg_t), NULL);
+
+  // Wakeup latency
+  (void)osThreadNew(MessageThread, NULL, &waiterAttr);
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    msg.data  = i;
+    msg.stamp = Now();
+    (void)osMessageQueuePut(benchQueue, &msg, 0U, osWaitForever);
+  }
+
+  // Uncontended put and get
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    msg.data = i;
+    t = Now();
+    (void)osMessageQueuePut(benchQueue, &msg, 0U, 0U);
+    if (osMessageQueueGet(benchQueue, &msg, NULL, 0U) != osOK) {
+      benchErrors++;
+    }
+    BenchAdd(&statMsgPair, Now() - t);
+  }
+
+  (void)osMessageQueueDelete(benchQueue);
+
+  // Put and get with 255 queued messages of mixed priorities
+  benchQueue = osMessageQueueNew(256U, sizeof(msg_t), NULL);
+  for (i = 0U; i < 255U; i++) {
+    msg.data = i;
+    (void)osMessageQueuePut(benchQueue, &msg, (uint8_t)(i % 16U), 0U);
+  }
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    msg.data = i;
+    t = Now();
+    (void)osMessageQueuePut(benchQueue, &msg, (uint8_t)(i % 16U), 0U);
+    if (osMessageQueueGet(benchQueue, &msg, NULL, 0U) != osOK) {
+      benchErrors++;
+    }
+    BenchAdd(&statMsgDeep, Now() - t);
+  }
+
+  (void)osMessageQueueDelete(benchQueue);
+}
+
+/*----------------------------------------------------------------------------
+ * Ring buffer: push to a higher priority thread notified with thread flags
+ *---------------------------------------------------------------------------*/
+
+static void RingThread (void *argument) {
+  msg_t    msg;
+  uint32_t i;
+  (void)argument;
+
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    while (osRtxRingBufferPop(&benchRing, &msg, 1U) == 0U) {
+      (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAll, osWaitForever);
+    }
+    BenchAdd(&statRng, Now() - msg.stamp);
+    if (msg.data != i) {
+      benchErrors++;
+    }
+  }
+}
+
+static void BenchRingBuffer (void) {
+  osThreadId_t thread;
+  msg_t        msg;
+  uint32_t     t, i;
+
+  (void)osRtxRingBufferInit(&benchRing, benchRingBuf, 4U, sizeof(msg_t), osRtxRingBufferSingleProducer);
+
+  // Wakeup latency
+  thread = osThreadNew(RingThread, NULL, &waiterAttr);
+  osRtxRingBufferNotify(&benchRing, thread, FLAG_DONE);
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    msg.data  = i;
+    msg.stamp = Now();
+    if (osRtxRingBufferPush(&benchRing, &msg, 1U) != 1U) {
+      benchErrors++;
+    }
+  }
+  osRtxRingBufferNotify(&benchRing, NULL, 0U);
+
+  // Uncontended push and pop
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    msg.data = i;
+    t = Now();
+    (void)osRtxRingBufferPush(&benchRing, &msg, 1U);
+    if (osRtxRingBufferPop(&benchRing, &msg, 1U) != 1U) {
+      benchErrors++;
+    }
+    BenchAdd(&statRngPair, Now() - t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Work queue: submit to a higher priority worker thread
+ *---------------------------------------------------------------------------*/
+
+static void WorkFunction (void *argument) {
+  (void)argument;
+
+  BenchAdd(&statWork, Now() - stamp);
+  benchWorkCount++;
+}
+
+static void BenchWorkQueue (void) {
+  uint32_t i;
+
+  if ((osRtxWorkQueueInit(&benchWorkQueue) != osOK) ||
+      (osRtxWorkInit(&benchWork, WorkFunction, NULL) != osOK)) {
+    benchErrors++;
+    return;
+  }
+  (void)osThreadNew(osRtxWorkQueueThread, &benchWorkQueue, &waiterAttr);
+
+  // Wakeup latency
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    stamp = Now();
+    if (osRtxWorkSubmit(&benchWorkQueue, &benchWork, 0U) != osOK) {
+      benchErrors++;
+    }
+  }
+  if (benchWorkCount != BENCH_ITERATIONS) {
+    benchErrors++;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Timers: periodic timer callback and thread delay, measured from the tick
+ *---------------------------------------------------------------------------*/
+
+static void TimerCallback (void *argument) {
+  (void)argument;
+
+  if (statTimer.cnt < BENCH_TIMER_ITERATIONS) {
+    BenchAdd(&statTimer, TickLatency());
+    if (statTimer.cnt == BENCH_TIMER_ITERATIONS) {
+      (void)osThreadFlagsSet(benchThread, FLAG_DONE);
+    }
+  }
+}
+
+static void BenchTimer (void) {
+  osTimerId_t timer;
+  uint32_t    i;
+
+  timer = osTimerNew(TimerCallback, osTimerPeriodic, NULL, NULL);
+  (void)osTimerStart(timer, 1U);
+  (void)osThreadFlagsWait(FLAG_DONE, osFlagsWaitAll, osWaitForever);
+  (void)osTimerStop(timer);
+  (void)osTimerDelete(timer);
+
+  for (i = 0U; i < BENCH_TIMER_ITERATIONS; i++) {
+    (void)osDelay(1U);
+    BenchAdd(&statDelay, TickLatency());
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Timing wheel: delays and timers close to 2^32 ticks wrap the expiry time
+ * below the current time and must not expire early
+ *---------------------------------------------------------------------------*/
+
+#define WRAP_COUNT              8U
+
+static void WrapCallback (void *argument) {
+  (void)argument;
+
+  benchErrors++;
+}
+
+static void WrapThread (void *argument) {
+  (void)osDelay(0U - (uint32_t)(uintptr_t)argument);
+  benchErrors++;
+}
+
+static void CheckWheelWrap (void) {
+  osThreadId_t thread[WRAP_COUNT];
+  osTimerId_t  timer[WRAP_COUNT];
+  uint32_t     i;
+
+  // Start in the middle of a Level 0 Slot block so that the expiry times
+  // wrap into passed Slots of the same block
+  (void)osDelay(48U - (osKernelGetTickCount() & 31U));
+
+  for (i = 0U; i < WRAP_COUNT; i++) {
+    thread[i] = osThreadNew(WrapThread, (void *)(uintptr_t)(i + 2U), &waiterAttr);
+    timer[i]  = osTimerNew(WrapCallback, osTimerOnce, NULL, NULL);
+    (void)osTimerStart(timer[i], 0U - (i + 2U));
+  }
+
+  (void)osDelay(100U);
+
+  for (i = 0U; i < WRAP_COUNT; i++) {
+    if ((osThreadGetState(thread[i]) != osThreadBlocked) ||
+        (osTimerIsRunning(timer[i]) == 0U)) {
+      benchErrors++;
+    }
+    (void)osThreadTerminate(thread[i]);
+    (void)osTimerDelete(timer[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Wait list: threads waiting for an object are woken by priority, in FIFO
+ * order within a priority, also after a priority change while waiting
+ *---------------------------------------------------------------------------*/
+
+#define ORDER_COUNT             8U
+
+static const osPriority_t orderPriority[ORDER_COUNT] = {
+  osPriorityLow, osPriorityNormal, osPriorityAboveNormal, osPriorityLow1,
+  osPriorityHigh, osPriorityNormal, osPriorityRealtime, osPriorityAboveNormal
+};
+
+static uint32_t orderWoken[ORDER_COUNT];
+static uint32_t orderCount;
+
+static void OrderThread (void *argument) {
+  if (osSemaphoreAcquire(benchSem, osWaitForever) != osOK) {
+    benchErrors++;
+  }
+  orderWoken[orderCount++] = (uint32_t)(uintptr_t)argument;
+}
+
+static void CheckWaitOrder (void) {
+  osThreadId_t thread[ORDER_COUNT];
+  osPriority_t priority[ORDER_COUNT];
+  uint32_t     seq[ORDER_COUNT];
+  uint32_t     i, n, k;
+
+  benchSem   = osSemaphoreNew(ORDER_COUNT, 0U, NULL);
+  orderCount = 0U;
+
+  // Queue the threads one by one
+  for (i = 0U; i < ORDER_COUNT; i++) {
+    thread[i]   = osThreadNew(OrderThread, (void *)(uintptr_t)i, NULL);
+    priority[i] = orderPriority[i];
+    seq[i]      = i;
+    (void)osThreadSetPriority(thread[i], priority[i]);
+    (void)osDelay(1U);
+  }
+
+  // Move a Low waiter behind the High waiter
+  priority[0] = osPriorityHigh;
+  seq[0]      = ORDER_COUNT;
+  (void)osThreadSetPriority(thread[0], priority[0]);
+
+  for (i = 0U; i < ORDER_COUNT; i++) {
+    (void)osSemaphoreRelease(benchSem);
+    (void)osDelay(1U);
+  }
+
+  if (orderCount != ORDER_COUNT) {
+    benchErrors++;
+  }
+  for (n = 0U; n < orderCount; n++) {
+    // Expected: highest priority, then earliest queued
+    k = 0U;
+    for (i = 1U; i < ORDER_COUNT; i++) {
+      if ((priority[i] > priority[k]) ||
+          ((priority[i] == priority[k]) && (seq[i] < seq[k]))) {
+        k = i;
+      }
+    }
+    if (orderWoken[n] != k) {
+      benchErrors++;
+    }
+    priority[k] = osPriorityNone;
+  }
+
+  (void)osSemaphoreDelete(benchSem);
+}
+
+/*----------------------------------------------------------------------------
+ * Dynamic memory: create and delete objects in a fragmented memory
+ *---------------------------------------------------------------------------*/
+
+static void BenchCreate (void) {
+  osMessageQueueId_t mq[16];
+  osSemaphoreId_t    sem;
+  uint32_t           t, i;
+
+  // Fragment the memory with queues of different sizes, free every other one
+  for (i = 0U; i < 16U; i++) {
+    mq[i] = osMessageQueueNew(1U + i, 4U * (1U + (i % 5U)), NULL);
+  }
+  for (i = 0U; i < 16U; i += 2U) {
+    (void)osMessageQueueDelete(mq[i]);
+  }
+
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    t = Now();
+    sem = osSemaphoreNew(1U, 0U, NULL);
+    if ((sem == NULL) || (osSemaphoreDelete(sem) != osOK)) {
+      benchErrors++;
+    }
+    BenchAdd(&statCreate, Now() - t);
+  }
+
+  for (i = 1U; i < 16U; i += 2U) {
+    (void)osMessageQueueDelete(mq[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Memory pool: uncontended alloc and free, direct and through a thread cache
+ *---------------------------------------------------------------------------*/
+
+static void BenchMemoryPool (void) {
+  osRtxMemoryPoolCache_t cache;
+  void                  *block;
+  uint32_t               t, i;
+
+  benchPool = osMemoryPoolNew(32U, sizeof(msg_t), NULL);
+  if ((benchPool == NULL) ||
+      (osRtxMemoryPoolCacheInit(&cache, benchPool, benchCacheBuf, 8U) != osOK)) {
+    benchErrors++;
+    return;
+  }
+
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    t = Now();
+    block = osMemoryPoolAlloc(benchPool, 0U);
+    if ((block == NULL) || (osMemoryPoolFree(benchPool, block) != osOK)) {
+      benchErrors++;
+    }
+    BenchAdd(&statPool, Now() - t);
+  }
+
+  // Cache refills and flushes are amortized over the samples
+  for (i = 0U; i < BENCH_ITERATIONS; i++) {
+    t = Now();
+    block = osRtxMemoryPoolCacheAlloc(&cache, 0U);
+    if ((block == NULL) || (osRtxMemoryPoolCacheFree(&cache, block) != osOK)) {
+      benchErrors++;
+    }
+    BenchAdd(&statCache, Now() - t);
+  }
+
+  osRtxMemoryPoolCacheFlush(&cache);
+  if (osMemoryPoolGetCount(benchPool) != 0U) {
+    benchErrors++;
+  }
+  (void)osMemoryPoolDelete(benchPool);
+}
+
+/*----------------------------------------------------------------------------
+ * Application main thread
+ *---------------------------------------------------------------------------*/
+
+void app_main (void *argument) {
+  (void)argument;
+
+  benchThread = osThreadGetId();
+
+  BenchContextSwitch();
+  BenchSemaphore();
+  BenchMutex();
+  BenchMessageQueue();
+  BenchRingBuffer();
+  BenchWorkQueue();
+  BenchTimer();
+  CheckWheelWrap();
+  CheckWaitOrder();
+  BenchCreate();
+  BenchMemoryPool();
+
+  // Keep the other threads from running while printing
+  (void)osKernelLock();
+
+  BenchPrint(&statSwitch);
+  BenchPrint(&statSem);
+  BenchPrint(&statSemPair);
+  BenchPrint(&statMtx);
+  BenchPrint(&statMtxPair);
+  BenchPrint(&statMsg);
+  BenchPrint(&statMsgPair);
+  BenchPrint(&statMsgDeep);
+  BenchPrint(&statRng);
+  BenchPrint(&statRngPair);
+  BenchPrint(&statWork);
+  BenchPrint(&statTimer);
+  BenchPrint(&statDelay);
+  BenchPrint(&statCreate);
+  BenchPrint(&statPool);
+  BenchPrint(&statCache);
+
+  if (benchErrors != 0U) {
+    printf("BENCH errors: %u\n", (unsigned int)benchErrors);
+  }
+
+#ifdef RTX_POSIX
+  exit((benchErrors != 0U) ? 1 : 0);
+#else
+  for (;;) {}
+#endif
+}
+
+#ifdef RTX_POSIX
+/*----------------------------------------------------------------------------
+ * Host Idle Thread and Error handler
+ *---------------------------------------------------------------------------*/
+
+__NO_RETURN void osRtxIdleThread (void *argument) {
+  (void)argument;
+
+  for (;;) {
+    // Wait for the next tick
+    (void)pause();
+  }
+}
+
+uint32_t osRtxErrorNotify (uint32_t code, void *object_id) {
+  printf("RTX error %u (object %p)\n", (unsigned int)code, object_id);
+  exit(2);
+}
+#endif
+
+/*----------------------------------------------------------------------------
+ * Main entry
+ *---------------------------------------------------------------------------*/
+
+int main (void) {
+
+  osKernelInitialize();                   // Initialize CMSIS-RTOS
+  osThreadNew(app_main, NULL, NULL);      // Create application main thread
+  osKernelStart();                        // Start thread execution
+  for (;;) {}
+}
@@ -52,6 +52,10 @@
 #endif
 #endif
 
+#endif  // RTE_Compiler_EventRecorder
+
+#if (defined(RTE_Compiler_EventRecorder) || (defined(OS_EVR_TRACE) && (OS_EVR_TRACE != 0)))
+
 /// RTOS component number
 #define EvtRtxMemoryNo                  (0xF0U)
 #define EvtRtxKernelNo                  (0xF1U)
@@ -63,7 +67,7 @@
 #define EvtRtxMemoryPoolNo              (0xF7U)
 #define EvtRtxMessageQueueNo            (0xF8U)
 
-#endif  // RTE_Compiler_EventRecorder
+#endif
 
 
 /// Extended Status codes
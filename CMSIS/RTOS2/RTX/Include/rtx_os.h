@@ -90,6 +90,8 @@ extern "C"
 #define osRtxThreadWaitingMemoryPool    ((uint8_t)(osRtxThreadBlocked | 0x70U))
 #define osRtxThreadWaitingMessageGet    ((uint8_t)(osRtxThreadBlocked | 0x80U))
 #define osRtxThreadWaitingMessagePut    ((uint8_t)(osRtxThreadBlocked | 0x90U))
+#define osRtxThreadWaitingMessageAlloc  ((uint8_t)(osRtxThreadBlocked | 0xA0U))
+#define osRtxThreadWaitingMessageReceive ((uint8_t)(osRtxThreadBlocked | 0xB0U))
  
 /// Thread Flags definitions
 #define osRtxThreadFlagDefStack 0x10U   ///< Default Stack flag
@@ -98,6 +100,21 @@ extern "C"
 #define osRtxStackMagicWord     0xE25A2EA5U ///< Stack Magic Word (Stack Base)
 #define osRtxStackFillPattern   0xCCCCCCCCU ///< Stack Fill Pattern 
  
+/// Thread Statistics definitions
+#define osRtxThreadStatsBins    8U      ///< Number of Latency Histogram bins
+#define osRtxThreadStatsShift   6U      ///< Upper bound of first bin (2^Shift timer counts)
+ 
+/// Thread Statistics Counters (RTX_THREAD_STATS)
+typedef struct {
+  uint32_t                   run_time;  ///< Run Time (low word)
+  uint32_t                run_time_hi;  ///< Run Time (high word)
+  uint32_t                   switches;  ///< Number of Switches to Thread
+  uint32_t                  timestamp;  ///< Timestamp of last Switch or Wake-up
+  uint32_t                     wakeup;  ///< Wake-up pending
+  uint32_t                latency_max;  ///< Maximum Wake-up to Run Latency
+  uint32_t latency[osRtxThreadStatsBins]; ///< Wake-up to Run Latency Histogram
+} osRtxThreadStatsInfo_t;
+ 
 /// Thread Control Block
 typedef struct osRtxThread_s {
   uint8_t                          id;  ///< Object Identifier
@@ -126,6 +143,9 @@ typedef struct osRtxThread_s {
 #ifdef RTX_TF_M_EXTENSION
   uint32_t                  tz_module;  ///< TrustZone Module Identifier
 #endif
+#ifdef RTX_THREAD_STATS
+  osRtxThreadStatsInfo_t        stats;  ///< Thread Statistics Counters
+#endif
 } osRtxThread_t;
  
  
@@ -160,6 +180,15 @@ typedef struct osRtxTimer_s {
 } osRtxTimer_t;
  
  
+//  ==== Wait List definitions ====
+ 
+/// Wait List Priority Index (allocated when a second Thread waits for an Object)
+typedef struct {
+  uint32_t                        map;  ///< Bitmap of used Priority levels (MSB first)
+  osRtxThread_t             *tail[32];  ///< Last Thread of each Priority level
+} osRtxWaitIndex_t;
+ 
+ 
 //  ==== Event Flags definitions ====
  
 /// Event Flags Control Block
@@ -170,6 +199,7 @@ typedef struct {
   uint8_t                    reserved;
   const char                    *name;  ///< Object Name
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
+  osRtxWaitIndex_t        *wait_index;  ///< Waiting Threads Priority Index
   uint32_t                event_flags;  ///< Event Flags
 } osRtxEventFlags_t;
  
@@ -184,7 +214,8 @@ typedef struct osRtxMutex_s {
   uint8_t                        attr;  ///< Object Attributes
   const char                    *name;  ///< Object Name
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
-  osRtxThread_t         *owner_thread;  ///< Owner Thread
+  osRtxWaitIndex_t        *wait_index;  ///< Waiting Threads Priority Index
+  osRtxThread_t         *owner_thread;  ///< Owner Thread (bit 0: Mutex in owner Mutex list)
   struct osRtxMutex_s     *owner_prev;  ///< Pointer to previous owned Mutex
   struct osRtxMutex_s     *owner_next;  ///< Pointer to next owned Mutex
   uint8_t                        lock;  ///< Lock counter
@@ -202,6 +233,7 @@ typedef struct {
   uint8_t                    reserved;
   const char                    *name;  ///< Object Name
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
+  osRtxWaitIndex_t        *wait_index;  ///< Waiting Threads Priority Index
   uint16_t                     tokens;  ///< Current number of tokens
   uint16_t                 max_tokens;  ///< Maximum number of tokens
 } osRtxSemaphore_t;
@@ -227,6 +259,7 @@ typedef struct {
   uint8_t                    reserved;
   const char                    *name;  ///< Object Name
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
+  osRtxWaitIndex_t        *wait_index;  ///< Waiting Threads Priority Index
   osRtxMpInfo_t               mp_info;  ///< Memory Pool Info
 } osRtxMemoryPool_t;
  
@@ -251,11 +284,14 @@ typedef struct {
   uint8_t                    reserved;
   const char                    *name;  ///< Object Name
   osRtxThread_t          *thread_list;  ///< Waiting Threads List
+  osRtxWaitIndex_t        *wait_index;  ///< Waiting Threads Priority Index
   osRtxMpInfo_t               mp_info;  ///< Memory Pool Info
   uint32_t                   msg_size;  ///< Message Size
   uint32_t                  msg_count;  ///< Number of queued Messages
   osRtxMessage_t           *msg_first;  ///< Pointer to first Message
   osRtxMessage_t            *msg_last;  ///< Pointer to last Message
+  uint32_t               msg_prio_map;  ///< Bitmap of used Priority levels (MSB first)
+  osRtxMessage_t   *msg_prio_tail[32];  ///< Last Message of each Priority level
 } osRtxMessageQueue_t;
  
  
@@ -271,6 +307,31 @@ typedef struct {
   osRtxThread_t          *thread_list;  ///< Threads List
 } osRtxObject_t;
  
+/// Generic Waitable Object Control Block
+typedef struct {
+  uint8_t                          id;  ///< Object Identifier
+  uint8_t                       state;  ///< Object State
+  uint8_t                       flags;  ///< Object Flags
+  uint8_t                    reserved;
+  const char                    *name;  ///< Object Name
+  osRtxThread_t          *thread_list;  ///< Waiting Threads List
+  osRtxWaitIndex_t        *wait_index;  ///< Waiting Threads Priority Index
+} osRtxWaitObject_t;
+ 
+ 
+//  ==== Timing Wheel definitions ====
+ 
+/// Timing Wheel dimensions (each level resolves 5 bits of time)
+#define osRtxWheelLevels        4U      ///< Number of Levels
+#define osRtxWheelSlots         32U     ///< Number of Slots per Level
+ 
+/// Timing Wheel (hierarchical, entries hold absolute expiry time)
+typedef struct {
+  uint32_t                       time;  ///< Wheel Time (last processed Tick)
+  uint32_t      map[osRtxWheelLevels];  ///< Bitmaps of used Slots per Level
+  void *slot[osRtxWheelLevels*osRtxWheelSlots]; ///< Slot List heads
+} osRtxWheel_t;
+ 
  
 //  ==== OS Runtime Information definitions ====
  
@@ -293,7 +354,7 @@ typedef struct {
     } run;
     osRtxObject_t               ready;  ///< Ready List Object
     osRtxThread_t               *idle;  ///< Idle Thread
-    osRtxThread_t         *delay_list;  ///< Delay List
+    osRtxThread_t         *delay_list;  ///< Delay List (not used, see delay_wheel)
     osRtxThread_t          *wait_list;  ///< Wait List (no Timeout)
     osRtxThread_t     *terminate_list;  ///< Terminate Thread List
     struct {                            ///< Thread Round Robin Info
@@ -303,7 +364,7 @@ typedef struct {
     } robin;
   } thread;
   struct {                              ///< Timer Info
-    osRtxTimer_t                *list;  ///< Active Timer List
+    osRtxTimer_t                *list;  ///< Active Timer List (not used, see timer_wheel)
     osRtxThread_t             *thread;  ///< Timer Thread
     osRtxMessageQueue_t           *mq;  ///< Timer Message Queue
     void                (*tick)(void);  ///< Timer Tick Function
@@ -338,6 +399,12 @@ typedef struct {
     osRtxMpInfo_t        *memory_pool;  ///< Memory Pool Control Blocks
     osRtxMpInfo_t      *message_queue;  ///< Message Queue Control Blocks
   } mpi;
+  struct {                              ///< Ready List Priority Index
+    uint32_t                   map[2];  ///< Bitmap of used Priority levels (MSB first)
+    osRtxThread_t           *tail[64];  ///< Last Thread of each Priority level
+  } ready_index;
+  osRtxWheel_t            delay_wheel;  ///< Thread Delay Timing Wheel
+  osRtxWheel_t            timer_wheel;  ///< Active Timer Timing Wheel
 } osRtxInfo_t;
  
 extern osRtxInfo_t osRtxInfo;           ///< OS Runtime Information
@@ -358,6 +425,21 @@ extern osRtxObjectMemUsage_t osRtxSemaphoreMemUsage;
 extern osRtxObjectMemUsage_t osRtxMemoryPoolMemUsage;
 extern osRtxObjectMemUsage_t osRtxMessageQueueMemUsage;
  
+/// OS Runtime Memory Statistics structure
+typedef struct {
+  uint32_t size;                        ///< Memory size
+  uint32_t used;                        ///< Used memory (including management overhead)
+  uint32_t max_used;                    ///< Maximum used memory
+  uint32_t free_blocks;                 ///< Number of free blocks
+  uint32_t max_free;                    ///< Largest block that can be allocated
+} osRtxMemoryStat_t;
+ 
+/// OS Runtime Memory Statistics function
+/// \param[in]  mem             pointer to memory (i.e. osRtxConfig.mem.common_addr).
+/// \param[out] stat            pointer to buffer for statistics.
+/// \return 1 - success, 0 - failure.
+extern uint32_t osRtxMemoryGetStat (void *mem, osRtxMemoryStat_t *stat);
+ 
  
 //  ==== OS API definitions ====
  
@@ -386,7 +468,326 @@ extern osRtxObjectMemUsage_t osRtxMessageQueueMemUsage;
 /// \param         msg_count     maximum number of messages in queue.
 /// \param         msg_size      maximum message size in bytes.
 #define osRtxMessageQueueMemSize(msg_count, msg_size) \
-  (4*(msg_count)*(3+(((msg_size)+3)/4)))
+  ((msg_count)*(sizeof(osRtxMessage_t)+(4*(((msg_size)+3)/4))))
+ 
+// Memory Heap (variable block size) overhead: Memory Pool Header, Free List
+// heads for each first level up to the heap size, Memory Block Header per
+// block with the size rounded up to the minimum free block and the last
+// Memory Block Header.
+#define osRtxMemoryHeadSize      56U
+#define osRtxMemoryBlockHeadSize (2U*sizeof(void *))
+#define osRtxMemoryBlockMin      (((5U*sizeof(void *))+7U) & ~7U)
+#define osRtxMemoryFreeListSize  (8U*sizeof(void *))
+ 
+// Integer base 2 logarithm of a constant expression (0 for 0)
+#define osRtxMemoryLog2_2(x)     (((x) >= 0x2U)    ? 1U : 0U)
+#define osRtxMemoryLog2_4(x)     (((x) >= 0x4U)    ? ( 2U + osRtxMemoryLog2_2 ((x) >>  2)) : osRtxMemoryLog2_2 (x))
+#define osRtxMemoryLog2_8(x)     (((x) >= 0x10U)   ? ( 4U + osRtxMemoryLog2_4 ((x) >>  4)) : osRtxMemoryLog2_4 (x))
+#define osRtxMemoryLog2_16(x)    (((x) >= 0x100U)  ? ( 8U + osRtxMemoryLog2_8 ((x) >>  8)) : osRtxMemoryLog2_8 (x))
+#define osRtxMemoryLog2(x)       (((x) >= 0x10000U)? (16U + osRtxMemoryLog2_16((x) >> 16)) : osRtxMemoryLog2_16(x))
+ 
+// Memory Heap size without the Free List heads
+#define osRtxMemoryHeapBlocks(block_count, data_size) \
+  (osRtxMemoryHeadSize + ((block_count)*osRtxMemoryBlockMin) + (((data_size)+7U) & ~7U) + osRtxMemoryBlockHeadSize)
+ 
+/// Memory size in bytes for Memory Heap storage.
+/// The Free List heads are reserved for a heap up to four times the size of
+/// the blocks, which is larger than the heap including them.
+/// \param         block_count   maximum number of blocks allocated at the same time.
+/// \param         data_size     combined size of the blocks in bytes.
+#define osRtxMemoryHeapSize(block_count, data_size) \
+  (osRtxMemoryHeapBlocks(block_count, data_size) + \
+  ((osRtxMemoryLog2(osRtxMemoryHeapBlocks(block_count, data_size)) - 2U)*osRtxMemoryFreeListSize))
+ 
+/// Minimum Memory Heap size in bytes: the overhead of a heap holding one block.
+#define osRtxMemoryHeapMin       osRtxMemoryHeapSize(1U, 0U)
+ 
+ 
+//  ==== OS Thread Statistics Extension ====
+ 
+// Thread run time and wake-up to run latency accounting in osRtxThreadSwitch,
+// enabled by defining RTX_THREAD_STATS for the whole project (it extends the
+// Thread Control Block). Times are in kernel system timer counts.
+// Latency histogram bin n counts latencies below 2^(osRtxThreadStatsShift+2*n)
+// timer counts, the last bin counts all longer latencies.
+ 
+/// Thread Statistics
+typedef struct {
+  uint64_t                   run_time;  ///< Cumulative Run Time
+  uint32_t                   switches;  ///< Number of Switches to Thread
+  uint32_t                latency_max;  ///< Maximum Wake-up to Run Latency
+  uint32_t latency[osRtxThreadStatsBins]; ///< Wake-up to Run Latency Histogram
+} osRtxThreadStats_t;
+ 
+#ifdef RTX_THREAD_STATS
+/// Get a snapshot of the Statistics of a Thread.
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or \ref osThreadGetId.
+/// \param[out]    stats         pointer to buffer for thread statistics.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxThreadGetStats (osThreadId_t thread_id, osRtxThreadStats_t *stats);
+#endif
+ 
+ 
+//  ==== OS Memory Pool Extension ====
+ 
+// Bulk operations allocate or free multiple Blocks with one kernel entry.
+// A Memory Pool Cache (magazine) holds free Blocks for one Thread: it is
+// refilled with half of its size from the Memory Pool when empty and half
+// of it is returned when full, so that Blocks are mostly allocated and freed
+// without kernel entry. Cached Blocks count as used Blocks of the Memory Pool.
+ 
+/// Memory Pool Cache
+typedef struct {
+  osMemoryPoolId_t              mp_id;  ///< Memory Pool
+  void                       **blocks;  ///< Cached Blocks
+  uint32_t                       size;  ///< Maximum number of cached Blocks
+  uint32_t                      count;  ///< Number of cached Blocks
+} osRtxMemoryPoolCache_t;
+ 
+/// Allocate multiple memory blocks from a Memory Pool without wait.
+/// \param[in]     mp_id         memory pool ID obtained by \ref osMemoryPoolNew.
+/// \param[out]    blocks        pointer to array for the addresses of the allocated memory blocks.
+/// \param[in]     count         maximum number of memory blocks to allocate.
+/// \return number of allocated memory blocks.
+extern uint32_t osRtxMemoryPoolAllocBulk (osMemoryPoolId_t mp_id, void **blocks, uint32_t count);
+ 
+/// Return multiple allocated memory blocks back to a Memory Pool.
+/// \param[in]     mp_id         memory pool ID obtained by \ref osMemoryPoolNew.
+/// \param[in]     blocks        pointer to array of the addresses of the memory blocks.
+/// \param[in]     count         number of memory blocks to return.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMemoryPoolFreeBulk (osMemoryPoolId_t mp_id, void * const *blocks, uint32_t count);
+ 
+/// Initialize a Memory Pool Cache.
+/// \param[out]    cache         memory pool cache object.
+/// \param[in]     mp_id         memory pool ID obtained by \ref osMemoryPoolNew.
+/// \param[in]     blocks        pointer to array for the addresses of the cached memory blocks.
+/// \param[in]     size          number of entries in blocks array (at least 2).
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMemoryPoolCacheInit (osRtxMemoryPoolCache_t *cache, osMemoryPoolId_t mp_id, void **blocks, uint32_t size);
+ 
+/// Allocate a memory block through a Memory Pool Cache.
+/// \param[in]     cache         memory pool cache object.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out (used when the Memory Pool is empty).
+/// \return address of the allocated memory block or NULL in case of no memory is available.
+extern void *osRtxMemoryPoolCacheAlloc (osRtxMemoryPoolCache_t *cache, uint32_t timeout);
+ 
+/// Return an allocated memory block through a Memory Pool Cache.
+/// \param[in]     cache         memory pool cache object.
+/// \param[in]     block         address of the allocated memory block.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMemoryPoolCacheFree (osRtxMemoryPoolCache_t *cache, void *block);
+ 
+/// Return all memory blocks held by a Memory Pool Cache to the Memory Pool.
+/// \param[in]     cache         memory pool cache object.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMemoryPoolCacheFlush (osRtxMemoryPoolCache_t *cache);
+ 
+ 
+//  ==== OS Message Queue Extension ====
+ 
+// Zero-copy Message access: a Message is loaned from the Queue memory by
+// osRtxMessageQueueAlloc or osRtxMessageQueueReceive and returned by
+// osRtxMessageQueueCommit (put into Queue) or osRtxMessageQueueRelease.
+// Loaned Messages occupy Queue capacity until they are returned.
+ 
+/// Allocate a Message in a Queue to be filled in place.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[out]    msg_ptr       pointer to buffer for the pointer to message data.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMessageQueueAlloc (osMessageQueueId_t mq_id, void **msg_ptr, uint32_t timeout);
+ 
+/// Put a Message allocated by \ref osRtxMessageQueueAlloc into a Queue.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]     msg_ptr       pointer to message data.
+/// \param[in]     msg_prio      message priority.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio);
+ 
+/// Receive a Message from a Queue without copy or timeout if Queue is empty.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[out]    msg_ptr       pointer to buffer for the pointer to message data.
+/// \param[out]    msg_prio      pointer to buffer for message priority or NULL.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMessageQueueReceive (osMessageQueueId_t mq_id, void **msg_ptr, uint8_t *msg_prio, uint32_t timeout);
+ 
+/// Release a received or allocated Message back to a Queue.
+/// \param[in]     mq_id         message queue ID obtained by \ref osMessageQueueNew.
+/// \param[in]     msg_ptr       pointer to message data.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr);
+ 
+ 
+//  ==== OS Ring Buffer Extension ====
+ 
+// Lock-free Ring Buffer of fixed size elements with a single consumer and one
+// (osRtxRingBufferSingleProducer) or several producers (Threads or ISRs).
+// Push and Pop do not enter the kernel: an ISR hands data to a Thread without
+// a service call or ISR post-processing. A Thread can be notified with Thread
+// Flags when the Ring Buffer becomes not empty.
+ 
+#define osRtxRingBufferSingleProducer   0x00U   ///< One producer
+#define osRtxRingBufferMultiProducer    0x01U   ///< Several producers (may preempt each other)
+ 
+#define osRtxRingBufferCacheLine        32U     ///< Cache line size separating producer and consumer data
+ 
+/// Ring Buffer Control Block (align to osRtxRingBufferCacheLine)
+typedef struct {
+  uint32_t                       head;  ///< Write Index (published)
+  uint32_t                    reserve;  ///< Write Index (reserved) <31:8> and active producers <7:0>
+  uint8_t  reserved_put[osRtxRingBufferCacheLine - 8U];
+  uint32_t                       tail;  ///< Read Index
+  uint8_t  reserved_get[osRtxRingBufferCacheLine - 4U];
+  uint8_t                        *buf;  ///< Element Buffer
+  uint32_t                       mask;  ///< Index Mask (number of elements - 1)
+  uint32_t                  elem_size;  ///< Element Size
+  uint32_t                      flags;  ///< Ring Buffer Flags
+  osThreadId_t                 thread;  ///< Thread notified when Ring Buffer becomes not empty
+  uint32_t               thread_flags;  ///< Thread Flags to set on notification
+} osRtxRingBuffer_t;
+ 
+/// Initialize a Ring Buffer.
+/// \param[out]    rb            ring buffer control block.
+/// \param[in]     buf           element buffer (elem_count * elem_size bytes).
+/// \param[in]     elem_count    number of elements (power of 2, maximum 0x800000).
+/// \param[in]     elem_size     element size in bytes.
+/// \param[in]     flags         osRtxRingBufferSingleProducer or osRtxRingBufferMultiProducer.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxRingBufferInit (osRtxRingBuffer_t *rb, void *buf, uint32_t elem_count, uint32_t elem_size, uint32_t flags);
+ 
+/// Set the Thread notified when a Ring Buffer becomes not empty.
+/// \param[in]     rb            ring buffer control block.
+/// \param[in]     thread_id     thread ID obtained by \ref osThreadNew or NULL (no notification).
+/// \param[in]     thread_flags  thread flags to set.
+extern void osRtxRingBufferNotify (osRtxRingBuffer_t *rb, osThreadId_t thread_id, uint32_t thread_flags);
+ 
+/// Put Elements into a Ring Buffer (from Threads and ISRs).
+/// \param[in]     rb            ring buffer control block.
+/// \param[in]     data          pointer to elements.
+/// \param[in]     count         number of elements.
+/// \return number of elements put (less than count when Ring Buffer is full).
+extern uint32_t osRtxRingBufferPush (osRtxRingBuffer_t *rb, const void *data, uint32_t count);
+ 
+/// Get Elements from a Ring Buffer (single consumer, from Thread or ISR).
+/// \param[in]     rb            ring buffer control block.
+/// \param[out]    data          pointer to buffer for elements.
+/// \param[in]     count         maximum number of elements.
+/// \return number of elements get (0 when Ring Buffer is empty).
+extern uint32_t osRtxRingBufferPop (osRtxRingBuffer_t *rb, void *data, uint32_t count);
+ 
+/// Get number of Elements in a Ring Buffer.
+/// \param[in]     rb            ring buffer control block.
+/// \return number of elements.
+extern uint32_t osRtxRingBufferGetCount (const osRtxRingBuffer_t *rb);
+ 
+ 
+//  ==== OS Work Queue Extension ====
+ 
+// Work Items (function and argument) are submitted by Threads and ISRs to a
+// Work Queue and executed in submission order by one or more worker Threads
+// running osRtxWorkQueueThread. Delayed Work Items are kept on the kernel
+// Timer list until they expire (the Timer Callback Queue must hold the delayed
+// Work Items expiring at the same time). A Work Item is pending at most once.
+// A delayed Work Item canceled after its Delay expired stays busy until the
+// Timer Thread has run its callback: meanwhile it can only be submitted again
+// without delay to the same Work Queue.
+ 
+/// Work Item State definitions
+#define osRtxWorkIdle           0x00U   ///< Work Item Idle (not pending)
+#define osRtxWorkDelayed        0x01U   ///< Work Item waiting for Delay
+#define osRtxWorkQueued         0x02U   ///< Work Item in Work Queue
+#define osRtxWorkCanceled       0x03U   ///< Work Item in Work Queue but canceled
+#define osRtxWorkDelayCanceled  0x04U   ///< Work Item canceled with Delay Timer callback pending
+ 
+/// Work Item Function.
+typedef void (*osRtxWorkFunc_t) (void *argument);
+ 
+/// Work Item Control Block
+typedef struct osRtxWork_s {
+  struct osRtxWork_s            *next;  ///< Link pointer to next Work Item
+  uint32_t                      state;  ///< Work Item State
+  osRtxWorkFunc_t                func;  ///< Function Pointer
+  void                           *arg;  ///< Function Argument
+  struct osRtxWorkQueue_s *work_queue;  ///< Work Queue of delayed submission
+  osTimerId_t                   timer;  ///< Delay Timer
+  osRtxTimer_t               timer_cb;  ///< Delay Timer Control Block
+} osRtxWork_t;
+ 
+/// Work Queue Control Block
+typedef struct osRtxWorkQueue_s {
+  osRtxWork_t                *pending;  ///< Submitted Work Items (last submitted first)
+  osRtxWork_t                   *head;  ///< Queued Work Items (in submission order)
+  osSemaphoreId_t           semaphore;  ///< Number of pending Work Items
+  osMutexId_t                   mutex;  ///< Queue Lock (worker Threads)
+  osRtxSemaphore_t       semaphore_cb;  ///< Semaphore Control Block
+  osRtxMutex_t               mutex_cb;  ///< Mutex Control Block
+} osRtxWorkQueue_t;
+ 
+/// Initialize a Work Queue (from Thread).
+/// \param[out]    wq            work queue control block.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxWorkQueueInit (osRtxWorkQueue_t *wq);
+ 
+/// Worker Thread function executing the Work Items of a Work Queue.
+/// \param[in]     argument      work queue control block.
+extern void osRtxWorkQueueThread (void *argument);
+ 
+/// Initialize a Work Item (from Thread).
+/// \param[out]    work          work item control block.
+/// \param[in]     func          work item function.
+/// \param[in]     argument      argument passed to the work item function.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxWorkInit (osRtxWork_t *work, osRtxWorkFunc_t func, void *argument);
+ 
+/// Submit a Work Item to a Work Queue.
+/// \param[in]     wq            work queue control block.
+/// \param[in]     work          work item control block.
+/// \param[in]     delay         \ref CMSIS_RTOS_TimeOutValue "time ticks" value or 0 (no delay, also from ISR).
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxWorkSubmit (osRtxWorkQueue_t *wq, osRtxWork_t *work, uint32_t delay);
+ 
+/// Cancel a pending Work Item.
+/// \param[in]     work          work item control block.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRtxWorkCancel (osRtxWork_t *work);
+ 
+ 
+//  ==== OS Binary Trace ====
+ 
+// RTX events are recorded in the Binary Trace buffer instead of the Event
+// Recorder when OS_EVR_TRACE is enabled in RTX_Config.h. The buffer is a ring
+// of 8-byte records overwriting the oldest records:
+//  - info: timestamp <31:10> (low 22 bits), event ID <9:0>
+//    (component number <9:6> (low 4 bits), message number <5:0>)
+//  - val:  first event argument (object ID for most events)
+// A Sync record (event ID osRtxTraceIdSync) holds the full 32-bit timestamp.
+// It is recorded first, every 64 records and before a record following a gap
+// of 2^21 or more timestamp counts.
+ 
+#define osRtxTraceMagic         0x54585452U ///< Trace Buffer Magic Word ("RTXT")
+#define osRtxTraceIdSync        0x3FFU      ///< Sync Record Event ID
+ 
+/// Binary Trace Record
+typedef struct {
+  uint32_t                       info;  ///< Timestamp and Event ID
+  uint32_t                        val;  ///< First Event Argument
+} osRtxTraceRecord_t;
+ 
+/// Binary Trace Buffer
+typedef struct {
+  uint32_t                      magic;  ///< Magic Word (osRtxTraceMagic)
+  uint32_t                       size;  ///< Number of Records (power of 2)
+  uint32_t                      level;  ///< Recorded Event Levels
+  uint32_t                       freq;  ///< Timestamp Frequency
+  uint32_t                       idle;  ///< Idle Thread ID
+  uint32_t                      index;  ///< Next Record Index (free running)
+  uint32_t                  timestamp;  ///< Timestamp of last Record
+  osRtxTraceRecord_t          *record;  ///< Records
+} osRtxTrace_t;
+ 
+extern osRtxTrace_t osRtxTrace;         ///< Binary Trace Buffer
  
  
 //  ==== OS External Functions ====
@@ -404,6 +805,15 @@ extern uint32_t osRtxErrorNotify (uint32_t code, void *object_id);
 /// OS Idle Thread
 extern void osRtxIdleThread (void *argument);
  
+/// OS Tick-less Idle: sleep with the Kernel Tick suspended until the next timeout (called by the Idle Thread).
+/// \param[in]     min_ticks     minimum number of ticks to the next timeout to suspend the Kernel Tick.
+extern void osRtxKernelIdle (uint32_t min_ticks);
+ 
+/// OS Tick-less Idle sleep hook (default: wait for interrupt)
+/// \param[in]     ticks         ticks until the programmed tick interrupt (called with interrupts disabled)
+///                              or 0 (periodic Kernel Tick, called with interrupts enabled).
+extern void osRtxIdleSleep (uint32_t ticks);
+ 
 /// OS Exception handlers
 extern void SVC_Handler     (void);
 extern void PendSV_Handler  (void);
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2013-2018 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host Exception handlers
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <signal.h>
+#include "rtx_lib.h"
+
+
+// Non weak library reference
+uint8_t irqRtxLib;
+
+
+//  ==== Emulated Core State ====
+
+volatile uint32_t   osRtxPosixIPSR;
+volatile uint32_t   osRtxPosixPRIMASK;
+         uint32_t   osRtxPosixPending;
+osRtxPosixFrame_t  *osRtxPosixPSP;
+
+// Context used to start a thread for the first time
+static ucontext_t   ThreadInitContext;
+
+// Signal mask of Thread mode
+static sigset_t     ThreadSigMask;
+static uint32_t     ThreadSigMaskValid;
+
+
+//  ==== Helper functions ====
+
+/// Thread entry: completes the exception return and calls the thread function.
+static void ThreadEntry (void) {
+  osRtxPosixFrame_t frame;
+  os_thread_t      *thread;
+  const uint32_t   *ptr;
+  osThreadFunc_t    func;
+  void             *argument;
+
+  // Read PC and R0 from the initial stack frame
+  thread   = osRtxInfo.thread.run.curr;
+  //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+  ptr      = (const uint32_t *)(uintptr_t)thread->sp;
+  //lint -e{923} -e{9074} "cast from unsigned int to pointer to function"
+  func     = (osThreadFunc_t)(uintptr_t)ptr[14];
+  //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+  argument = (void *)(uintptr_t)ptr[8];
+
+  (void)osRtxPosixSvcExit(&frame);
+
+  func(argument);
+
+  osThreadExit();
+}
+
+/// Get context of a thread.
+/// \param[in]  thread          thread object.
+/// \return pointer to the context to restore.
+static ucontext_t *ThreadContext (os_thread_t *thread) {
+  ucontext_t *ctx;
+
+  if (thread->stack_frame == STACK_FRAME_CONTEXT) {
+    //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+    ctx = &((osRtxPosixFrame_t *)(uintptr_t)thread->sp)->ctx;
+  } else {
+    // First run: execute ThreadEntry on the stack below the initial frame
+    ctx = &ThreadInitContext;
+    (void)getcontext(ctx);
+    ctx->uc_stack.ss_sp   = thread->stack_mem;
+    //lint -e{923} "cast from pointer to unsigned int"
+    ctx->uc_stack.ss_size = thread->sp - (uint32_t)(uintptr_t)thread->stack_mem;
+    ctx->uc_link          = NULL;
+    ctx->uc_sigmask       = ThreadSigMask;
+    makecontext(ctx, ThreadEntry, 0);
+  }
+
+  return ctx;
+}
+
+/// Take pending exceptions in Thread mode.
+static void ExcTake (void) {
+  osRtxPosixFrame_t frame;
+
+  osRtxPosixIPSR = POSIX_EXC_PENDSV;
+  (void)osRtxPosixSvcExit(&frame);
+}
+
+
+//  ==== Service Calls ====
+
+/// Enter Handler mode for a Service Call.
+/// \param[in]  frame           exception frame of the caller.
+void osRtxPosixSvcEnter (osRtxPosixFrame_t *frame) {
+
+  if (ThreadSigMaskValid == 0U) {
+    (void)sigprocmask(SIG_SETMASK, NULL, &ThreadSigMask);
+    ThreadSigMaskValid = 1U;
+  }
+
+  osRtxPosixIPSR = POSIX_EXC_SVC;
+  osRtxPosixPSP  = frame;
+}
+
+/// Exception return: tail-chain pending exceptions, switch thread and return to Thread mode.
+/// \param[in]  frame           exception frame of the running thread.
+/// \return 1 when the thread has been switched out and resumed, 0 otherwise.
+uint32_t osRtxPosixSvcExit (osRtxPosixFrame_t *frame) {
+  os_thread_t *thread_curr;
+  os_thread_t *thread_next;
+  ucontext_t  *ctx;
+  uint32_t     switched = 0U;
+
+  for (;;) {
+    // Context switch completes before any pending exception is taken
+    thread_curr = osRtxInfo.thread.run.curr;
+    thread_next = osRtxInfo.thread.run.next;
+    if (thread_curr != thread_next) {
+      osRtxInfo.thread.run.curr = thread_next;
+      ctx = ThreadContext(thread_next);
+      if (thread_curr == NULL) {
+        // Running thread is deleted
+        (void)setcontext(ctx);
+      }
+      //lint -e{923} "cast from pointer to unsigned int"
+      thread_curr->sp          = (uint32_t)(uintptr_t)frame;
+      thread_curr->stack_frame = STACK_FRAME_CONTEXT;
+      (void)swapcontext(&frame->ctx, ctx);
+      switched = 1U;
+      continue;
+    }
+
+    // Tail-chain pending exceptions
+    if (atomic_chk32_any(&osRtxPosixPending, POSIX_PEND_SYSTICK) != 0U) {
+      osRtxPosixIPSR = POSIX_EXC_SYSTICK;
+      osRtxTick_Handler();
+      continue;
+    }
+    if (atomic_chk32_any(&osRtxPosixPending, POSIX_PEND_PENDSV) != 0U) {
+      osRtxPosixIPSR = POSIX_EXC_PENDSV;
+      osRtxPendSV_Handler();
+      continue;
+    }
+
+    // Return to Thread mode
+    osRtxPosixIPSR = 0U;
+    if ((__atomic_load_n(&osRtxPosixPending, __ATOMIC_SEQ_CST) == 0U) || (osRtxPosixPRIMASK != 0U)) {
+      break;
+    }
+    osRtxPosixIPSR = POSIX_EXC_PENDSV;
+  }
+
+  return switched;
+}
+
+/// Set pending exception and take it when not masked.
+/// \param[in]  pend            pending exception flags.
+void osRtxPosixSetPending (uint32_t pend) {
+
+  (void)atomic_set32(&osRtxPosixPending, pend);
+
+  if ((osRtxPosixIPSR == 0U) && (osRtxPosixPRIMASK == 0U)) {
+    ExcTake();
+  }
+}
+
+/// Enable interrupts and take pending exceptions.
+void osRtxPosixEnableIrq (void) {
+
+  osRtxPosixPRIMASK = 0U;
+
+  if ((osRtxPosixIPSR == 0U) && (__atomic_load_n(&osRtxPosixPending, __ATOMIC_SEQ_CST) != 0U)) {
+    ExcTake();
+  }
+}
+
+/// Wait for interrupt: sleep until a signal is taken or an exception is pending.
+void osRtxPosixWaitForIrq (void) {
+  sigset_t mask;
+  sigset_t mask_old;
+
+  (void)sigfillset(&mask);
+  (void)sigprocmask(SIG_BLOCK, &mask, &mask_old);
+  if (__atomic_load_n(&osRtxPosixPending, __ATOMIC_SEQ_CST) == 0U) {
+    (void)sigsuspend(&mask_old);
+  }
+  (void)sigprocmask(SIG_SETMASK, &mask_old, NULL);
+}
+
+
+//  ==== Exception Handlers ====
+
+/// SysTick Handler (called from the tick signal).
+void SysTick_Handler (void) {
+  osRtxPosixFrame_t frame;
+
+  if ((osRtxPosixIPSR != 0U) || (osRtxPosixPRIMASK != 0U)) {
+    // Exception is masked: keep it pending
+    (void)atomic_set32(&osRtxPosixPending, POSIX_PEND_SYSTICK);
+    return;
+  }
+
+  osRtxPosixIPSR = POSIX_EXC_SYSTICK;
+  osRtxTick_Handler();
+  (void)osRtxPosixSvcExit(&frame);
+}
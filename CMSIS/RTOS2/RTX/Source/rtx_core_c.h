@@ -26,6 +26,12 @@
 #ifndef RTX_CORE_C_H_
 #define RTX_CORE_C_H_
 
+#if   defined(RTX_POSIX)
+
+#include "rtx_core_posix.h"
+
+#else
+
 //lint -emacro((923,9078),SCB) "cast from unsigned long to pointer" [MISRA Note 9]
 #include "RTE_Components.h"
 #include CMSIS_device_header
@@ -45,4 +51,6 @@
 #include "rtx_core_cm.h"
 #endif
 
+#endif  // RTX_POSIX
+
 #endif  // RTX_CORE_C_H_
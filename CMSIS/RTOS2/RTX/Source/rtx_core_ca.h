@@ -1005,6 +1005,65 @@ __STATIC_INLINE uint16_t atomic_dec16_nz (uint16_t *mem) {
 }
 #endif
 
+/// Atomic Access Operation: Compare and Swap (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  old             Expected value
+/// \param[in]  val             New value
+/// \return                     Previous value (new value written when equal to expected value)
+#if defined(__CC_ARM)
+static __asm    uint32_t atomic_cas32 (uint32_t *mem, uint32_t old, uint32_t val) {
+  push  {r4,lr}
+  mov   r3,r0
+1
+  ldrex r0,[r3]
+  cmp   r0,r1
+  beq   %F2
+  clrex
+  pop   {r4,pc}
+2
+  strex r4,r2,[r3]
+  cmp   r4,#0
+  bne   %B1
+  pop   {r4,pc}
+}
+#else
+__STATIC_INLINE uint32_t atomic_cas32 (uint32_t *mem, uint32_t old, uint32_t val) {
+#ifdef  __ICCARM__
+#pragma diag_suppress=Pe550
+#endif
+  register uint32_t res;
+#ifdef  __ICCARM__
+#pragma diag_default=Pe550
+#endif
+  register uint32_t ret;
+
+  __ASM volatile (
+#ifndef __ICCARM__
+  ".syntax unified\n\t"
+#endif
+  "1:\n\t"
+    "ldrex %[ret],[%[mem]]\n\t"
+    "cmp   %[ret],%[old]\n\t"
+    "beq   2f\n\t"
+    "clrex\n\t"
+    "b     3f\n"
+  "2:\n\t"
+    "strex %[res],%[val],[%[mem]]\n\t"
+    "cmp   %[res],#0\n\t"
+    "bne   1b\n"
+  "3:"
+  : [ret] "=&l" (ret),
+    [res] "=&l" (res)
+  : [mem] "l"   (mem),
+    [old] "l"   (old),
+    [val] "l"   (val)
+  : "cc", "memory"
+  );
+
+  return ret;
+}
+#endif
+
 /// Atomic Access Operation: Link Get
 /// \param[in]  root            Root address
 /// \return                     Link
@@ -0,0 +1,437 @@
+/*
+ * Copyright (c) 2013-2018 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       POSIX Host Core definitions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef RTX_CORE_POSIX_H_
+#define RTX_CORE_POSIX_H_
+
+// The POSIX host port runs the kernel as a single host process (RTX_POSIX):
+//  - threads are ucontext contexts running on the RTX thread stacks,
+//  - the tick is a timer signal (os_tick_posix.c) acting as SysTick,
+//  - service calls are direct calls with the emulated handler mode set,
+//  - SysTick and PendSV taken while in handler mode or with PRIMASK set
+//    are latched and tail-chained on exception return (irq_posix.c).
+//
+// The kernel keeps addresses in 32-bit words (stack pointers, stacked
+// registers). On 64-bit hosts the image must therefore be linked with
+// -no-pie so that kernel objects, thread stacks and thread functions are
+// located below 4GB, and objects passed to the kernel must not be placed
+// on the stack of main(). Thread stacks hold host signal frames and need
+// to be sized accordingly (16KB or more), memory pool blocks need to be
+// at least pointer sized.
+
+#include <stdint.h>
+#include <ucontext.h>
+#include "cmsis_compiler.h"
+
+#include <stdbool.h>
+typedef bool bool_t;
+#define FALSE                   ((bool_t)0)
+#define TRUE                    ((bool_t)1)
+
+#define DOMAIN_NS               0
+
+#define EXCLUSIVE_ACCESS        1
+
+#define OS_TICK_HANDLER         SysTick_Handler
+
+/// xPSR_Initialization Value
+/// \param[in]  privileged      true=privileged, false=unprivileged
+/// \param[in]  thumb           true=Thumb, false=ARM
+/// \return                     xPSR Init Value
+__STATIC_INLINE uint32_t xPSR_InitVal (bool_t privileged, bool_t thumb) {
+  (void)privileged;
+  (void)thumb;
+  return (0x01000000U);
+}
+
+// Stack Frame:
+//  - Initial: R4-R11, R0-R3, R12, LR, PC, xPSR (built by osThreadNew)
+//  - Context: osRtxPosixFrame_t (thread has been running)
+
+/// Stack Frame Initialization Value
+#define STACK_FRAME_INIT_VAL    0xFDU
+
+/// Stack Frame of a started thread
+#define STACK_FRAME_CONTEXT     0x00U
+
+/// Stack Offset of Register R0
+/// \param[in]  stack_frame     Stack Frame
+/// \return                     R0 Offset
+__STATIC_INLINE uint32_t StackOffsetR0 (uint8_t stack_frame) {
+  return ((stack_frame == STACK_FRAME_INIT_VAL) ? (8U*4U) : 0U);
+}
+
+
+//  ==== Emulated Core ====
+
+/// Exception Frame: stacked registers and saved thread context
+typedef struct {
+  uint32_t              r[4];           ///< Registers R0..R3 (parameters and return value)
+  ucontext_t            ctx;            ///< Thread context when switched out
+} osRtxPosixFrame_t;
+
+/// Exception numbers
+#define POSIX_EXC_SVC           11U
+#define POSIX_EXC_PENDSV        14U
+#define POSIX_EXC_SYSTICK       15U
+
+/// Pending exception flags
+#define POSIX_PEND_PENDSV       0x01U
+#define POSIX_PEND_SYSTICK      0x02U
+
+extern volatile uint32_t   osRtxPosixIPSR;      ///< Active exception (0=Thread mode)
+extern volatile uint32_t   osRtxPosixPRIMASK;   ///< Interrupt mask
+extern          uint32_t   osRtxPosixPending;   ///< Pending exceptions
+extern osRtxPosixFrame_t  *osRtxPosixPSP;       ///< Exception Frame of the running service call
+
+extern void     osRtxPosixSvcEnter (osRtxPosixFrame_t *frame);
+extern uint32_t osRtxPosixSvcExit  (osRtxPosixFrame_t *frame);
+extern void     osRtxPosixSetPending (uint32_t pend);
+extern void     osRtxPosixEnableIrq  (void);
+extern void     osRtxPosixWaitForIrq (void);
+
+// Core register access (replaces the Cortex-M intrinsics)
+#define __get_PSP()             ((uint32_t)(uintptr_t)osRtxPosixPSP)
+#define __set_CONTROL(control)  ((void)(control))
+#define __get_PRIMASK()         (osRtxPosixPRIMASK)
+#define __disable_irq()         (osRtxPosixPRIMASK = 1U)
+#define __enable_irq()          osRtxPosixEnableIrq()
+#define __DSB()                 __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DMB()                 __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#undef  __WFI
+#define __WFI()                 osRtxPosixWaitForIrq()
+
+
+//  ==== Core functions ====
+
+/// Check if running Privileged
+/// \return     true=privileged, false=unprivileged
+__STATIC_INLINE bool_t IsPrivileged (void) {
+  return TRUE;
+}
+
+/// Check if in IRQ Mode
+/// \return     true=IRQ, false=thread
+__STATIC_INLINE bool_t IsIrqMode (void) {
+  return (osRtxPosixIPSR != 0U);
+}
+
+/// Check if IRQ is Masked
+/// \return     true=masked, false=not masked
+__STATIC_INLINE bool_t IsIrqMasked (void) {
+  return (osRtxPosixPRIMASK != 0U);
+}
+
+
+//  ==== Core Peripherals functions ====
+
+/// Setup SVC and PendSV System Service Calls
+__STATIC_INLINE void SVC_Setup (void) {
+}
+
+/// Get Pending SV (Service Call) Flag
+/// \return     Pending SV Flag
+__STATIC_INLINE uint8_t GetPendSV (void) {
+  return ((uint8_t)(__atomic_load_n(&osRtxPosixPending, __ATOMIC_SEQ_CST) & POSIX_PEND_PENDSV));
+}
+
+/// Clear Pending SV (Service Call) Flag
+__STATIC_INLINE void ClrPendSV (void) {
+  (void)__atomic_fetch_and(&osRtxPosixPending, ~POSIX_PEND_PENDSV, __ATOMIC_SEQ_CST);
+}
+
+/// Set Pending SV (Service Call) Flag
+__STATIC_INLINE void SetPendSV (void) {
+  osRtxPosixSetPending(POSIX_PEND_PENDSV);
+}
+
+
+//  ==== Service Calls definitions ====
+
+//lint -save -e9023 -e9024 -e9026 "Function-like macros using '#/##'" [MISRA Note 10]
+
+#define SVC_ArgR(n,a)                                                          \
+  __frame.r[n] = (uint32_t)(uintptr_t)(a);
+
+#define SVC_Ret(t)                                                             \
+  __frame.r[0] = (uint32_t)(uintptr_t)__ret;                                   \
+  if (osRtxPosixSvcExit(&__frame) != 0U) {                                     \
+    __ret = (t)(uintptr_t)__frame.r[0];                                        \
+  }                                                                            \
+  return __ret;
+
+#define SVC0_0N(f,t)                                                           \
+__STATIC_INLINE t __svc##f (void) {                                            \
+  osRtxPosixFrame_t __frame;                                                   \
+  osRtxPosixSvcEnter(&__frame);                                                \
+  svcRtx##f();                                                                 \
+  (void)osRtxPosixSvcExit(&__frame);                                           \
+}
+
+#define SVC0_0(f,t)                                                            \
+__STATIC_INLINE t __svc##f (void) {                                            \
+  osRtxPosixFrame_t __frame;                                                   \
+  t __ret;                                                                     \
+  osRtxPosixSvcEnter(&__frame);                                                \
+  __ret = svcRtx##f();                                                         \
+  SVC_Ret(t)                                                                   \
+}
+
+#define SVC0_1N(f,t,t1)                                                        \
+__STATIC_INLINE t __svc##f (t1 a1) {                                           \
+  osRtxPosixFrame_t __frame;                                                   \
+  SVC_ArgR(0,a1)                                                               \
+  osRtxPosixSvcEnter(&__frame);                                                \
+  svcRtx##f(a1);                                                               \
+  (void)osRtxPosixSvcExit(&__frame);                                           \
+}
+
+#define SVC0_1(f,t,t1)                                                         \
+__STATIC_INLINE t __svc##f (t1 a1) {                                           \
+  osRtxPosixFrame_t __frame;                                                   \
+  t __ret;                                                                     \
+  SVC_ArgR(0,a1)                                                               \
+  osRtxPosixSvcEnter(&__frame);                                                \
+  __ret = svcRtx##f(a1);                                                       \
+  SVC_Ret(t)                                                                   \
+}
+
+#define SVC0_2(f,t,t1,t2)                                                      \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2) {                                    \
+  osRtxPosixFrame_t __frame;                                                   \
+  t __ret;                                                                     \
+  SVC_ArgR(0,a1)                                                               \
+  SVC_ArgR(1,a2)                                                               \
+  osRtxPosixSvcEnter(&__frame);                                                \
+  __ret = svcRtx##f(a1,a2);                                                    \
+  SVC_Ret(t)                                                                   \
+}
+
+#define SVC0_3(f,t,t1,t2,t3)                                                   \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2, t3 a3) {                             \
+  osRtxPosixFrame_t __frame;                                                   \
+  t __ret;                                                                     \
+  SVC_ArgR(0,a1)                                                               \
+  SVC_ArgR(1,a2)                                                               \
+  SVC_ArgR(2,a3)                                                               \
+  osRtxPosixSvcEnter(&__frame);                                                \
+  __ret = svcRtx##f(a1,a2,a3);                                                 \
+  SVC_Ret(t)                                                                   \
+}
+
+#define SVC0_4(f,t,t1,t2,t3,t4)                                                \
+__STATIC_INLINE t __svc##f (t1 a1, t2 a2, t3 a3, t4 a4) {                      \
+  osRtxPosixFrame_t __frame;                                                   \
+  t __ret;                                                                     \
+  SVC_ArgR(0,a1)                                                               \
+  SVC_ArgR(1,a2)                                                               \
+  SVC_ArgR(2,a3)                                                               \
+  SVC_ArgR(3,a4)                                                               \
+  osRtxPosixSvcEnter(&__frame);                                                \
+  __ret = svcRtx##f(a1,a2,a3,a4);                                              \
+  SVC_Ret(t)                                                                   \
+}
+
+//lint -restore [MISRA Note 10]
+
+
+//  ==== Exclusive Access Operation ====
+
+#if (EXCLUSIVE_ACCESS == 1)
+
+/// Atomic Access Operation: Write (8-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  val             Value to write
+/// \return                     Previous value
+__STATIC_INLINE uint8_t atomic_wr8 (uint8_t *mem, uint8_t val) {
+  return __atomic_exchange_n(mem, val, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Set bits (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     New value
+__STATIC_INLINE uint32_t atomic_set32 (uint32_t *mem, uint32_t bits) {
+  return __atomic_or_fetch(mem, bits, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Clear bits (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_clr32 (uint32_t *mem, uint32_t bits) {
+  return __atomic_fetch_and(mem, ~bits, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Check if all specified bits (32-bit) are active and clear them
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Active bits before clearing or 0 if not active
+__STATIC_INLINE uint32_t atomic_chk32_all (uint32_t *mem, uint32_t bits) {
+  uint32_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if ((ret & bits) != bits) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, ret & ~bits, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Check if any specified bits (32-bit) are active and clear them
+/// \param[in]  mem             Memory address
+/// \param[in]  bits            Bit mask
+/// \return                     Active bits before clearing or 0 if not active
+__STATIC_INLINE uint32_t atomic_chk32_any (uint32_t *mem, uint32_t bits) {
+  uint32_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if ((ret & bits) == 0U) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, ret & ~bits, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Increment (32-bit)
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_inc32 (uint32_t *mem) {
+  return __atomic_fetch_add(mem, 1U, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Increment (16-bit) if Less Than
+/// \param[in]  mem             Memory address
+/// \param[in]  max             Maximum value
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_inc16_lt (uint16_t *mem, uint16_t max) {
+  uint16_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret >= max) {
+      return ret;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, (uint16_t)(ret + 1U), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Increment (16-bit) and clear on Limit
+/// \param[in]  mem             Memory address
+/// \param[in]  max             Maximum value
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_inc16_lim (uint16_t *mem, uint16_t lim) {
+  uint16_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+  uint16_t val;
+
+  do {
+    val = (uint16_t)(ret + 1U);
+    if (val >= lim) {
+      val = 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Decrement (32-bit)
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_dec32 (uint32_t *mem) {
+  return __atomic_fetch_sub(mem, 1U, __ATOMIC_SEQ_CST);
+}
+
+/// Atomic Access Operation: Decrement (32-bit) if Not Zero
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint32_t atomic_dec32_nz (uint32_t *mem) {
+  uint32_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret == 0U) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, ret - 1U, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Decrement (16-bit) if Not Zero
+/// \param[in]  mem             Memory address
+/// \return                     Previous value
+__STATIC_INLINE uint16_t atomic_dec16_nz (uint16_t *mem) {
+  uint16_t ret = __atomic_load_n(mem, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret == 0U) {
+      return 0U;
+    }
+  } while (!__atomic_compare_exchange_n(mem, &ret, (uint16_t)(ret - 1U), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Compare and Swap (32-bit)
+/// \param[in]  mem             Memory address
+/// \param[in]  old             Expected value
+/// \param[in]  val             New value
+/// \return                     Previous value (new value written when equal to expected value)
+__STATIC_INLINE uint32_t atomic_cas32 (uint32_t *mem, uint32_t old, uint32_t val) {
+  (void)__atomic_compare_exchange_n(mem, &old, val, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+  return old;
+}
+
+/// Atomic Access Operation: Link Get
+/// \param[in]  root            Root address
+/// \return                     Link
+__STATIC_INLINE void *atomic_link_get (void **root) {
+  void *ret = __atomic_load_n(root, __ATOMIC_SEQ_CST);
+
+  do {
+    if (ret == NULL) {
+      return NULL;
+    }
+  } while (!__atomic_compare_exchange_n(root, &ret, *((void **)ret), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+
+  return ret;
+}
+
+/// Atomic Access Operation: Link Put
+/// \param[in]  root            Root address
+/// \param[in]  lnk             Link
+__STATIC_INLINE void atomic_link_put (void **root, void *link) {
+  void *val = __atomic_load_n(root, __ATOMIC_SEQ_CST);
+
+  do {
+    *((void **)link) = val;
+  } while (!__atomic_compare_exchange_n(root, &val, link, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST));
+}
+
+#endif  // (EXCLUSIVE_ACCESS == 1)
+
+
+#endif  // RTX_CORE_POSIX_H_
@@ -221,6 +221,7 @@ static osEventFlagsId_t svcRtxEventFlagsNew (const osEventFlagsAttr_t *attr) {
     ef->flags       = flags;
     ef->name        = name;
     ef->thread_list = NULL;
+    ef->wait_index  = NULL;
     ef->event_flags = 0U;
 
     // Register post ISR processing function
@@ -406,6 +407,9 @@ static osStatus_t svcRtxEventFlagsDelete (osEventFlagsId_t ef_id) {
     osRtxThreadDispatch(NULL);
   }
 
+  // Free wait list index
+  osRtxThreadListFree(osRtxObject(ef));
+
   // Mark object as invalid
   ef->id = osRtxIdInvalid;
 
@@ -27,6 +27,143 @@
 #include "cmsis_compiler.h"
 #include "rtx_evr.h"                    // RTX Event Recorder definitions
 
+#if (defined(OS_EVR_TRACE) && (OS_EVR_TRACE != 0))
+
+#include "rtx_core_c.h"                 // Cortex core definitions
+#include "os_tick.h"                    // CMSIS OS Tick API
+
+#if ((OS_EVR_TRACE_SIZE < 64) || ((OS_EVR_TRACE_SIZE & (OS_EVR_TRACE_SIZE - 1)) != 0))
+#error "Invalid Binary Trace size (OS_EVR_TRACE_SIZE)!"
+#endif
+
+#ifndef EventID
+#define EventLevelError                 0x00000U
+#define EventLevelAPI                   0x10000U
+#define EventLevelOp                    0x20000U
+#define EventLevelDetail                0x30000U
+#define EventID(level, comp_no, msg_no) ((level & 0x30000U) | ((comp_no) << 8) | (msg_no))
+#endif
+
+#define TRACE_SYNC_PERIOD               64U             // Records between Sync records
+#define TRACE_SYNC_GAP                  0x00200000U     // Timestamp gap forcing a Sync record
+
+/// Binary Trace Records
+static osRtxTraceRecord_t os_trace_record[OS_EVR_TRACE_SIZE] \
+__attribute__((section(".bss.os.evr.trace")));
+
+/// Binary Trace Buffer
+osRtxTrace_t osRtxTrace \
+__attribute__((section(".data.os.evr.trace"))) = {
+  osRtxTraceMagic, OS_EVR_TRACE_SIZE, OS_EVR_TRACE_LEVEL, 0U, 0U, 0U, 0U, &os_trace_record[0]
+};
+
+/// Get Trace timestamp (Kernel System Timer count).
+static uint32_t TraceTimestamp (void) {
+  uint32_t tick;
+  uint32_t count;
+
+  // Kernel System Timer is not running before the Kernel is started
+  if ((osRtxInfo.kernel.state == osRtxKernelInactive) ||
+      (osRtxInfo.kernel.state == osRtxKernelReady)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  tick  = (uint32_t)osRtxInfo.kernel.tick;
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  return (count + (tick * OS_Tick_GetInterval()));
+}
+
+/// Claim Trace records and take their timestamp.
+/// \param[out] timestamp       timestamp of the records.
+/// \param[out] sync            1 when a Sync record is claimed first, 0 otherwise.
+/// \return index of the first record.
+static uint32_t TraceClaim (uint32_t *timestamp, uint32_t *sync) {
+  uint32_t primask = __get_PRIMASK();
+  uint32_t index;
+  uint32_t time;
+  uint32_t n;
+
+  // Timestamp is taken with the records claimed, so that timestamps increase
+  // with the record index also when an interrupt records in between
+  __disable_irq();
+
+  index = osRtxTrace.index;
+  time  = TraceTimestamp();
+
+  // Sync record holds the full timestamp for the decoder
+  if (((index & (TRACE_SYNC_PERIOD - 1U)) == 0U) ||
+      ((time - osRtxTrace.timestamp) >= TRACE_SYNC_GAP)) {
+    n = 1U;
+  } else {
+    n = 0U;
+  }
+  osRtxTrace.index     = index + n + 1U;
+  osRtxTrace.timestamp = time;
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  *timestamp = time;
+  *sync      = n;
+  return index;
+}
+
+/// Record an event in the Binary Trace buffer.
+/// \param[in]  id              event ID (component number <9:6>, message number <5:0>).
+/// \param[in]  val             first event argument.
+static void TraceRecord (uint32_t id, uint32_t val) {
+  osRtxTraceRecord_t *record;
+  uint32_t            timestamp;
+  uint32_t            index;
+  uint32_t            sync;
+
+  index = TraceClaim(&timestamp, &sync);
+
+  if (sync != 0U) {
+    record       = &osRtxTrace.record[index & (OS_EVR_TRACE_SIZE - 1U)];
+    record->info = (timestamp << 10) | osRtxTraceIdSync;
+    record->val  = timestamp;
+    index++;
+  }
+
+  record       = &osRtxTrace.record[index & (OS_EVR_TRACE_SIZE - 1U)];
+  record->info = (timestamp << 10) | id;
+  record->val  = val;
+}
+
+/// Record an Event Recorder event in the Binary Trace buffer (filtered by level).
+/// \param[in]  id              Event Recorder event ID.
+/// \param[in]  val             first event argument.
+/// \return 1 when recorded, 0 when filtered.
+__STATIC_INLINE uint32_t EvrTraceRecord (uint32_t id, uint32_t val) {
+  if (((OS_EVR_TRACE_LEVEL >> ((id >> 16) & 3U)) & 1U) == 0U) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+  TraceRecord((((id >> 2) & 0x3C0U) | (id & 0x3FU)), val);
+  return 1U;
+}
+
+// Event Recorder functions record in the Binary Trace buffer
+#undef  EventRecord2
+#undef  EventRecord4
+#undef  EventRecordData
+#define EventRecord2(id, val1, val2)             ((void)(val2), EvrTraceRecord((id), (uint32_t)(val1)))
+#define EventRecord4(id, val1, val2, val3, val4) ((void)(val2), (void)(val3), (void)(val4), EvrTraceRecord((id), (uint32_t)(val1)))
+#define EventRecordData(id, data, len)           ((void)(data), EvrTraceRecord((id), (uint32_t)(len)))
+
+#ifndef RTE_Compiler_EventRecorder
+#define RTE_Compiler_EventRecorder
+#endif
+
+#endif  // (OS_EVR_TRACE != 0)
+
 #ifdef  RTE_Compiler_EventRecorder
 
 //lint -e923 -e9074 -e9078 -emacro((835,845),EventID) [MISRA Note 13]
@@ -379,6 +516,10 @@ __WEAK void EvrRtxKernelStart (void) {
 
 #if (!defined(EVR_RTX_DISABLE) && (OS_EVR_KERNEL != 0) && !defined(EVR_RTX_KERNEL_STARTED_DISABLE))
 __WEAK void EvrRtxKernelStarted (void) {
+#if (defined(OS_EVR_TRACE) && (OS_EVR_TRACE != 0))
+  osRtxTrace.freq = OS_Tick_GetClock();
+  osRtxTrace.idle = (uint32_t)osRtxInfo.thread.idle;
+#endif
 #if defined(RTE_Compiler_EventRecorder)
   (void)EventRecord2(EvtRtxKernelStarted, 0U, 0U);
 #else
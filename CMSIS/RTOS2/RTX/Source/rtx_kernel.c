@@ -48,6 +48,26 @@ static void KernelBlock (void) {
   }
 }
 
+/// Get number of Ticks until the next timeout.
+/// \return number of ticks or osWaitForever when nothing is pending.
+static uint32_t KernelNextTimeout (void) {
+  uint32_t delay;
+  uint32_t ticks;
+
+  // Check Thread Delay Timing Wheel
+  delay = osRtxWheelNext(&osRtxInfo.delay_wheel);
+
+  // Check Active Timer Timing Wheel
+  if (osRtxInfo.timer.tick != NULL) {
+    ticks = osRtxWheelNext(&osRtxInfo.timer_wheel);
+    if (ticks < delay) {
+      delay = ticks;
+    }
+  }
+
+  return delay;
+}
+
 /// Unblock Kernel
 static void KernelUnblock (void) {
 
@@ -372,9 +392,7 @@ static int32_t svcRtxKernelRestoreLock (int32_t lock) {
 /// Suspend the RTOS Kernel scheduler.
 /// \note API identical to osKernelSuspend
 static uint32_t svcRtxKernelSuspend (void) {
-  const os_thread_t *thread;
-  const os_timer_t  *timer;
-  uint32_t           delay;
+  uint32_t delay;
 
   if (osRtxInfo.kernel.state != osRtxKernelRunning) {
     EvrRtxKernelError(osRtxErrorKernelNotRunning);
@@ -384,21 +402,7 @@ static uint32_t svcRtxKernelSuspend (void) {
 
   KernelBlock();
 
-  delay = osWaitForever;
-
-  // Check Thread Delay list
-  thread = osRtxInfo.thread.delay_list;
-  if (thread != NULL) {
-    delay = thread->delay;
-  }
-
-  // Check Active Timer list
-  timer = osRtxInfo.timer.list;
-  if (timer != NULL) {
-    if (timer->tick < delay) {
-      delay = timer->tick;
-    }
-  }
+  delay = KernelNextTimeout();
 
   osRtxInfo.kernel.state = osRtxKernelSuspended;
 
@@ -410,9 +414,6 @@ static uint32_t svcRtxKernelSuspend (void) {
 /// Resume the RTOS Kernel scheduler.
 /// \note API identical to osKernelResume
 static void svcRtxKernelResume (uint32_t sleep_ticks) {
-  os_thread_t *thread;
-  os_timer_t  *timer;
-  uint32_t     delay;
 
   if (osRtxInfo.kernel.state != osRtxKernelSuspended) {
     EvrRtxKernelResumed();
@@ -420,46 +421,14 @@ static void svcRtxKernelResume (uint32_t sleep_ticks) {
     return;
   }
 
-  // Process Thread Delay list
-  thread = osRtxInfo.thread.delay_list;
-  if (thread != NULL) {
-    delay = sleep_ticks;
-    if (delay >= thread->delay) {
-        delay -= thread->delay;
-      osRtxInfo.kernel.tick += thread->delay;
-      thread->delay = 1U;
-      do {
-        osRtxThreadDelayTick();
-        if (delay == 0U) { 
-          break;
-        }
-        delay--;
-        osRtxInfo.kernel.tick++;
-      } while (osRtxInfo.thread.delay_list != NULL);
-    } else {
-      thread->delay -= delay;
-      osRtxInfo.kernel.tick += delay;
-    }
-  } else {
-    osRtxInfo.kernel.tick += sleep_ticks;
-  }
-
-  // Process Active Timer list
-  timer = osRtxInfo.timer.list;
-  if (timer != NULL) {
-    if (sleep_ticks >= timer->tick) {
-        sleep_ticks -= timer->tick;
-      timer->tick = 1U;
-      do {
-        osRtxInfo.timer.tick();
-        if (sleep_ticks == 0U) {
-          break;
-        }
-        sleep_ticks--;
-      } while (osRtxInfo.timer.list != NULL);
-    } else {
-      timer->tick -= sleep_ticks;
-    }
+  osRtxInfo.kernel.tick += sleep_ticks;
+
+  // Process Thread Delay Timing Wheel
+  osRtxWheelAdvance(&osRtxInfo.delay_wheel, sleep_ticks, osRtxThreadDelayTick);
+
+  // Process Active Timer Timing Wheel
+  if (osRtxInfo.timer.tick != NULL) {
+    osRtxWheelAdvance(&osRtxInfo.timer_wheel, sleep_ticks, osRtxInfo.timer.tick);
   }
 
   osRtxInfo.kernel.state = osRtxKernelRunning;
@@ -488,16 +457,7 @@ static uint32_t svcRtxKernelGetTickFreq (void) {
 /// Get the RTOS kernel system timer count.
 /// \note API identical to osKernelGetSysTimerCount
 static uint32_t svcRtxKernelGetSysTimerCount (void) {
-  uint32_t tick;
-  uint32_t count;
-
-  tick  = (uint32_t)osRtxInfo.kernel.tick;
-  count = OS_Tick_GetCount();
-  if (OS_Tick_GetOverflow() != 0U) {
-    count = OS_Tick_GetCount();
-    tick++;
-  }
-  count += tick * OS_Tick_GetInterval();
+  uint32_t count = osRtxKernelGetSysTimerCount();
   EvrRtxKernelGetSysTimerCount(count);
   return count;
 }
@@ -537,6 +497,22 @@ SVC0_0 (KernelGetSysTimerFreq,  uint32_t)
 __WEAK void osRtxKernelPreInit (void) {
 }
 
+/// Get the RTOS kernel system timer count.
+/// \return RTOS kernel current system timer count as 32-bit value.
+uint32_t osRtxKernelGetSysTimerCount (void) {
+  uint32_t tick;
+  uint32_t count;
+
+  tick  = (uint32_t)osRtxInfo.kernel.tick;
+  count = OS_Tick_GetCount();
+  if (OS_Tick_GetOverflow() != 0U) {
+    count = OS_Tick_GetCount();
+    tick++;
+  }
+  count += tick * OS_Tick_GetInterval();
+  return count;
+}
+
 
 //  ==== Public API ====
 
@@ -708,3 +684,51 @@ uint32_t osKernelGetSysTimerFreq (void) {
   }
   return freq;
 }
+
+
+//  ==== Tick-less Idle ====
+
+/// Tick-less Idle sleep hook.
+__WEAK void osRtxIdleSleep (uint32_t ticks) {
+  (void)ticks;
+  __WFI();
+}
+
+/// Tick-less Idle: sleep with the Kernel Tick suspended until the next timeout.
+void osRtxKernelIdle (uint32_t min_ticks) {
+  uint32_t ticks;
+  uint32_t sleep_ticks = 0U;
+
+  // Quick check without suspending the Kernel (the Timing Wheels may change
+  // meanwhile, osKernelSuspend checks the next timeout again)
+  ticks = KernelNextTimeout();
+  if (ticks >= min_ticks) {
+    ticks = osKernelSuspend();
+    if (ticks >= min_ticks) {
+      __disable_irq();
+      // Program the tick interrupt for the next timeout and sleep
+      // unless an ISR has already requested a thread switch
+      //lint -e{9079} -e{9087} "volatile read of flag written by ISRs"
+      if (*((volatile uint8_t *)&osRtxInfo.kernel.pendSV) == 0U) {
+        ticks = OS_Tick_Suspend(ticks);
+      } else {
+        ticks = 0U;
+      }
+      if (ticks != 0U) {
+        osRtxIdleSleep(ticks);
+        sleep_ticks = OS_Tick_Resume();
+      }
+      __enable_irq();
+    } else {
+      ticks = 0U;
+    }
+    osKernelResume(sleep_ticks);
+  } else {
+    ticks = 0U;
+  }
+
+  if (ticks == 0U) {
+    // Next timeout is too close: sleep until the next Kernel Tick
+    osRtxIdleSleep(0U);
+  }
+}
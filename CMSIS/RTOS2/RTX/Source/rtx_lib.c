@@ -42,6 +42,8 @@
 #if ((OS_DYNAMIC_MEM_SIZE % 8) != 0)
 #error "Invalid Dynamic Memory size!"
 #endif
+// Dynamic Memory holds at least the Memory Heap overhead
+typedef uint8_t os_mem_size_check_t[(OS_DYNAMIC_MEM_SIZE >= osRtxMemoryHeapMin) ? 1 : -1];
 static uint64_t os_mem[OS_DYNAMIC_MEM_SIZE/8] \
 __attribute__((section(".bss.os")));
 #endif
@@ -51,6 +53,11 @@ __attribute__((section(".bss.os")));
 #error "Invalid Kernel Tick Frequency!"
 #endif
 
+// Tick-less Idle
+#if ((OS_TICKLESS_IDLE != 0) && (OS_PRIVILEGE_MODE == 0))
+#error "Tick-less Idle requires privileged Thread mode!"
+#endif
+
 // ISR FIFO Queue
 static void *os_isr_queue[OS_ISR_FIFO_QUEUE] \
 __attribute__((section(".bss.os")));
@@ -102,7 +109,7 @@ __attribute__((section(".data.os.thread.mpi"))) =
 
 // Memory Pool for Thread Stack
 #if (OS_THREAD_USER_STACK_SIZE != 0)
-static uint64_t os_thread_stack[2 + OS_THREAD_NUM + (OS_THREAD_USER_STACK_SIZE/8)] \
+static uint64_t os_thread_stack[osRtxMemoryHeapSize(OS_THREAD_NUM, OS_THREAD_USER_STACK_SIZE)/8U] \
 __attribute__((section(".bss.os.thread.stack")));
 #endif
 
@@ -209,7 +216,7 @@ static osRtxMessageQueue_t os_timer_mq_cb \
 __attribute__((section(".bss.os.msgqueue.cb")));
 
 // Timer Message Queue Data
-static uint32_t os_timer_mq_data[osRtxMessageQueueMemSize(OS_TIMER_CB_QUEUE,8)/4] \
+static uint32_t os_timer_mq_data[osRtxMessageQueueMemSize(OS_TIMER_CB_QUEUE,sizeof(osRtxTimerFinfo_t))/4] \
 __attribute__((section(".bss.os.msgqueue.mem")));
 
 // Timer Message Queue Attributes
@@ -316,7 +323,7 @@ __attribute__((section(".data.os.mempool.mpi"))) =
 #if ((OS_MEMPOOL_DATA_SIZE % 8) != 0)
 #error "Invalid Data Memory size for Memory Pools!"
 #endif
-static uint64_t os_mp_data[2 + OS_MEMPOOL_NUM + (OS_MEMPOOL_DATA_SIZE/8)] \
+static uint64_t os_mp_data[osRtxMemoryHeapSize(OS_MEMPOOL_NUM, OS_MEMPOOL_DATA_SIZE)/8U] \
 __attribute__((section(".bss.os.mempool.mem")));
 #endif
 
@@ -346,7 +353,7 @@ __attribute__((section(".data.os.msgqueue.mpi"))) =
 #if ((OS_MSGQUEUE_DATA_SIZE % 8) != 0)
 #error "Invalid Data Memory size for Message Queues!"
 #endif
-static uint64_t os_mq_data[2 + OS_MSGQUEUE_NUM + (OS_MSGQUEUE_DATA_SIZE/8)] \
+static uint64_t os_mq_data[osRtxMemoryHeapSize(OS_MSGQUEUE_NUM, OS_MSGQUEUE_DATA_SIZE)/8U] \
 __attribute__((section(".bss.os.msgqueue.mem")));
 #endif
 
@@ -405,10 +412,17 @@ __STATIC_INLINE void evr_initialize (void) {
 // OS Configuration
 // ================
 
+// Host objects are position independent by default, so their constant data holding
+// addresses is placed in the relocated read-only section instead of .rodata
+#if defined(RTX_POSIX)
+#define OS_CONFIG_SECTION       ".data.rel.ro"
+#else
+#define OS_CONFIG_SECTION       ".rodata"
+#endif
 
 const osRtxConfig_t osRtxConfig \
 __USED \
-__attribute__((section(".rodata"))) =
+__attribute__((section(OS_CONFIG_SECTION))) =
 {
   //lint -e{835} "Zero argument to operator"
   0U   // Flags
@@ -589,7 +603,7 @@ __asm (
 #endif
 
 #if (defined(__ARMCC_VERSION) && (__ARMCC_VERSION >= 6010050)) || \
-    (defined(__GNUC__) && !defined(__CC_ARM))
+    (defined(__GNUC__) && !defined(__CC_ARM) && !defined(RTX_POSIX))
 
 extern __attribute__((weak)) uint32_t __os_thread_cb_start__;    //lint -esym(526,__os_thread_cb_start__)
 extern __attribute__((weak)) uint32_t __os_thread_cb_end__;      //lint -esym(526,__os_thread_cb_end__)
@@ -52,6 +52,9 @@
 #define os_message_t        osRtxMessage_t
 #define os_message_queue_t  osRtxMessageQueue_t
 #define os_object_t         osRtxObject_t
+#define os_wait_object_t    osRtxWaitObject_t
+#define os_wait_index_t     osRtxWaitIndex_t
+#define os_wheel_t          osRtxWheel_t
 
 //  ==== Inline functions ====
 
@@ -137,6 +140,11 @@ __STATIC_INLINE os_message_t *osRtxMessageObject (os_object_t *object) {
   //lint -e{740} -e{826} -e{9087} "cast from pointer to generic object to specific object" [MISRA Note 4]
   return ((os_message_t *)object);
 }
+// Waitable Object
+__STATIC_INLINE os_wait_object_t *osRtxWaitObject (os_object_t *object) {
+  //lint -e{740} -e{826} -e{9087} "cast from pointer to generic object to specific object" [MISRA Note 4]
+  return ((os_wait_object_t *)object);
+}
 
 // Kernel State
 __STATIC_INLINE osKernelState_t osRtxKernelState (void) {
@@ -175,12 +183,14 @@ __STATIC_INLINE void osRtxThreadSetRunning (os_thread_t *thread) {
 
 // Kernel Library functions
 extern void         osRtxKernelPreInit (void);
+extern uint32_t     osRtxKernelGetSysTimerCount (void);
 
 // Thread Library functions
 extern void         osRtxThreadListPut    (os_object_t *object, os_thread_t *thread);
 extern os_thread_t *osRtxThreadListGet    (os_object_t *object);
-extern void         osRtxThreadListSort   (os_thread_t *thread);
+extern void         osRtxThreadListSort   (os_thread_t *thread, int8_t priority);
 extern void         osRtxThreadListRemove (os_thread_t *thread);
+extern void         osRtxThreadListFree   (os_object_t *object);
 extern void         osRtxThreadReadyPut   (os_thread_t *thread);
 extern void         osRtxThreadDelayTick  (void);
 extern uint32_t    *osRtxThreadRegPtr     (const os_thread_t *thread);
@@ -212,5 +222,13 @@ extern void osRtxTick_Handler   (void);
 extern void osRtxPendSV_Handler (void);
 extern void osRtxPostProcess    (os_object_t *object);
 
+// Timing Wheel Library functions
+extern uint32_t osRtxWheelSlot    (const os_wheel_t *wheel, uint32_t time);
+extern void     osRtxWheelMark    (os_wheel_t *wheel, uint32_t slot);
+extern void    *osRtxWheelTake    (os_wheel_t *wheel, uint32_t slot);
+extern uint32_t osRtxWheelCascade (const os_wheel_t *wheel);
+extern uint32_t osRtxWheelNext    (const os_wheel_t *wheel);
+extern void     osRtxWheelAdvance (os_wheel_t *wheel, uint32_t ticks, void (*tick)(void));
+
 
 #endif  // RTX_LIB_H_
@@ -26,22 +26,63 @@
 #include "rtx_lib.h"
 
 
+//  The memory is managed with a Two-Level Segregated Fit (TLSF) allocator.
+//  Free blocks are kept in segregated Free Lists: the first level splits the
+//  block sizes by power of two and the second level divides each power of two
+//  into MEM_SL_CNT equal ranges. Blocks below 2^MEM_FL_SHIFT bytes are kept in
+//  the first level 0 with a granularity of 8 bytes. Two bitmaps indicate which
+//  Free Lists are not empty, so that a suitable free block is found in
+//  constant time. Freed blocks are immediately merged with adjacent free blocks.
+//
+//  Memory layout: Memory Pool Header, Free List heads, Memory Blocks and the
+//  last Memory Block Header. Memory Blocks are linked in address order; a free
+//  block stores the Free List links after its header and a pointer to itself
+//  in its last word (used to find the previous block when merging).
+
+//  Second level and first level shift
+#define MEM_SL_LOG2             3U
+#define MEM_SL_CNT              (1U << MEM_SL_LOG2)
+#define MEM_FL_SHIFT            (MEM_SL_LOG2 + 3U)
+
 //  Memory Pool Header structure
 typedef struct {
   uint32_t size;                // Memory Pool size
   uint32_t used;                // Used Memory
+  uint32_t max_used;            // Maximum used Memory
+  uint32_t first;               // Offset of the first Memory Block
+  uint32_t free_cnt;            // Number of free Memory Blocks
+  uint32_t fl_map;              // First level Free List bitmap
+  uint8_t  sl_map[32];          // Second level Free List bitmaps
 } mem_head_t;
 
 //  Memory Block Header structure
 typedef struct mem_block_s {
-  struct mem_block_s *next;     // Next Memory Block in list
-  uint32_t            info;     // Block Info or max used Memory (in last block)
+  struct mem_block_s *next;     // Next Memory Block in memory
+  uint32_t            info;     // Block Info
 } mem_block_t;
 
-//  Memory Block Info: Length = <31:2>:'00', Type = <1:0>
-#define MB_INFO_LEN_MASK        0xFFFFFFFCU     // Length mask
+//  Free Memory Block structure
+typedef struct mem_free_s {
+  mem_block_t         block;    // Memory Block Header
+  struct mem_free_s  *next;     // Next free Memory Block in Free List
+  struct mem_free_s  *prev;     // Previous free Memory Block in Free List
+} mem_free_t;
+
+//  Memory Block Info: Length = <31:3>:'000', Previous free = <2>, Type = <1:0>
+//  Length is 0 for a free block (size is given by the next Memory Block)
+#define MB_INFO_LEN_MASK        0xFFFFFFF8U     // Length mask
+#define MB_INFO_PREV_FREE       0x00000004U     // Previous block is free
 #define MB_INFO_TYPE_MASK       0x00000003U     // Type mask
 
+//  Minimum Memory Block size (free block with links and back pointer)
+#define MEM_BLOCK_MIN           ((sizeof(mem_free_t) + sizeof(mem_free_t *) + 7U) & ~7U)
+
+//  Memory Heap overhead used by osRtxMemoryHeapSize (rtx_os.h)
+typedef uint8_t mem_heap_size_check_t[((sizeof(mem_head_t)  == osRtxMemoryHeadSize)      &&
+                                       (sizeof(mem_block_t) == osRtxMemoryBlockHeadSize) &&
+                                       (MEM_BLOCK_MIN       == osRtxMemoryBlockMin)      &&
+                                       ((MEM_SL_CNT * sizeof(mem_free_t *)) == osRtxMemoryFreeListSize)) ? 1 : -1];
+
 //  Memory Head Pointer
 __STATIC_INLINE mem_head_t *MemHeadPtr (void *mem) {
   //lint -e{9079} -e{9087} "conversion from pointer to void to pointer to other type" [MISRA Note 6]
@@ -60,6 +101,138 @@ __STATIC_INLINE mem_block_t *MemBlockPtr (void *mem, uint32_t offset) {
   return ptr;
 }
 
+//  Memory Block Size
+__STATIC_INLINE uint32_t MemBlockSize (const mem_block_t *block) {
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+  return ((uint32_t)block->next - (uint32_t)block);
+}
+
+//  Free Memory Block Pointer
+__STATIC_INLINE mem_free_t *MemFreePtr (mem_block_t *block) {
+  //lint -e{740} -e{826} -e{9087} "cast from pointer to pointer to other type" [MISRA Note 5]
+  return ((mem_free_t *)block);
+}
+
+//  Free List heads (located after the Memory Pool Header)
+__STATIC_INLINE mem_free_t **MemFreeList (void *mem) {
+  //lint -e{740} -e{826} -e{9087} "cast from pointer to pointer to other type" [MISRA Note 5]
+  return ((mem_free_t **)MemBlockPtr(mem, sizeof(mem_head_t)));
+}
+
+//  Back pointer of the free Memory Block preceding a Memory Block
+__STATIC_INLINE mem_free_t **MemFreeBack (mem_block_t *block) {
+  //lint -e{740} -e{826} -e{9087} "cast from pointer to pointer to other type" [MISRA Note 5]
+  return ((mem_free_t **)block - 1);
+}
+
+//  Index of the lowest bit set
+__STATIC_INLINE uint32_t MemBitFirst (uint32_t map) {
+  return (31U - (uint32_t)__CLZ(map & (0U - map)));
+}
+
+//  Free List for a block size.
+static void MemMapping (uint32_t size, uint32_t *fl, uint32_t *sl) {
+  uint32_t n;
+
+  if (size < (1U << MEM_FL_SHIFT)) {
+    *fl = 0U;
+    *sl = size >> 3;
+  } else {
+    n   = 31U - (uint32_t)__CLZ(size);
+    *fl = n - (MEM_FL_SHIFT - 1U);
+    *sl = (size >> (n - MEM_SL_LOG2)) & (MEM_SL_CNT - 1U);
+  }
+}
+
+//  Insert a free Memory Block into its Free List.
+static void MemFreeInsert (void *mem, mem_free_t *block) {
+  mem_head_t  *head = MemHeadPtr(mem);
+  mem_free_t **list;
+  uint32_t     fl, sl;
+
+  MemMapping(MemBlockSize(&block->block), &fl, &sl);
+  list = &MemFreeList(mem)[(fl * MEM_SL_CNT) + sl];
+
+  block->block.info = 0U;
+  block->prev = NULL;
+  block->next = *list;
+  if (*list != NULL) {
+    (*list)->prev = block;
+  }
+  *list = block;
+
+  head->fl_map     |= 1U << fl;
+  head->sl_map[fl] |= (uint8_t)(1U << sl);
+  head->free_cnt++;
+
+  // Back pointer and previous free flag of the next block
+  *MemFreeBack(block->block.next) = block;
+  block->block.next->info |= MB_INFO_PREV_FREE;
+}
+
+//  Remove a free Memory Block from its Free List.
+static void MemFreeRemove (void *mem, mem_free_t *block) {
+  mem_head_t  *head = MemHeadPtr(mem);
+  uint32_t     fl, sl;
+
+  if (block->prev != NULL) {
+    block->prev->next = block->next;
+  } else {
+    MemMapping(MemBlockSize(&block->block), &fl, &sl);
+    MemFreeList(mem)[(fl * MEM_SL_CNT) + sl] = block->next;
+    if (block->next == NULL) {
+      head->sl_map[fl] &= (uint8_t)~(1U << sl);
+      if (head->sl_map[fl] == 0U) {
+        head->fl_map &= ~(1U << fl);
+      }
+    }
+  }
+  if (block->next != NULL) {
+    block->next->prev = block->prev;
+  }
+
+  head->free_cnt--;
+
+  block->block.next->info &= ~MB_INFO_PREV_FREE;
+}
+
+//  Find a free Memory Block of at least the specified size.
+static mem_free_t *MemFreeFind (void *mem, uint32_t size) {
+  const mem_head_t *head = MemHeadPtr(mem);
+        mem_free_t *p;
+  uint32_t          fl, sl, n;
+  uint32_t          map;
+
+  // Round up to the next Free List, so that any block in the list fits
+  n = size;
+  if (size >= (1U << MEM_FL_SHIFT)) {
+    n += (1U << ((31U - (uint32_t)__CLZ(size)) - MEM_SL_LOG2)) - 1U;
+  }
+  MemMapping(n, &fl, &sl);
+
+  map = (uint32_t)head->sl_map[fl] & (0xFFFFFFFFU << sl);
+  if (map == 0U) {
+    map = head->fl_map & (0xFFFFFFFFU << (fl + 1U));
+    if (map != 0U) {
+      fl  = MemBitFirst(map);
+      map = head->sl_map[fl];
+    }
+  }
+
+  if (map != 0U) {
+    p = MemFreeList(mem)[(fl * MEM_SL_CNT) + MemBitFirst(map)];
+  } else {
+    // Last resort: search the Free List of the size for a block that fits
+    MemMapping(size, &fl, &sl);
+    p = MemFreeList(mem)[(fl * MEM_SL_CNT) + sl];
+    while ((p != NULL) && (MemBlockSize(&p->block) < size)) {
+      p = p->next;
+    }
+  }
+
+  return p;
+}
+
 
 //  ==== Library functions ====
 
@@ -70,27 +243,51 @@ __STATIC_INLINE mem_block_t *MemBlockPtr (void *mem, uint32_t offset) {
 __WEAK uint32_t osRtxMemoryInit (void *mem, uint32_t size) {
   mem_head_t  *head;
   mem_block_t *ptr;
+  mem_free_t **list;
+  uint32_t     first;
+  uint32_t     fl, sl, n;
 
   // Check parameters
   //lint -e{923} "cast from pointer to unsigned int" [MISRA Note 7]
   if ((mem == NULL) || (((uint32_t)mem & 7U) != 0U) || ((size & 7U) != 0U) ||
-      (size < (sizeof(mem_head_t) + (2U*sizeof(mem_block_t))))) {
+      (size < (sizeof(mem_head_t) + MEM_BLOCK_MIN + sizeof(mem_block_t)))) {
     EvrRtxMemoryInit(mem, size, 0U);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return 0U;
   }
 
-  // Initialize memory pool header
+  // Free List heads up to the Memory Pool size
+  MemMapping(size, &fl, &sl);
+  first = sizeof(mem_head_t) + ((fl + 1U) * MEM_SL_CNT * sizeof(mem_free_t *));
+  first = (first + 7U) & ~((uint32_t)7U);
+  if (size < (first + MEM_BLOCK_MIN + sizeof(mem_block_t))) {
+    EvrRtxMemoryInit(mem, size, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Initialize memory pool header and Free Lists
   head = MemHeadPtr(mem);
-  head->size = size;
-  head->used = sizeof(mem_head_t) + sizeof(mem_block_t);
+  head->size     = size;
+  head->used     = first + sizeof(mem_block_t);
+  head->max_used = head->used;
+  head->first    = first;
+  head->free_cnt = 0U;
+  head->fl_map   = 0U;
+  for (n = 0U; n < sizeof(head->sl_map); n++) {
+    head->sl_map[n] = 0U;
+  }
+  list = MemFreeList(mem);
+  for (n = 0U; n < ((fl + 1U) * MEM_SL_CNT); n++) {
+    list[n] = NULL;
+  }
 
-  // Initialize first and last block header
-  ptr = MemBlockPtr(mem, sizeof(mem_head_t));
+  // Initialize first (free) and last block header
+  ptr = MemBlockPtr(mem, first);
   ptr->next = MemBlockPtr(mem, size - sizeof(mem_block_t));
   ptr->next->next = NULL;
-  ptr->next->info = sizeof(mem_head_t) + sizeof(mem_block_t);
-  ptr->info = 0U;
+  ptr->next->info = sizeof(mem_block_t);
+  MemFreeInsert(mem, MemFreePtr(ptr));
 
   EvrRtxMemoryInit(mem, size, 1U);
 
@@ -103,63 +300,58 @@ __WEAK uint32_t osRtxMemoryInit (void *mem, uint32_t size) {
 /// \param[in]  type            memory block type: 0 - generic, 1 - control block
 /// \return allocated memory block or NULL in case of no memory is available.
 __WEAK void *osRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type) {
+  mem_head_t  *head;
   mem_block_t *ptr;
-  mem_block_t *p, *p_new;
+  mem_block_t *p_new;
+  mem_free_t  *p;
   uint32_t     block_size;
   uint32_t     hole_size;
 
   // Check parameters
-  if ((mem == NULL) || (size == 0U) || ((type & ~MB_INFO_TYPE_MASK) != 0U)) {
+  if ((mem == NULL) || (size == 0U) || ((type & ~MB_INFO_TYPE_MASK) != 0U) ||
+      (size > (MemHeadPtr(mem))->size)) {
     EvrRtxMemoryAlloc(mem, size, type, NULL);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return NULL;
   }
+  head = MemHeadPtr(mem);
 
   // Add block header to size
   block_size = size + sizeof(mem_block_t);
   // Make sure that block is 8-byte aligned
   block_size = (block_size + 7U) & ~((uint32_t)7U);
-
-  // Search for hole big enough
-  p = MemBlockPtr(mem, sizeof(mem_head_t));
-  for (;;) {
-    //lint -e{923} -e{9078} "cast from pointer to unsigned int"
-    hole_size  = (uint32_t)p->next - (uint32_t)p;
-    hole_size -= p->info & MB_INFO_LEN_MASK;
-    if (hole_size >= block_size) {
-      // Hole found
-      break;
-    }
-    p = p->next;
-    if (p->next == NULL) {
-      // Failed (end of list)
-      EvrRtxMemoryAlloc(mem, size, type, NULL);
-      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-      return NULL;
-    }
+  if (block_size < MEM_BLOCK_MIN) {
+    block_size = MEM_BLOCK_MIN;
   }
 
-  // Update used memory
-  (MemHeadPtr(mem))->used += block_size;
-
-  // Update max used memory
-  p_new = MemBlockPtr(mem, (MemHeadPtr(mem))->size - sizeof(mem_block_t));
-  if (p_new->info < (MemHeadPtr(mem))->used) {
-    p_new->info = (MemHeadPtr(mem))->used;
+  // Search for free block big enough
+  p = MemFreeFind(mem, block_size);
+  if (p == NULL) {
+    EvrRtxMemoryAlloc(mem, size, type, NULL);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+  MemFreeRemove(mem, p);
+
+  // Split block and return the remainder to a Free List
+  hole_size = MemBlockSize(&p->block);
+  if ((hole_size - block_size) >= MEM_BLOCK_MIN) {
+    p_new = MemBlockPtr(p, block_size);
+    p_new->next = p->block.next;
+    p->block.next = p_new;
+    MemFreeInsert(mem, MemFreePtr(p_new));
+  } else {
+    block_size = hole_size;
   }
 
   // Allocate block
-  if (p->info == 0U) {
-    // No block allocated, set info of first element
-    p->info = block_size | type;
-    ptr = MemBlockPtr(p, sizeof(mem_block_t));
-  } else {
-    // Insert new element into the list
-    p_new = MemBlockPtr(p, p->info & MB_INFO_LEN_MASK);
-    p_new->next = p->next;
-    p_new->info = block_size | type;
-    p->next = p_new;
-    ptr = MemBlockPtr(p_new, sizeof(mem_block_t));
+  p->block.info = block_size | type;
+  ptr = MemBlockPtr(p, sizeof(mem_block_t));
+
+  // Update used and max used memory
+  head->used += block_size;
+  if (head->max_used < head->used) {
+    head->max_used = head->used;
   }
 
   EvrRtxMemoryAlloc(mem, size, type, ptr);
@@ -172,8 +364,12 @@ __WEAK void *osRtxMemoryAlloc (void *mem, uint32_t size, uint32_t type) {
 /// \param[in]  block           memory block to be returned to the memory pool.
 /// \return 1 - success, 0 - failure.
 __WEAK uint32_t osRtxMemoryFree (void *mem, void *block) {
-  const mem_block_t *ptr;
-        mem_block_t *p, *p_prev;
+  mem_head_t  *head;
+  mem_block_t *ptr;
+  mem_block_t *p_next;
+  mem_free_t  *p;
+  uint32_t     offset;
+  uint32_t     len;
 
   // Check parameters
   if ((mem == NULL) || (block == NULL)) {
@@ -181,38 +377,93 @@ __WEAK uint32_t osRtxMemoryFree (void *mem, void *block) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return 0U;
   }
+  head = MemHeadPtr(mem);
 
   // Memory block header
   ptr = MemBlockPtr(block, 0U);
   ptr--;
 
-  // Search for block header
-  p_prev = NULL;
-  p = MemBlockPtr(mem, sizeof(mem_head_t));
-  while (p != ptr) {
-    p_prev = p;
-    p = p->next;
-    if (p == NULL) {
-      // Not found
-      EvrRtxMemoryFree(mem, block, 0U);
-      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-      return 0U;
-    }
+  // Check that the block is an allocated block of the pool
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+  offset = (uint32_t)ptr - (uint32_t)mem;
+  if ((offset < head->first) || (offset >= (head->size - sizeof(mem_block_t))) || ((offset & 7U) != 0U)) {
+    EvrRtxMemoryFree(mem, block, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+  len = ptr->info & MB_INFO_LEN_MASK;
+  if ((len == 0U) || (len > (head->size - offset)) || (MemBlockSize(ptr) != len)) {
+    EvrRtxMemoryFree(mem, block, 0U);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
   }
 
   // Update used memory
-  (MemHeadPtr(mem))->used -= p->info & MB_INFO_LEN_MASK;
+  head->used -= len;
+
+  // Merge with next block when free
+  p_next = ptr->next;
+  if ((p_next->info & MB_INFO_LEN_MASK) == 0U) {
+    MemFreeRemove(mem, MemFreePtr(p_next));
+    ptr->next = p_next->next;
+    p_next->next = NULL;
+  }
 
-  // Free block
-  if (p_prev == NULL) {
-    // Release first block, only set info to 0
-    p->info = 0U;
+  // Merge with previous block when free
+  if ((ptr->info & MB_INFO_PREV_FREE) != 0U) {
+    p = *MemFreeBack(ptr);
+    MemFreeRemove(mem, p);
+    p->block.next = ptr->next;
+    // Invalidate merged block header
+    ptr->next = NULL;
+    ptr->info = 0U;
   } else {
-    // Discard block from chained list
-    p_prev->next = p->next;
+    p = MemFreePtr(ptr);
   }
 
+  // Free block
+  MemFreeInsert(mem, p);
+
   EvrRtxMemoryFree(mem, block, 1U);
 
   return 1U;
 }
+
+/// Get statistics of a Memory Pool.
+/// \param[in]  mem             pointer to memory pool.
+/// \param[out] stat            pointer to buffer for statistics.
+/// \return 1 - success, 0 - failure.
+__WEAK uint32_t osRtxMemoryGetStat (void *mem, osRtxMemoryStat_t *stat) {
+  const mem_head_t *head;
+  const mem_free_t *p;
+  uint32_t          fl, sl;
+  uint32_t          size;
+
+  // Check parameters
+  if ((mem == NULL) || (stat == NULL)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+  head = MemHeadPtr(mem);
+
+  stat->size        = head->size;
+  stat->used        = head->used;
+  stat->max_used    = head->max_used;
+  stat->free_blocks = head->free_cnt;
+  stat->max_free    = 0U;
+
+  // Largest free block is in the highest non-empty Free List
+  if (head->fl_map != 0U) {
+    fl = 31U - (uint32_t)__CLZ(head->fl_map);
+    sl = 31U - (uint32_t)__CLZ(head->sl_map[fl]);
+    for (p = MemFreeList(mem)[(fl * MEM_SL_CNT) + sl]; p != NULL; p = p->next) {
+      size = MemBlockSize(&p->block);
+      if (stat->max_free < size) {
+        stat->max_free = size;
+      }
+    }
+    stat->max_free -= sizeof(mem_block_t);
+  }
+
+  return 1U;
+}
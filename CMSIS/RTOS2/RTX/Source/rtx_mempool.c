@@ -161,17 +161,18 @@ static void osRtxMemoryPoolPostProcess (os_memory_pool_t *mp) {
   void        *block;
   os_thread_t *thread;
 
-  // Check if Thread is waiting to allocate memory
-  if (mp->thread_list != NULL) {
+  // Check if Threads are waiting to allocate memory (blocks may have been freed in bulk)
+  while (mp->thread_list != NULL) {
     // Allocate memory
     block = osRtxMemoryPoolAlloc(&mp->mp_info);
-    if (block != NULL) {
-      // Wakeup waiting Thread with highest Priority
-      thread = osRtxThreadListGet(osRtxObject(mp));
-      //lint -e{923} "cast from pointer to unsigned int"
-      osRtxThreadWaitExit(thread, (uint32_t)block, FALSE);
-      EvrRtxMemoryPoolAllocated(mp, block);
+    if (block == NULL) {
+      break;
     }
+    // Wakeup waiting Thread with highest Priority
+    thread = osRtxThreadListGet(osRtxObject(mp));
+    //lint -e{923} "cast from pointer to unsigned int"
+    osRtxThreadWaitExit(thread, (uint32_t)block, FALSE);
+    EvrRtxMemoryPoolAllocated(mp, block);
   }
 }
 
@@ -300,6 +301,7 @@ static osMemoryPoolId_t svcRtxMemoryPoolNew (uint32_t block_count, uint32_t bloc
     mp->flags       = flags;
     mp->name        = name;
     mp->thread_list = NULL;
+    mp->wait_index  = NULL;
     (void)osRtxMemoryPoolInit(&mp->mp_info, b_count, b_size, mp_mem);
 
     // Register post ISR processing function
@@ -403,6 +405,85 @@ static osStatus_t svcRtxMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
   return status;
 }
 
+/// Allocate multiple memory blocks from a Memory Pool.
+/// \note API identical to osRtxMemoryPoolAllocBulk
+static uint32_t svcRtxMemoryPoolAllocBulk (osMemoryPoolId_t mp_id, void **blocks, uint32_t count) {
+  os_memory_pool_t *mp = osRtxMemoryPoolId(mp_id);
+  void             *block;
+  uint32_t          n;
+
+  // Check parameters
+  if ((mp == NULL) || (mp->id != osRtxIdMemoryPool) || (blocks == NULL)) {
+    EvrRtxMemoryPoolError(mp, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return 0U;
+  }
+
+  // Allocate memory
+  for (n = 0U; n < count; n++) {
+    block = osRtxMemoryPoolAlloc(&mp->mp_info);
+    if (block == NULL) {
+      break;
+    }
+    blocks[n] = block;
+    EvrRtxMemoryPoolAllocated(mp, block);
+  }
+  if ((n == 0U) && (count != 0U)) {
+    EvrRtxMemoryPoolAllocFailed(mp);
+  }
+
+  return n;
+}
+
+/// Return multiple allocated memory blocks back to a Memory Pool.
+/// \note API identical to osRtxMemoryPoolFreeBulk
+static osStatus_t svcRtxMemoryPoolFreeBulk (osMemoryPoolId_t mp_id, void * const *blocks, uint32_t count) {
+  os_memory_pool_t *mp = osRtxMemoryPoolId(mp_id);
+  void             *block;
+  os_thread_t      *thread;
+  uint32_t          n;
+
+  // Check parameters
+  if ((mp == NULL) || (mp->id != osRtxIdMemoryPool) || (blocks == NULL)) {
+    EvrRtxMemoryPoolError(mp, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  for (n = 0U; n < count; n++) {
+    //lint -e{946} "Relational operator applied to pointers"
+    if ((blocks[n] < mp->mp_info.block_base) || (blocks[n] >= mp->mp_info.block_lim)) {
+      EvrRtxMemoryPoolFreeFailed(mp, blocks[n]);
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return osErrorParameter;
+    }
+  }
+
+  // Free memory
+  for (n = 0U; n < count; n++) {
+    (void)osRtxMemoryPoolFree(&mp->mp_info, blocks[n]);
+    EvrRtxMemoryPoolDeallocated(mp, blocks[n]);
+  }
+
+  // Check if Threads are waiting to allocate memory
+  if (mp->thread_list != NULL) {
+    do {
+      // Allocate memory
+      block = osRtxMemoryPoolAlloc(&mp->mp_info);
+      if (block == NULL) {
+        break;
+      }
+      // Wakeup waiting Thread with highest Priority
+      thread = osRtxThreadListGet(osRtxObject(mp));
+      //lint -e{923} "cast from pointer to unsigned int"
+      osRtxThreadWaitExit(thread, (uint32_t)block, FALSE);
+      EvrRtxMemoryPoolAllocated(mp, block);
+    } while (mp->thread_list != NULL);
+    osRtxThreadDispatch(NULL);
+  }
+
+  return osOK;
+}
+
 /// Get maximum number of memory blocks in a Memory Pool.
 /// \note API identical to osMemoryPoolGetCapacity
 static uint32_t svcRtxMemoryPoolGetCapacity (osMemoryPoolId_t mp_id) {
@@ -493,6 +574,9 @@ static osStatus_t svcRtxMemoryPoolDelete (osMemoryPoolId_t mp_id) {
     osRtxThreadDispatch(NULL);
   }
 
+  // Free wait list index
+  osRtxThreadListFree(osRtxObject(mp));
+
   // Mark object as invalid
   mp->id = osRtxIdInvalid;
 
@@ -524,6 +608,8 @@ SVC0_3(MemoryPoolNew,          osMemoryPoolId_t, uint32_t, uint32_t, const osMem
 SVC0_1(MemoryPoolGetName,      const char *,     osMemoryPoolId_t)
 SVC0_2(MemoryPoolAlloc,        void *,           osMemoryPoolId_t, uint32_t)
 SVC0_2(MemoryPoolFree,         osStatus_t,       osMemoryPoolId_t, void *)
+SVC0_3(MemoryPoolAllocBulk,    uint32_t,         osMemoryPoolId_t, void **,        uint32_t)
+SVC0_3(MemoryPoolFreeBulk,     osStatus_t,       osMemoryPoolId_t, void * const *, uint32_t)
 SVC0_1(MemoryPoolGetCapacity,  uint32_t,         osMemoryPoolId_t)
 SVC0_1(MemoryPoolGetBlockSize, uint32_t,         osMemoryPoolId_t)
 SVC0_1(MemoryPoolGetCount,     uint32_t,         osMemoryPoolId_t)
@@ -586,6 +672,42 @@ osStatus_t isrRtxMemoryPoolFree (osMemoryPoolId_t mp_id, void *block) {
   return status;
 }
 
+/// Return multiple allocated memory blocks back to a Memory Pool.
+/// \note API identical to osRtxMemoryPoolFreeBulk
+__STATIC_INLINE
+osStatus_t isrRtxMemoryPoolFreeBulk (osMemoryPoolId_t mp_id, void * const *blocks, uint32_t count) {
+  os_memory_pool_t *mp = osRtxMemoryPoolId(mp_id);
+  uint32_t          n;
+
+  // Check parameters
+  if ((mp == NULL) || (mp->id != osRtxIdMemoryPool) || (blocks == NULL)) {
+    EvrRtxMemoryPoolError(mp, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+  for (n = 0U; n < count; n++) {
+    //lint -e{946} "Relational operator applied to pointers"
+    if ((blocks[n] < mp->mp_info.block_base) || (blocks[n] >= mp->mp_info.block_lim)) {
+      EvrRtxMemoryPoolFreeFailed(mp, blocks[n]);
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return osErrorParameter;
+    }
+  }
+
+  // Free memory
+  for (n = 0U; n < count; n++) {
+    (void)osRtxMemoryPoolFree(&mp->mp_info, blocks[n]);
+    EvrRtxMemoryPoolDeallocated(mp, blocks[n]);
+  }
+
+  // Register post ISR processing
+  if (count != 0U) {
+    osRtxPostProcess(osRtxObject(mp));
+  }
+
+  return osOK;
+}
+
 
 //  ==== Public API ====
 
@@ -703,3 +825,102 @@ osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id) {
   }
   return status;
 }
+
+/// Allocate multiple memory blocks from a Memory Pool.
+uint32_t osRtxMemoryPoolAllocBulk (osMemoryPoolId_t mp_id, void **blocks, uint32_t count) {
+  uint32_t n;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    n = svcRtxMemoryPoolAllocBulk(mp_id, blocks, count);
+  } else {
+    n =  __svcMemoryPoolAllocBulk(mp_id, blocks, count);
+  }
+  return n;
+}
+
+/// Return multiple allocated memory blocks back to a Memory Pool.
+osStatus_t osRtxMemoryPoolFreeBulk (osMemoryPoolId_t mp_id, void * const *blocks, uint32_t count) {
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrRtxMemoryPoolFreeBulk(mp_id, blocks, count);
+  } else {
+    status =  __svcMemoryPoolFreeBulk(mp_id, blocks, count);
+  }
+  return status;
+}
+
+/// Initialize a Memory Pool Cache.
+osStatus_t osRtxMemoryPoolCacheInit (osRtxMemoryPoolCache_t *cache, osMemoryPoolId_t mp_id, void **blocks, uint32_t size) {
+  os_memory_pool_t *mp = osRtxMemoryPoolId(mp_id);
+
+  // Check parameters
+  if ((cache == NULL) || (mp == NULL) || (mp->id != osRtxIdMemoryPool) || (blocks == NULL) || (size < 2U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  cache->mp_id  = mp_id;
+  cache->blocks = blocks;
+  cache->size   = size;
+  cache->count  = 0U;
+
+  return osOK;
+}
+
+/// Allocate a memory block through a Memory Pool Cache.
+void *osRtxMemoryPoolCacheAlloc (osRtxMemoryPoolCache_t *cache, uint32_t timeout) {
+
+  if (cache->count == 0U) {
+    // Refill half of the Cache
+    cache->count = osRtxMemoryPoolAllocBulk(cache->mp_id, cache->blocks, cache->size / 2U);
+    if (cache->count == 0U) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return osMemoryPoolAlloc(cache->mp_id, timeout);
+    }
+  }
+
+  cache->count--;
+  return cache->blocks[cache->count];
+}
+
+/// Return a memory block through a Memory Pool Cache.
+osStatus_t osRtxMemoryPoolCacheFree (osRtxMemoryPoolCache_t *cache, void *block) {
+  const os_memory_pool_t *mp = osRtxMemoryPoolId(cache->mp_id);
+  osStatus_t              status;
+  uint32_t                n;
+
+  //lint -e{946} "Relational operator applied to pointers"
+  if ((block < mp->mp_info.block_base) || (block >= mp->mp_info.block_lim)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  if (cache->count == cache->size) {
+    // Flush half of the Cache
+    n = cache->size / 2U;
+    status = osRtxMemoryPoolFreeBulk(cache->mp_id, &cache->blocks[cache->count - n], n);
+    if (status != osOK) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return status;
+    }
+    cache->count -= n;
+  }
+
+  cache->blocks[cache->count] = block;
+  cache->count++;
+
+  return osOK;
+}
+
+/// Return all memory blocks held by a Memory Pool Cache to the Memory Pool.
+osStatus_t osRtxMemoryPoolCacheFlush (osRtxMemoryPoolCache_t *cache) {
+  osStatus_t status;
+
+  status = osRtxMemoryPoolFreeBulk(cache->mp_id, cache->blocks, cache->count);
+  if (status == osOK) {
+    cache->count = 0U;
+  }
+
+  return status;
+}
@@ -34,8 +34,26 @@ __attribute__((section(".data.os.msgqueue.obj"))) =
 #endif
 
 
+//  Message Flags (0 - queued)
+#define MESSAGE_TAKEN           1U      // Taken from Queue (removal pending)
+#define MESSAGE_LOANED          2U      // Loaned to a Thread (not in Queue)
+
+
 //  ==== Helper functions ====
 
+/// Get the Priority level of a Message.
+/// \param[in]  msg             message object.
+/// \return priority level (priorities 31 to 255 share the last level).
+static uint32_t MessagePrioLevel (const os_message_t *msg) {
+  uint32_t level = msg->priority;
+
+  if (level > 31U) {
+    level = 31U;
+  }
+
+  return level;
+}
+
 /// Put a Message into Queue sorted by Priority (Highest at Head).
 /// \param[in]  mq              message queue object.
 /// \param[in]  msg             message object.
@@ -44,32 +62,43 @@ static void MessageQueuePut (os_message_queue_t *mq, os_message_t *msg) {
   uint32_t      primask = __get_PRIMASK();
 #endif
   os_message_t *prev, *next;
-
-  if (mq->msg_last != NULL) {
-    prev = mq->msg_last;
-    next = NULL;
-    while ((prev != NULL) && (prev->priority < msg->priority)) {
-      next = prev;
-      prev = prev->prev;
-    }
-    msg->prev = prev;
-    msg->next = next;
-    if (prev != NULL) {
-      prev->next = msg;
-    } else {
-      mq->msg_first = msg;
-    }
-    if (next != NULL) {
-      next->prev = msg;
-    } else {
-      mq->msg_last = msg;
+  uint32_t      level, map;
+
+  // Insert behind the last Message of the lowest used Priority level at or above the Message level
+  level = MessagePrioLevel(msg);
+  map   = mq->msg_prio_map & (0xFFFFFFFFU >> level);
+  if (map != 0U) {
+    prev = mq->msg_prio_tail[__CLZ(map)];
+    if (level == 31U) {
+      // Last level holds several priorities: keep them sorted
+      while ((prev != NULL) && (prev->priority < msg->priority)) {
+        prev = prev->prev;
+      }
     }
   } else {
-    msg->prev = NULL;
-    msg->next = NULL;
-    mq->msg_first= msg;
+    prev = NULL;
+  }
+  if (prev != NULL) {
+    next = prev->next;
+    prev->next = msg;
+  } else {
+    next = mq->msg_first;
+    mq->msg_first = msg;
+  }
+  if (next != NULL) {
+    next->prev = msg;
+  } else {
     mq->msg_last = msg;
   }
+  msg->prev = prev;
+  msg->next = next;
+
+  // Register Message as last Message of its Priority level
+  if (((mq->msg_prio_map & (0x80000000U >> level)) == 0U) ||
+      (mq->msg_prio_tail[level] == prev)) {
+    mq->msg_prio_tail[level] = msg;
+    mq->msg_prio_map |= 0x80000000U >> level;
+  }
 
 #if (EXCLUSIVE_ACCESS == 0)
   __disable_irq();
@@ -142,6 +171,17 @@ static os_message_t *MessageQueueGet (os_message_queue_t *mq) {
 /// \param[in]  mq              message queue object.
 /// \param[in]  msg             message object.
 static void MessageQueueRemove (os_message_queue_t *mq, const os_message_t *msg) {
+  uint32_t level = MessagePrioLevel(msg);
+
+  // Unregister Message from its Priority level
+  if (mq->msg_prio_tail[level] == msg) {
+    if ((msg->prev != NULL) && (MessagePrioLevel(msg->prev) == level)) {
+      mq->msg_prio_tail[level] = msg->prev;
+    } else {
+      mq->msg_prio_tail[level] = NULL;
+      mq->msg_prio_map &= ~(0x80000000U >> level);
+    }
+  }
 
   if (msg->prev != NULL) {
     msg->prev->next = msg->next;
@@ -155,6 +195,164 @@ static void MessageQueueRemove (os_message_queue_t *mq, const os_message_t *msg)
   }
 }
 
+/// Get a Thread with highest Priority waiting to send or to receive a Message.
+/// \param[in]  mq              message queue object.
+/// \param[in]  put             true - waiting to send, false - waiting to receive.
+/// \return thread object or NULL.
+static os_thread_t *MessageQueueWaiting (const os_message_queue_t *mq, bool_t put) {
+  os_thread_t *thread;
+
+  // Threads waiting to receive and to send are mixed only when Messages are loaned
+  thread = mq->thread_list;
+  if (put) {
+    while ((thread != NULL) && (thread->state != osRtxThreadWaitingMessagePut) &&
+                               (thread->state != osRtxThreadWaitingMessageAlloc)) {
+      thread = thread->thread_next;
+    }
+  } else if (mq->msg_count == 0U) {
+    while ((thread != NULL) && (thread->state != osRtxThreadWaitingMessageGet) &&
+                               (thread->state != osRtxThreadWaitingMessageReceive)) {
+      thread = thread->thread_next;
+    }
+  } else {
+    thread = NULL;
+  }
+
+  return thread;
+}
+
+/// Get a Message loaned from a Queue.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg_ptr         pointer to message data.
+/// \return message object or NULL when not loaned.
+static os_message_t *MessageQueueLoaned (const os_message_queue_t *mq, void *msg_ptr) {
+  os_message_t *msg;
+  uint32_t      offset;
+
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return NULL;
+  }
+
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = msg_ptr;
+  msg--;
+
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
+  offset = (uint32_t)msg - (uint32_t)mq->mp_info.block_base;
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int" [MISRA Note 7]
+  if (((uint32_t)msg < (uint32_t)mq->mp_info.block_base) ||
+      ((uint32_t)msg >= (uint32_t)mq->mp_info.block_lim)  ||
+      ((offset % mq->mp_info.block_size) != 0U) ||
+      (msg->id != osRtxIdMessage) || (msg->flags == 0U)) {
+    msg = NULL;
+  }
+
+  return msg;
+}
+
+/// Deliver a Message to a Thread waiting to receive a Message.
+/// \param[in]  mq              message queue object.
+/// \param[in]  thread          thread object.
+/// \param[in]  msg             message object.
+/// \param[in]  dispatch        dispatch flag.
+static void MessageQueueDeliver (os_message_queue_t *mq, os_thread_t *thread, os_message_t *msg, bool_t dispatch) {
+  const uint32_t *reg;
+  void           *ptr;
+  uint8_t         state;
+
+  state = thread->state;
+  osRtxThreadListRemove(thread);
+  osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+  reg = osRtxThreadRegPtr(thread);
+  if (reg[3] != 0U) {
+    //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+    *((uint8_t *)reg[3]) = msg->priority;
+  }
+  if (state == osRtxThreadWaitingMessageReceive) {
+    // Loan Message (R2: void **msg_ptr, R3: uint8_t *msg_prio)
+    msg->flags = MESSAGE_LOANED;
+    ptr = &msg[1];
+    //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+    *((void **)reg[2]) = ptr;
+  } else {
+    // Copy Message (R2: void *msg_ptr, R3: uint8_t *msg_prio)
+    //lint -e{923} "cast from unsigned int to pointer"
+    ptr = (void *)reg[2];
+    memcpy(ptr, &msg[1], mq->msg_size);
+    // Free memory
+    msg->id = osRtxIdInvalid;
+    (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+  }
+  EvrRtxMessageQueueRetrieved(mq, ptr);
+}
+
+/// Insert a new Message: deliver it to a waiting Thread or put it into Queue.
+/// \param[in]  mq              message queue object.
+/// \param[in]  msg             message object.
+/// \param[in]  dispatch        dispatch flag.
+static void MessageQueueInsert (os_message_queue_t *mq, os_message_t *msg, bool_t dispatch) {
+  os_thread_t *thread;
+
+  thread = MessageQueueWaiting(mq, FALSE);
+  if (thread != NULL) {
+    MessageQueueDeliver(mq, thread, msg, dispatch);
+  } else {
+    msg->flags = 0U;
+    MessageQueuePut(mq, msg);
+  }
+}
+
+/// Allocate a Message for a Thread waiting to send a Message.
+/// \param[in]  mq              message queue object.
+/// \param[in]  dispatch        dispatch flag.
+/// \return true - thread woken up, false - no thread waiting or no memory.
+static bool_t MessageQueueWakeup (os_message_queue_t *mq, bool_t dispatch) {
+  os_message_t   *msg;
+  os_thread_t    *thread;
+  const uint32_t *reg;
+  const void     *ptr;
+  uint8_t         state;
+
+  thread = MessageQueueWaiting(mq, TRUE);
+  if (thread == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  // Wakeup waiting Thread with highest Priority
+  state = thread->state;
+  osRtxThreadListRemove(thread);
+  osRtxThreadWaitExit(thread, (uint32_t)osOK, dispatch);
+  reg = osRtxThreadRegPtr(thread);
+  msg->id = osRtxIdMessage;
+  if (state == osRtxThreadWaitingMessageAlloc) {
+    // Loan Message (R2: void **msg_ptr)
+    msg->flags = MESSAGE_LOANED;
+    //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+    *((void **)reg[2]) = &msg[1];
+  } else {
+    // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
+    //lint -e{923} "cast from unsigned int to pointer"
+    ptr = (const void *)reg[2];
+    memcpy(&msg[1], ptr, mq->msg_size);
+    // Store Message into Queue
+    msg->priority = (uint8_t)reg[3];
+    EvrRtxMessageQueueInserted(mq, ptr);
+    MessageQueueInsert(mq, msg, dispatch);
+  }
+
+  return TRUE;
+}
+
 
 //  ==== Post ISR processing ====
 
@@ -162,71 +360,28 @@ static void MessageQueueRemove (os_message_queue_t *mq, const os_message_t *msg)
 /// \param[in]  msg             message object.
 static void osRtxMessageQueuePostProcess (os_message_t *msg) {
   os_message_queue_t *mq;
-  os_message_t       *msg0;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
   const void         *ptr_src;
-        void         *ptr_dst;
 
   if (msg->flags != 0U) {
-    // Remove Message
+    // Remove Message (taken or released)
     //lint -e{9079} -e{9087} "cast between pointers to different object types"
     mq = *((os_message_queue_t **)(void *)&msg[1]);
-    MessageQueueRemove(mq, msg);
+    if (msg->flags == MESSAGE_TAKEN) {
+      MessageQueueRemove(mq, msg);
+    }
     // Free memory
     msg->id = osRtxIdInvalid;
     (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
     // Check if Thread is waiting to send a Message
-    if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessagePut)) {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg0 = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg0 != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-        // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr_src = (const void *)reg[2];
-        memcpy(&msg0[1], ptr_src, mq->msg_size);
-        // Store Message into Queue
-        msg0->id       = osRtxIdMessage;
-        msg0->flags    = 0U;
-        msg0->priority = (uint8_t)reg[3];
-        MessageQueuePut(mq, msg0);
-        EvrRtxMessageQueueInserted(mq, ptr_src);
-      }
-    }
+    (void)MessageQueueWakeup(mq, FALSE);
   } else {
     // New Message
     //lint -e{9079} -e{9087} "cast between pointers to different object types"
     mq = (void *)msg->next;
     //lint -e{9087} "cast between pointers to different object types"
     ptr_src = (const void *)msg->prev;
-    // Check if Thread is waiting to receive a Message
-    if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessageGet)) {
-      EvrRtxMessageQueueInserted(mq, ptr_src);
-      // Wakeup waiting Thread with highest Priority
-      thread = osRtxThreadListGet(osRtxObject(mq));
-      osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-      // Copy Message (R2: void *msg_ptr, R3: uint8_t *msg_prio)
-      reg = osRtxThreadRegPtr(thread);
-      //lint -e{923} "cast from unsigned int to pointer"
-      ptr_dst = (void *)reg[2];
-      memcpy(ptr_dst, &msg[1], mq->msg_size);
-      if (reg[3] != 0U) {
-        //lint -e{923} -e{9078} "cast from unsigned int to pointer"
-        *((uint8_t *)reg[3]) = msg->priority;
-      }
-      EvrRtxMessageQueueRetrieved(mq, ptr_dst);
-      // Free memory
-      msg->id = osRtxIdInvalid;
-      (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
-    } else {
-      EvrRtxMessageQueueInserted(mq, ptr_src);
-      MessageQueuePut(mq, msg);
-    }
+    EvrRtxMessageQueueInserted(mq, ptr_src);
+    MessageQueueInsert(mq, msg, FALSE);
   }
 }
 
@@ -353,10 +508,12 @@ static osMessageQueueId_t svcRtxMessageQueueNew (uint32_t msg_count, uint32_t ms
     mq->flags       = flags;
     mq->name        = name;
     mq->thread_list = NULL;
+    mq->wait_index  = NULL;
     mq->msg_size    = msg_size;
     mq->msg_count   = 0U;
     mq->msg_first   = NULL;
     mq->msg_last    = NULL;
+    mq->msg_prio_map = 0U;
     (void)osRtxMemoryPoolInit(&mq->mp_info, msg_count, block_size, mq_mem);
 
     // Register post ISR processing function
@@ -404,11 +561,12 @@ static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *m
     return osErrorParameter;
   }
 
-  // Check if Thread is waiting to receive a Message
-  if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessageGet)) {
+  // Check if Thread is waiting to receive a Message (copy)
+  thread = MessageQueueWaiting(mq, FALSE);
+  if ((thread != NULL) && (thread->state == osRtxThreadWaitingMessageGet)) {
     EvrRtxMessageQueueInserted(mq, msg_ptr);
     // Wakeup waiting Thread with highest Priority
-    thread = osRtxThreadListGet(osRtxObject(mq));
+    osRtxThreadListRemove(thread);
     osRtxThreadWaitExit(thread, (uint32_t)osOK, TRUE);
     // Copy Message (R2: void *msg_ptr, R3: uint8_t *msg_prio)
     reg = osRtxThreadRegPtr(thread);
@@ -430,10 +588,9 @@ static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *m
       memcpy(&msg[1], msg_ptr, mq->msg_size);
       // Put Message into Queue
       msg->id       = osRtxIdMessage;
-      msg->flags    = 0U;
       msg->priority = msg_prio;
-      MessageQueuePut(mq, msg);
       EvrRtxMessageQueueInserted(mq, msg_ptr);
+      MessageQueueInsert(mq, msg, TRUE);
       status = osOK;
     } else {
       // No memory available
@@ -468,9 +625,7 @@ static osStatus_t svcRtxMessageQueuePut (osMessageQueueId_t mq_id, const void *m
 static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
   os_message_t       *msg;
-  os_thread_t        *thread;
   uint32_t           *reg;
-  const void         *ptr;
   osStatus_t          status;
 
   // Check parameters
@@ -494,27 +649,7 @@ static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr
     msg->id = osRtxIdInvalid;
     (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
     // Check if Thread is waiting to send a Message
-    if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessagePut)) {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, TRUE);
-        // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr = (const void *)reg[2];
-        memcpy(&msg[1], ptr, mq->msg_size);
-        // Store Message into Queue
-        msg->id       = osRtxIdMessage;
-        msg->flags    = 0U;
-        msg->priority = (uint8_t)reg[3];
-        MessageQueuePut(mq, msg);
-        EvrRtxMessageQueueInserted(mq, ptr);
-      }
-    }
+    (void)MessageQueueWakeup(mq, TRUE);
     status = osOK;
   } else {
     // No Message available
@@ -543,6 +678,160 @@ static osStatus_t svcRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr
   return status;
 }
 
+/// Allocate a Message in a Queue or timeout if Queue is full.
+/// \note API identical to osRtxMessageQueueAlloc
+static osStatus_t svcRtxMessageQueueAlloc (osMessageQueueId_t mq_id, void **msg_ptr, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  uint32_t           *reg;
+  osStatus_t          status;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg != NULL) {
+    // Loan Message
+    msg->id    = osRtxIdMessage;
+    msg->flags = MESSAGE_LOANED;
+    *msg_ptr   = &msg[1];
+    status = osOK;
+  } else {
+    // No memory available
+    if (timeout != 0U) {
+      EvrRtxMessageQueuePutPending(mq, NULL, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageAlloc, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+        // Save arguments (R2: void **msg_ptr)
+        //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+        reg = (uint32_t *)(__get_PSP());
+        //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+        reg[2] = (uint32_t)msg_ptr;
+      } else {
+        EvrRtxMessageQueuePutTimeout(mq);
+      }
+      status = osErrorTimeout;
+    } else {
+      EvrRtxMessageQueueNotInserted(mq, NULL);
+      status = osErrorResource;
+    }
+  }
+
+  return status;
+}
+
+/// Put an allocated Message into a Queue.
+/// \note API identical to osRtxMessageQueueCommit
+static osStatus_t svcRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  msg = MessageQueueLoaned(mq, msg_ptr);
+  if ((msg == NULL) || (msg->flags != MESSAGE_LOANED)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Put Message into Queue
+  msg->priority = msg_prio;
+  EvrRtxMessageQueueInserted(mq, msg_ptr);
+  MessageQueueInsert(mq, msg, TRUE);
+
+  return osOK;
+}
+
+/// Receive a Message from a Queue without copy or timeout if Queue is empty.
+/// \note API identical to osRtxMessageQueueReceive
+static osStatus_t svcRtxMessageQueueReceive (osMessageQueueId_t mq_id, void **msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  uint32_t           *reg;
+  osStatus_t          status;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Get Message from Queue
+  msg = MessageQueueGet(mq);
+  if (msg != NULL) {
+    MessageQueueRemove(mq, msg);
+    // Loan Message
+    msg->flags = MESSAGE_LOANED;
+    *msg_ptr   = &msg[1];
+    if (msg_prio != NULL) {
+      *msg_prio = msg->priority;
+    }
+    EvrRtxMessageQueueRetrieved(mq, *msg_ptr);
+    status = osOK;
+  } else {
+    // No Message available
+    if (timeout != 0U) {
+      EvrRtxMessageQueueGetPending(mq, msg_ptr, timeout);
+      // Suspend current Thread
+      if (osRtxThreadWaitEnter(osRtxThreadWaitingMessageReceive, timeout)) {
+        osRtxThreadListPut(osRtxObject(mq), osRtxThreadGetRunning());
+        // Save arguments (R2: void **msg_ptr, R3: uint8_t *msg_prio)
+        //lint -e{923} -e{9078} "cast from unsigned int to pointer"
+        reg = (uint32_t *)(__get_PSP());
+        //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+        reg[2] = (uint32_t)msg_ptr;
+        //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+        reg[3] = (uint32_t)msg_prio;
+      } else {
+        EvrRtxMessageQueueGetTimeout(mq);
+      }
+      status = osErrorTimeout;
+    } else {
+      EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
+      status = osErrorResource;
+    }
+  }
+
+  return status;
+}
+
+/// Release a received or allocated Message back to a Queue.
+/// \note API identical to osRtxMessageQueueRelease
+static osStatus_t svcRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  msg = MessageQueueLoaned(mq, msg_ptr);
+  if (msg == NULL) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Remove Message received in an ISR
+  if (msg->flags == MESSAGE_TAKEN) {
+    MessageQueueRemove(mq, msg);
+  }
+
+  // Free memory
+  msg->id = osRtxIdInvalid;
+  (void)osRtxMemoryPoolFree(&mq->mp_info, msg);
+
+  // Check if Thread is waiting to send a Message
+  (void)MessageQueueWakeup(mq, TRUE);
+
+  return osOK;
+}
+
 /// Get maximum number of messages in a Message Queue.
 /// \note API identical to osMessageGetCapacity
 static uint32_t svcRtxMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
@@ -606,9 +895,9 @@ static uint32_t svcRtxMessageQueueGetSpace (osMessageQueueId_t mq_id) {
     return 0U;
   }
 
-  EvrRtxMessageQueueGetSpace(mq, mq->mp_info.max_blocks - mq->msg_count);
+  EvrRtxMessageQueueGetSpace(mq, mq->mp_info.max_blocks - mq->mp_info.used_blocks);
 
-  return (mq->mp_info.max_blocks - mq->msg_count);
+  return (mq->mp_info.max_blocks - mq->mp_info.used_blocks);
 }
 
 /// Reset a Message Queue to initial empty state.
@@ -616,9 +905,6 @@ static uint32_t svcRtxMessageQueueGetSpace (osMessageQueueId_t mq_id) {
 static osStatus_t svcRtxMessageQueueReset (osMessageQueueId_t mq_id) {
   os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
   os_message_t       *msg;
-  os_thread_t        *thread;
-  const uint32_t     *reg;
-  const void         *ptr;
 
   // Check parameters
   if ((mq == NULL) || (mq->id != osRtxIdMessageQueue)) {
@@ -642,28 +928,8 @@ static osStatus_t svcRtxMessageQueueReset (osMessageQueueId_t mq_id) {
   }
 
   // Check if Threads are waiting to send Messages
-  if ((mq->thread_list != NULL) && (mq->thread_list->state == osRtxThreadWaitingMessagePut)) {
-    do {
-      // Try to allocate memory
-      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
-      msg = osRtxMemoryPoolAlloc(&mq->mp_info);
-      if (msg != NULL) {
-        // Wakeup waiting Thread with highest Priority
-        thread = osRtxThreadListGet(osRtxObject(mq));
-        osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
-        // Copy Message (R2: const void *msg_ptr, R3: uint8_t msg_prio)
-        reg = osRtxThreadRegPtr(thread);
-        //lint -e{923} "cast from unsigned int to pointer"
-        ptr = (const void *)reg[2];
-        memcpy(&msg[1], ptr, mq->msg_size);
-        // Store Message into Queue
-        msg->id       = osRtxIdMessage;
-        msg->flags    = 0U;
-        msg->priority = (uint8_t)reg[3];
-        MessageQueuePut(mq, msg);
-        EvrRtxMessageQueueInserted(mq, ptr);
-      }
-    } while ((msg != NULL) && (mq->thread_list != NULL));
+  if (MessageQueueWakeup(mq, FALSE)) {
+    while (MessageQueueWakeup(mq, FALSE)) {}
     osRtxThreadDispatch(NULL);
   }
 
@@ -694,6 +960,9 @@ static osStatus_t svcRtxMessageQueueDelete (osMessageQueueId_t mq_id) {
     osRtxThreadDispatch(NULL);
   }
 
+  // Free wait list index
+  osRtxThreadListFree(osRtxObject(mq));
+
   // Mark object as invalid
   mq->id = osRtxIdInvalid;
 
@@ -725,6 +994,10 @@ SVC0_3(MessageQueueNew,         osMessageQueueId_t, uint32_t, uint32_t, const os
 SVC0_1(MessageQueueGetName,     const char *,       osMessageQueueId_t)
 SVC0_4(MessageQueuePut,         osStatus_t,         osMessageQueueId_t, const void *, uint8_t,   uint32_t)
 SVC0_4(MessageQueueGet,         osStatus_t,         osMessageQueueId_t,       void *, uint8_t *, uint32_t)
+SVC0_3(MessageQueueAlloc,       osStatus_t,         osMessageQueueId_t,      void **, uint32_t)
+SVC0_3(MessageQueueCommit,      osStatus_t,         osMessageQueueId_t,       void *, uint8_t)
+SVC0_4(MessageQueueReceive,     osStatus_t,         osMessageQueueId_t,      void **, uint8_t *, uint32_t)
+SVC0_2(MessageQueueRelease,     osStatus_t,         osMessageQueueId_t,       void *)
 SVC0_1(MessageQueueGetCapacity, uint32_t,           osMessageQueueId_t)
 SVC0_1(MessageQueueGetMsgSize,  uint32_t,           osMessageQueueId_t)
 SVC0_1(MessageQueueGetCount,    uint32_t,           osMessageQueueId_t)
@@ -815,6 +1088,123 @@ osStatus_t isrRtxMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8
   return status;
 }
 
+/// Allocate a Message in a Queue or timeout if Queue is full.
+/// \note API identical to osRtxMessageQueueAlloc
+__STATIC_INLINE
+osStatus_t isrRtxMessageQueueAlloc (osMessageQueueId_t mq_id, void **msg_ptr, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  osStatus_t          status;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL) || (timeout != 0U)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Try to allocate memory
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  msg = osRtxMemoryPoolAlloc(&mq->mp_info);
+  if (msg != NULL) {
+    // Loan Message
+    msg->id    = osRtxIdMessage;
+    msg->flags = MESSAGE_LOANED;
+    *msg_ptr   = &msg[1];
+    status = osOK;
+  } else {
+    // No memory available
+    EvrRtxMessageQueueNotInserted(mq, NULL);
+    status = osErrorResource;
+  }
+
+  return status;
+}
+
+/// Put an allocated Message into a Queue.
+/// \note API identical to osRtxMessageQueueCommit
+__STATIC_INLINE
+osStatus_t isrRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  msg = MessageQueueLoaned(mq, msg_ptr);
+  if ((msg == NULL) || (msg->flags != MESSAGE_LOANED)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  msg->flags    = 0U;
+  msg->priority = msg_prio;
+  // Register post ISR processing
+  //lint -e{9079} -e{9087} "cast between pointers to different object types"
+  *((const void **)(void *)&msg->prev) = msg_ptr;
+  //lint -e{9079} -e{9087} "cast between pointers to different object types"
+  *(      (void **)        &msg->next) = mq;
+  osRtxPostProcess(osRtxObject(msg));
+  EvrRtxMessageQueueInsertPending(mq, msg_ptr);
+
+  return osOK;
+}
+
+/// Receive a Message from a Queue without copy or timeout if Queue is empty.
+/// \note API identical to osRtxMessageQueueReceive
+__STATIC_INLINE
+osStatus_t isrRtxMessageQueueReceive (osMessageQueueId_t mq_id, void **msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+  osStatus_t          status;
+
+  // Check parameters
+  if ((mq == NULL) || (mq->id != osRtxIdMessageQueue) || (msg_ptr == NULL) || (timeout != 0U)) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Get Message from Queue (stays taken in Queue until released)
+  msg = MessageQueueGet(mq);
+  if (msg != NULL) {
+    *msg_ptr = &msg[1];
+    if (msg_prio != NULL) {
+      *msg_prio = msg->priority;
+    }
+    EvrRtxMessageQueueRetrieved(mq, *msg_ptr);
+    status = osOK;
+  } else {
+    // No Message available
+    EvrRtxMessageQueueNotRetrieved(mq, msg_ptr);
+    status = osErrorResource;
+  }
+
+  return status;
+}
+
+/// Release a received or allocated Message back to a Queue.
+/// \note API identical to osRtxMessageQueueRelease
+__STATIC_INLINE
+osStatus_t isrRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
+  os_message_queue_t *mq = osRtxMessageQueueId(mq_id);
+  os_message_t       *msg;
+
+  // Check parameters
+  msg = MessageQueueLoaned(mq, msg_ptr);
+  if (msg == NULL) {
+    EvrRtxMessageQueueError(mq, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  // Register post ISR processing
+  //lint -e{9079} -e{9087} "cast between pointers to different object types"
+  *((os_message_queue_t **)(void *)&msg[1]) = mq;
+  osRtxPostProcess(osRtxObject(msg));
+
+  return osOK;
+}
+
 
 //  ==== Public API ====
 
@@ -871,6 +1261,56 @@ osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *
   return status;
 }
 
+/// Allocate a Message in a Queue or timeout if Queue is full.
+osStatus_t osRtxMessageQueueAlloc (osMessageQueueId_t mq_id, void **msg_ptr, uint32_t timeout) {
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrRtxMessageQueueAlloc(mq_id, msg_ptr, timeout);
+  } else {
+    status =  __svcMessageQueueAlloc(mq_id, msg_ptr, timeout);
+  }
+  return status;
+}
+
+/// Put an allocated Message into a Queue.
+osStatus_t osRtxMessageQueueCommit (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t msg_prio) {
+  osStatus_t status;
+
+  EvrRtxMessageQueuePut(mq_id, msg_ptr, msg_prio, 0U);
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrRtxMessageQueueCommit(mq_id, msg_ptr, msg_prio);
+  } else {
+    status =  __svcMessageQueueCommit(mq_id, msg_ptr, msg_prio);
+  }
+  return status;
+}
+
+/// Receive a Message from a Queue without copy or timeout if Queue is empty.
+osStatus_t osRtxMessageQueueReceive (osMessageQueueId_t mq_id, void **msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  osStatus_t status;
+
+  EvrRtxMessageQueueGet(mq_id, msg_ptr, msg_prio, timeout);
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrRtxMessageQueueReceive(mq_id, msg_ptr, msg_prio, timeout);
+  } else {
+    status =  __svcMessageQueueReceive(mq_id, msg_ptr, msg_prio, timeout);
+  }
+  return status;
+}
+
+/// Release a received or allocated Message back to a Queue.
+osStatus_t osRtxMessageQueueRelease (osMessageQueueId_t mq_id, void *msg_ptr) {
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = isrRtxMessageQueueRelease(mq_id, msg_ptr);
+  } else {
+    status =  __svcMessageQueueRelease(mq_id, msg_ptr);
+  }
+  return status;
+}
+
 /// Get maximum number of messages in a Message Queue.
 uint32_t osMessageQueueGetCapacity (osMessageQueueId_t mq_id) {
   uint32_t capacity;
@@ -34,6 +34,137 @@ __attribute__((section(".data.os.mutex.obj"))) =
 #endif
 
 
+//  The owner Thread claims an unlocked Mutex by setting the owner Thread with
+//  compare and swap and releases it the same way, so that uncontended Mutexes
+//  are acquired and released without a Service Call (EXCLUSIVE_ACCESS only).
+//  The Mutex is linked into the Mutex list of the owner Thread only when the
+//  kernel needs it (waiting Threads or Robust Mutex). A linked Mutex is tagged
+//  in the owner Thread pointer and is released only by the kernel.
+
+#define MUTEX_OWNER_LINKED      1U              // Owner Thread tag: Mutex linked
+
+
+//  ==== Helper functions ====
+
+/// Get owner Thread of a Mutex.
+/// \param[in]  mutex           mutex object.
+/// \return owner thread object or NULL when not locked.
+static os_thread_t *MutexOwner (const os_mutex_t *mutex) {
+  //lint -e{923} -e{9078} "cast between pointer and unsigned int"
+  return ((os_thread_t *)((uint32_t)mutex->owner_thread & ~MUTEX_OWNER_LINKED));
+}
+
+/// Check if Mutex is linked into the Mutex list of the owner Thread.
+/// \param[in]  mutex           mutex object.
+/// \return true - linked, false - not linked.
+static bool_t MutexOwnerLinked (const os_mutex_t *mutex) {
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+  return (((uint32_t)mutex->owner_thread & MUTEX_OWNER_LINKED) != 0U);
+}
+
+/// Set owner Thread of a Mutex and link Mutex into its Mutex list.
+/// \param[in]  mutex           mutex object.
+/// \param[in]  thread          thread object.
+static void MutexOwnerLink (os_mutex_t *mutex, os_thread_t *thread) {
+  //lint -e{923} -e{9078} "cast between pointer and unsigned int"
+  mutex->owner_thread = (os_thread_t *)((uint32_t)thread | MUTEX_OWNER_LINKED);
+  mutex->owner_next   = thread->mutex_list;
+  mutex->owner_prev   = NULL;
+  if (thread->mutex_list != NULL) {
+    thread->mutex_list->owner_prev = mutex;
+  }
+  thread->mutex_list  = mutex;
+}
+
+/// Remove Mutex from the Mutex list of the owner Thread.
+/// \param[in]  mutex           mutex object.
+/// \param[in]  thread          thread object.
+static void MutexOwnerUnlink (const os_mutex_t *mutex, os_thread_t *thread) {
+  if (mutex->owner_next != NULL) {
+    mutex->owner_next->owner_prev = mutex->owner_prev;
+  }
+  if (mutex->owner_prev != NULL) {
+    mutex->owner_prev->owner_next = mutex->owner_next;
+  } else {
+    thread->mutex_list = mutex->owner_next;
+  }
+}
+
+#if (EXCLUSIVE_ACCESS == 1)
+/// Acquire an uncontended Mutex without Service Call.
+/// \param[in]  mutex           mutex object.
+/// \return true - acquired, false - Service Call required.
+static bool_t MutexAcquireFast (os_mutex_t *mutex) {
+  os_thread_t *thread = osRtxThreadGetRunning();
+  os_thread_t *owner;
+
+  if ((thread == NULL) || (mutex == NULL) || (mutex->id != osRtxIdMutex) ||
+      ((mutex->attr & osMutexRobust) != 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  //lint -e{9079} -e{9087} "volatile read of owner changed by the kernel"
+  owner = *((os_thread_t * volatile *)&mutex->owner_thread);
+  if (owner == NULL) {
+    // Claim Mutex (Lock counter is set by the kernel when preempted before it is set)
+    //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+    if (atomic_cas32((uint32_t *)&mutex->owner_thread, 0U, (uint32_t)thread) != 0U) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return FALSE;
+    }
+    mutex->lock = 1U;
+  } else if ((MutexOwner(mutex) == thread) && ((mutex->attr & osMutexRecursive) != 0U) &&
+             (mutex->lock != osRtxMutexLockLimit)) {
+    mutex->lock++;
+  } else {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  EvrRtxMutexAcquired(mutex, mutex->lock);
+
+  return TRUE;
+}
+
+/// Release an uncontended Mutex without Service Call.
+/// \param[in]  mutex           mutex object.
+/// \return true - released, false - Service Call required.
+static bool_t MutexReleaseFast (os_mutex_t *mutex) {
+  os_thread_t *thread = osRtxThreadGetRunning();
+  os_thread_t *owner;
+  uint8_t      lock;
+
+  if ((thread == NULL) || (mutex == NULL) || (mutex->id != osRtxIdMutex) ||
+      (MutexOwner(mutex) != thread)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+
+  //lint -e{9079} -e{9087} "volatile read of owner changed by the kernel"
+  owner = *((os_thread_t * volatile *)&mutex->owner_thread);
+  lock  = mutex->lock;
+  if (lock > 1U) {
+    mutex->lock = lock - 1U;
+  } else if ((lock == 1U) && (owner == thread)) {
+    // Release Mutex unless the kernel has linked it in the meantime
+    mutex->lock = 0U;
+    //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+    if (atomic_cas32((uint32_t *)&mutex->owner_thread, (uint32_t)thread, 0U) != (uint32_t)thread) {
+      mutex->lock = 1U;
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return FALSE;
+    }
+  } else {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  EvrRtxMutexReleased(mutex, lock - 1U);
+
+  return TRUE;
+}
+#endif
+
+
 //  ==== Library functions ====
 
 /// Release Mutex list when owner Thread terminates.
@@ -50,6 +181,7 @@ void osRtxMutexOwnerRelease (os_mutex_t *mutex_list) {
     // Check if Mutex is Robust
     if ((mutex->attr & osMutexRobust) != 0U) {
       // Clear Lock counter
+      mutex->owner_thread = NULL;
       mutex->lock = 0U;
       EvrRtxMutexReleased(mutex, 0U);
       // Check if Thread is waiting for a Mutex
@@ -58,10 +190,7 @@ void osRtxMutexOwnerRelease (os_mutex_t *mutex_list) {
         thread = osRtxThreadListGet(osRtxObject(mutex));
         osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
         // Thread is the new Mutex owner
-        mutex->owner_thread = thread;
-        mutex->owner_next   = thread->mutex_list;
-        mutex->owner_prev   = NULL;
-        thread->mutex_list  = mutex;
+        MutexOwnerLink(mutex, thread);
         mutex->lock = 1U;
         EvrRtxMutexAcquired(mutex, 1U);
       }
@@ -138,6 +267,7 @@ static osMutexId_t svcRtxMutexNew (const osMutexAttr_t *attr) {
     mutex->attr         = (uint8_t)attr_bits;
     mutex->name         = name;
     mutex->thread_list  = NULL;
+    mutex->wait_index   = NULL;
     mutex->owner_thread = NULL;
     mutex->owner_prev   = NULL;
     mutex->owner_next   = NULL;
@@ -173,6 +303,7 @@ static const char *svcRtxMutexGetName (osMutexId_t mutex_id) {
 static osStatus_t svcRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
   os_mutex_t  *mutex = osRtxMutexId(mutex_id);
   os_thread_t *runnig_thread;
+  os_thread_t *owner_thread;
   osStatus_t   status;
 
   // Check running thread
@@ -191,21 +322,20 @@ static osStatus_t svcRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
   }
 
   // Check if Mutex is not locked
-  if (mutex->lock == 0U) {
-    // Acquire Mutex
-    mutex->owner_thread = runnig_thread;
-    mutex->owner_next   = runnig_thread->mutex_list;
-    mutex->owner_prev   = NULL;
-    if (runnig_thread->mutex_list != NULL) {
-        runnig_thread->mutex_list->owner_prev = mutex;
+  owner_thread = MutexOwner(mutex);
+  if (owner_thread == NULL) {
+    // Acquire Mutex (Robust Mutex is released when owner Thread terminates)
+    if ((mutex->attr & osMutexRobust) != 0U) {
+      MutexOwnerLink(mutex, runnig_thread);
+    } else {
+      mutex->owner_thread = runnig_thread;
     }
-    runnig_thread->mutex_list = mutex;
     mutex->lock = 1U;
     EvrRtxMutexAcquired(mutex, mutex->lock);
     status = osOK;
   } else {
     // Check if Mutex is recursive and running Thread is the owner
-    if (((mutex->attr & osMutexRecursive) != 0U) && (mutex->owner_thread == runnig_thread)) {
+    if (((mutex->attr & osMutexRecursive) != 0U) && (owner_thread == runnig_thread)) {
       // Try to increment lock counter
       if (mutex->lock == osRtxMutexLockLimit) {
         EvrRtxMutexError(mutex, osRtxErrorMutexLockLimit);
@@ -218,12 +348,19 @@ static osStatus_t svcRtxMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
     } else {
       // Check if timeout is specified
       if (timeout != 0U) {
+        // Link Mutex acquired without Service Call to owner Thread
+        if (!MutexOwnerLinked(mutex)) {
+          // Owner Thread was preempted before setting or after clearing the Lock counter
+          if (mutex->lock == 0U) {
+            mutex->lock = 1U;
+          }
+          MutexOwnerLink(mutex, owner_thread);
+        }
         // Check if Priority inheritance protocol is enabled
         if ((mutex->attr & osMutexPrioInherit) != 0U) {
           // Raise priority of owner Thread if lower than priority of running Thread
-          if (mutex->owner_thread->priority < runnig_thread->priority) {
-            mutex->owner_thread->priority = runnig_thread->priority;
-            osRtxThreadListSort(mutex->owner_thread);
+          if (owner_thread->priority < runnig_thread->priority) {
+            osRtxThreadListSort(owner_thread, runnig_thread->priority);
           }
         }
         EvrRtxMutexAcquirePending(mutex, timeout);
@@ -269,14 +406,14 @@ static osStatus_t svcRtxMutexRelease (osMutexId_t mutex_id) {
   }
 
   // Check if Mutex is not locked
-  if (mutex->lock == 0U) {
+  if (MutexOwner(mutex) == NULL) {
     EvrRtxMutexError(mutex, osRtxErrorMutexNotLocked);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return osErrorResource;
   }
 
   // Check if running Thread is not the owner
-  if (mutex->owner_thread != runnig_thread) {
+  if (MutexOwner(mutex) != runnig_thread) {
     EvrRtxMutexError(mutex, osRtxErrorMutexNotOwned);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return osErrorResource;
@@ -290,14 +427,10 @@ static osStatus_t svcRtxMutexRelease (osMutexId_t mutex_id) {
   if (mutex->lock == 0U) {
 
     // Remove Mutex from Thread owner list
-    if (mutex->owner_next != NULL) {
-      mutex->owner_next->owner_prev = mutex->owner_prev;
-    }
-    if (mutex->owner_prev != NULL) {
-      mutex->owner_prev->owner_next = mutex->owner_next;
-    } else {
-      runnig_thread->mutex_list = mutex->owner_next;
+    if (MutexOwnerLinked(mutex)) {
+      MutexOwnerUnlink(mutex, runnig_thread);
     }
+    mutex->owner_thread = NULL;
 
     // Restore running Thread priority
     if ((mutex->attr & osMutexPrioInherit) != 0U) {
@@ -320,10 +453,7 @@ static osStatus_t svcRtxMutexRelease (osMutexId_t mutex_id) {
       thread = osRtxThreadListGet(osRtxObject(mutex));
       osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
       // Thread is the new Mutex owner
-      mutex->owner_thread = thread;
-      mutex->owner_next   = thread->mutex_list;
-      mutex->owner_prev   = NULL;
-      thread->mutex_list  = mutex;
+      MutexOwnerLink(mutex, thread);
       mutex->lock = 1U;
       EvrRtxMutexAcquired(mutex, 1U);
     }
@@ -337,7 +467,8 @@ static osStatus_t svcRtxMutexRelease (osMutexId_t mutex_id) {
 /// Get Thread which owns a Mutex object.
 /// \note API identical to osMutexGetOwner
 static osThreadId_t svcRtxMutexGetOwner (osMutexId_t mutex_id) {
-  os_mutex_t *mutex = osRtxMutexId(mutex_id);
+  os_mutex_t  *mutex = osRtxMutexId(mutex_id);
+  os_thread_t *owner_thread;
 
   // Check parameters
   if ((mutex == NULL) || (mutex->id != osRtxIdMutex)) {
@@ -347,15 +478,16 @@ static osThreadId_t svcRtxMutexGetOwner (osMutexId_t mutex_id) {
   }
 
   // Check if Mutex is not locked
-  if (mutex->lock == 0U) {
+  owner_thread = MutexOwner(mutex);
+  if (owner_thread == NULL) {
     EvrRtxMutexGetOwner(mutex, NULL);
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
     return NULL;
   }
 
-  EvrRtxMutexGetOwner(mutex, mutex->owner_thread);
+  EvrRtxMutexGetOwner(mutex, owner_thread);
 
-  return mutex->owner_thread;
+  return owner_thread;
 }
 
 /// Delete a Mutex object.
@@ -374,19 +506,11 @@ static osStatus_t svcRtxMutexDelete (osMutexId_t mutex_id) {
   }
 
   // Check if Mutex is locked
-  if (mutex->lock != 0U) {
-
-    thread = mutex->owner_thread;
+  thread = MutexOwner(mutex);
+  if ((thread != NULL) && MutexOwnerLinked(mutex)) {
 
     // Remove Mutex from Thread owner list
-    if (mutex->owner_next != NULL) {
-      mutex->owner_next->owner_prev = mutex->owner_prev;
-    }
-    if (mutex->owner_prev != NULL) {
-      mutex->owner_prev->owner_next = mutex->owner_next;
-    } else {
-      thread->mutex_list = mutex->owner_next;
-    }
+    MutexOwnerUnlink(mutex, thread);
 
     // Restore owner Thread priority
     if ((mutex->attr & osMutexPrioInherit) != 0U) {
@@ -401,8 +525,7 @@ static osStatus_t svcRtxMutexDelete (osMutexId_t mutex_id) {
         mutex0 = mutex0->owner_next;
       }
       if (thread->priority != priority) {
-        thread->priority = priority;
-        osRtxThreadListSort(thread);
+        osRtxThreadListSort(thread, priority);
       }
     }
 
@@ -417,6 +540,9 @@ static osStatus_t svcRtxMutexDelete (osMutexId_t mutex_id) {
     osRtxThreadDispatch(NULL);
   }
 
+  // Free wait list index
+  osRtxThreadListFree(osRtxObject(mutex));
+
   // Mark object as invalid
   mutex->id = osRtxIdInvalid;
 
@@ -485,6 +611,10 @@ osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
   if (IsIrqMode() || IsIrqMasked()) {
     EvrRtxMutexError(mutex_id, (int32_t)osErrorISR);
     status = osErrorISR;
+#if (EXCLUSIVE_ACCESS == 1)
+  } else if (MutexAcquireFast(osRtxMutexId(mutex_id))) {
+    status = osOK;
+#endif
   } else {
     status = __svcMutexAcquire(mutex_id, timeout);
   }
@@ -499,6 +629,10 @@ osStatus_t osMutexRelease (osMutexId_t mutex_id) {
   if (IsIrqMode() || IsIrqMasked()) {
     EvrRtxMutexError(mutex_id, (int32_t)osErrorISR);
     status = osErrorISR;
+#if (EXCLUSIVE_ACCESS == 1)
+  } else if (MutexReleaseFast(osRtxMutexId(mutex_id))) {
+    status = osOK;
+#endif
   } else {
     status = __svcMutexRelease(mutex_id);
   }
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2013-2018 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Ring Buffer functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtx_lib.h"
+
+
+//  Ring Buffer Indexes are free running modulo 2^24, so that the reserved Write
+//  Index and the number of active producers fit into one word (reserve).
+//  A producer reserves elements by advancing the reserved Write Index and
+//  incrementing the number of active producers. The last active producer to
+//  finish publishes all reserved elements by advancing the Write Index (head).
+//  Producers preempting each other never wait for each other.
+
+#define RING_INDEX_MASK         0x00FFFFFFU     // Index range
+#define RING_ELEM_MAX           0x00800000U     // Maximum number of Elements
+#define RING_ACTIVE_MASK        0x000000FFU     // Active producers in reserve
+
+
+//  ==== Helper functions ====
+
+/// Compare and Swap (32-bit).
+/// \param[in]  mem             memory address.
+/// \param[in]  old             expected value.
+/// \param[in]  val             new value.
+/// \return previous value (new value written when equal to expected value).
+static uint32_t RingBufferCas (uint32_t *mem, uint32_t old, uint32_t val) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t primask = __get_PRIMASK();
+  uint32_t ret;
+
+  __disable_irq();
+
+  ret = *mem;
+  if (ret == old) {
+    *mem = val;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return ret;
+#else
+  return atomic_cas32(mem, old, val);
+#endif
+}
+
+/// Copy Elements into Ring Buffer.
+/// \param[in]  rb              ring buffer object.
+/// \param[in]  index           write index.
+/// \param[in]  data            pointer to elements.
+/// \param[in]  count           number of elements.
+static void RingBufferWrite (const osRtxRingBuffer_t *rb, uint32_t index, const uint8_t *data, uint32_t count) {
+  uint32_t idx = index & rb->mask;
+  uint32_t cnt = (rb->mask + 1U) - idx;
+
+  if (cnt > count) {
+    cnt = count;
+  }
+  memcpy(&rb->buf[idx * rb->elem_size], data, cnt * rb->elem_size);
+  if (cnt < count) {
+    memcpy(rb->buf, &data[cnt * rb->elem_size], (count - cnt) * rb->elem_size);
+  }
+}
+
+/// Copy Elements from Ring Buffer.
+/// \param[in]  rb              ring buffer object.
+/// \param[in]  index           read index.
+/// \param[out] data            pointer to buffer for elements.
+/// \param[in]  count           number of elements.
+static void RingBufferRead (const osRtxRingBuffer_t *rb, uint32_t index, uint8_t *data, uint32_t count) {
+  uint32_t idx = index & rb->mask;
+  uint32_t cnt = (rb->mask + 1U) - idx;
+
+  if (cnt > count) {
+    cnt = count;
+  }
+  memcpy(data, &rb->buf[idx * rb->elem_size], cnt * rb->elem_size);
+  if (cnt < count) {
+    memcpy(&data[cnt * rb->elem_size], rb->buf, (count - cnt) * rb->elem_size);
+  }
+}
+
+/// Get number of free Elements in Ring Buffer.
+/// \param[in]  rb              ring buffer object.
+/// \param[in]  index           write index.
+/// \return number of free elements.
+static uint32_t RingBufferSpace (const osRtxRingBuffer_t *rb, uint32_t index) {
+  //lint -e{9079} -e{9087} "volatile read of index written by the consumer"
+  uint32_t tail = *((const volatile uint32_t *)&rb->tail);
+
+  return ((rb->mask + 1U) - ((index - tail) & RING_INDEX_MASK));
+}
+
+/// Publish written Elements and notify consumer when Ring Buffer was empty.
+/// \param[in]  rb              ring buffer object.
+/// \param[in]  index           new write index.
+static void RingBufferPublish (osRtxRingBuffer_t *rb, uint32_t index) {
+  uint32_t head, dist;
+
+  // Data must be visible before the Write Index
+  __DMB();
+
+  if ((rb->flags & osRtxRingBufferMultiProducer) == 0U) {
+    head = rb->head;
+    //lint -e{9079} -e{9087} "volatile write of index read by the consumer"
+    *((volatile uint32_t *)&rb->head) = index;
+  } else {
+    // Advance Write Index unless a preempting producer already advanced it further
+    do {
+      //lint -e{9079} -e{9087} "volatile read of index written by other producers"
+      head = *((volatile uint32_t *)&rb->head);
+      dist = (index - head) & RING_INDEX_MASK;
+      if ((dist == 0U) || (dist > (rb->mask + 1U))) {
+        //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+        return;
+      }
+    } while (RingBufferCas(&rb->head, head, index) != head);
+  }
+
+  __DMB();
+
+  // Ring Buffer was empty when consumer has already read up to the previous Write Index
+  //lint -e{9079} -e{9087} "volatile read of index written by the consumer"
+  if ((rb->thread != NULL) && (*((volatile uint32_t *)&rb->tail) == head)) {
+    (void)osThreadFlagsSet(rb->thread, rb->thread_flags);
+  }
+}
+
+
+//  ==== Public API ====
+
+/// Initialize a Ring Buffer.
+osStatus_t osRtxRingBufferInit (osRtxRingBuffer_t *rb, void *buf, uint32_t elem_count, uint32_t elem_size, uint32_t flags) {
+
+  // Check parameters
+  if ((rb == NULL) || (buf == NULL) || (elem_size == 0U) ||
+      (elem_count == 0U) || (elem_count > RING_ELEM_MAX) || ((elem_count & (elem_count - 1U)) != 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  rb->head         = 0U;
+  rb->reserve      = 0U;
+  rb->tail         = 0U;
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  rb->buf          = buf;
+  rb->mask         = elem_count - 1U;
+  rb->elem_size    = elem_size;
+  rb->flags        = flags;
+  rb->thread       = NULL;
+  rb->thread_flags = 0U;
+
+  return osOK;
+}
+
+/// Set the Thread notified when a Ring Buffer becomes not empty.
+void osRtxRingBufferNotify (osRtxRingBuffer_t *rb, osThreadId_t thread_id, uint32_t thread_flags) {
+
+  rb->thread_flags = thread_flags;
+  rb->thread       = thread_id;
+}
+
+/// Put Elements into a Ring Buffer.
+uint32_t osRtxRingBufferPush (osRtxRingBuffer_t *rb, const void *data, uint32_t count) {
+  uint32_t reserve, index, space;
+
+  if ((rb->flags & osRtxRingBufferMultiProducer) == 0U) {
+    index = rb->head;
+    space = RingBufferSpace(rb, index);
+    if (count > space) {
+      count = space;
+    }
+    if (count != 0U) {
+      //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+      RingBufferWrite(rb, index, data, count);
+      RingBufferPublish(rb, (index + count) & RING_INDEX_MASK);
+    }
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return count;
+  }
+
+  // Reserve Elements
+  do {
+    //lint -e{9079} -e{9087} "volatile read of state written by other producers"
+    reserve = *((volatile uint32_t *)&rb->reserve);
+    index   = reserve >> 8;
+    space   = RingBufferSpace(rb, index);
+    if (count > space) {
+      count = space;
+    }
+    if ((count == 0U) || ((reserve & RING_ACTIVE_MASK) == RING_ACTIVE_MASK)) {
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return 0U;
+    }
+  } while (RingBufferCas(&rb->reserve, reserve,
+                         ((((index + count) & RING_INDEX_MASK) << 8) | ((reserve & RING_ACTIVE_MASK) + 1U))) != reserve);
+
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  RingBufferWrite(rb, index, data, count);
+
+  // Release reservation and publish all Elements when last active producer
+  do {
+    //lint -e{9079} -e{9087} "volatile read of state written by other producers"
+    reserve = *((volatile uint32_t *)&rb->reserve);
+  } while (RingBufferCas(&rb->reserve, reserve, reserve - 1U) != reserve);
+  if ((reserve & RING_ACTIVE_MASK) == 1U) {
+    RingBufferPublish(rb, reserve >> 8);
+  }
+
+  return count;
+}
+
+/// Get Elements from a Ring Buffer.
+uint32_t osRtxRingBufferPop (osRtxRingBuffer_t *rb, void *data, uint32_t count) {
+  uint32_t head, tail, avail;
+
+  //lint -e{9079} -e{9087} "volatile read of index written by producers"
+  head  = *((volatile uint32_t *)&rb->head);
+  tail  = rb->tail;
+  avail = (head - tail) & RING_INDEX_MASK;
+  if (count > avail) {
+    count = avail;
+  }
+
+  if (count != 0U) {
+    // Data is read after the Write Index
+    __DMB();
+    //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+    RingBufferRead(rb, tail, data, count);
+    // Data is read before the elements are freed
+    __DMB();
+    //lint -e{9079} -e{9087} "volatile write of index read by producers"
+    *((volatile uint32_t *)&rb->tail) = (tail + count) & RING_INDEX_MASK;
+  }
+
+  return count;
+}
+
+/// Get number of Elements in a Ring Buffer.
+uint32_t osRtxRingBufferGetCount (const osRtxRingBuffer_t *rb) {
+  //lint -e{9079} -e{9087} "volatile read of indexes written by producers and consumer"
+  uint32_t head = *((const volatile uint32_t *)&rb->head);
+  uint32_t tail = *((const volatile uint32_t *)&rb->tail);
+
+  return ((head - tail) & RING_INDEX_MASK);
+}
@@ -102,6 +102,38 @@ static uint32_t SemaphoreTokenIncrement (os_semaphore_t *semaphore) {
   return ret;
 }
 
+#if (EXCLUSIVE_ACCESS == 1)
+/// Acquire a Semaphore token without Service Call.
+/// \param[in]  semaphore       semaphore object.
+/// \return true - acquired, false - Service Call required.
+static bool_t SemaphoreAcquireFast (os_semaphore_t *semaphore) {
+
+  if ((semaphore == NULL) || (semaphore->id != osRtxIdSemaphore) ||
+      (SemaphoreTokenDecrement(semaphore) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  EvrRtxSemaphoreAcquired(semaphore, semaphore->tokens);
+
+  return TRUE;
+}
+
+/// Release a Semaphore token without Service Call when no Thread is waiting.
+/// \param[in]  semaphore       semaphore object.
+/// \return true - released, false - Service Call required.
+static bool_t SemaphoreReleaseFast (os_semaphore_t *semaphore) {
+
+  if ((semaphore == NULL) || (semaphore->id != osRtxIdSemaphore) ||
+      (semaphore->thread_list != NULL) || (SemaphoreTokenIncrement(semaphore) == 0U)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return FALSE;
+  }
+  EvrRtxSemaphoreReleased(semaphore, semaphore->tokens);
+
+  return TRUE;
+}
+#endif
+
 
 //  ==== Post ISR processing ====
 
@@ -193,6 +225,7 @@ static osSemaphoreId_t svcRtxSemaphoreNew (uint32_t max_count, uint32_t initial_
     semaphore->flags       = flags;
     semaphore->name        = name;
     semaphore->thread_list = NULL;
+    semaphore->wait_index  = NULL;
     semaphore->tokens      = (uint16_t)initial_count;
     semaphore->max_tokens  = (uint16_t)max_count;
 
@@ -336,6 +369,9 @@ static osStatus_t svcRtxSemaphoreDelete (osSemaphoreId_t semaphore_id) {
     osRtxThreadDispatch(NULL);
   }
 
+  // Free wait list index
+  osRtxThreadListFree(osRtxObject(semaphore));
+
   // Mark object as invalid
   semaphore->id = osRtxIdInvalid;
 
@@ -356,6 +392,30 @@ static osStatus_t svcRtxSemaphoreDelete (osSemaphoreId_t semaphore_id) {
   return osOK;
 }
 
+/// Pass Semaphore tokens released without Service Call to waiting Threads.
+/// \param[in]  semaphore_id    semaphore ID obtained by \ref osSemaphoreNew.
+static void svcRtxSemaphoreDispatch (osSemaphoreId_t semaphore_id) {
+  os_semaphore_t *semaphore = osRtxSemaphoreId(semaphore_id);
+  os_thread_t    *thread;
+
+  // Check parameters
+  if ((semaphore == NULL) || (semaphore->id != osRtxIdSemaphore)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
+  // Check if Thread is waiting for a token
+  if (semaphore->thread_list != NULL) {
+    // Wakeup waiting Threads with highest Priority while tokens are available
+    while ((semaphore->thread_list != NULL) && (SemaphoreTokenDecrement(semaphore) != 0U)) {
+      thread = osRtxThreadListGet(osRtxObject(semaphore));
+      osRtxThreadWaitExit(thread, (uint32_t)osOK, FALSE);
+      EvrRtxSemaphoreAcquired(semaphore, semaphore->tokens);
+    }
+    osRtxThreadDispatch(NULL);
+  }
+}
+
 //  Service Calls definitions
 //lint ++flb "Library Begin" [MISRA Note 11]
 SVC0_3(SemaphoreNew,      osSemaphoreId_t, uint32_t, uint32_t, const osSemaphoreAttr_t *)
@@ -364,6 +424,7 @@ SVC0_2(SemaphoreAcquire,  osStatus_t,      osSemaphoreId_t, uint32_t)
 SVC0_1(SemaphoreRelease,  osStatus_t,      osSemaphoreId_t)
 SVC0_1(SemaphoreGetCount, uint32_t,        osSemaphoreId_t)
 SVC0_1(SemaphoreDelete,   osStatus_t,      osSemaphoreId_t)
+SVC0_1N(SemaphoreDispatch, void,            osSemaphoreId_t)
 //lint --flb "Library End"
 
 
@@ -461,6 +522,10 @@ osStatus_t osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout) {
   EvrRtxSemaphoreAcquire(semaphore_id, timeout);
   if (IsIrqMode() || IsIrqMasked()) {
     status = isrRtxSemaphoreAcquire(semaphore_id, timeout);
+#if (EXCLUSIVE_ACCESS == 1)
+  } else if (SemaphoreAcquireFast(osRtxSemaphoreId(semaphore_id))) {
+    status = osOK;
+#endif
   } else {
     status =  __svcSemaphoreAcquire(semaphore_id, timeout);
   }
@@ -474,6 +539,15 @@ osStatus_t osSemaphoreRelease (osSemaphoreId_t semaphore_id) {
   EvrRtxSemaphoreRelease(semaphore_id);
   if (IsIrqMode() || IsIrqMasked()) {
     status = isrRtxSemaphoreRelease(semaphore_id);
+#if (EXCLUSIVE_ACCESS == 1)
+  } else if (SemaphoreReleaseFast(osRtxSemaphoreId(semaphore_id))) {
+    // Thread started waiting before the token was released
+    //lint -e{9079} -e{9087} "volatile read of list changed by the kernel"
+    if (*((os_thread_t * volatile *)&osRtxSemaphoreId(semaphore_id)->thread_list) != NULL) {
+      __svcSemaphoreDispatch(semaphore_id);
+    }
+    status = osOK;
+#endif
   } else {
     status =  __svcSemaphoreRelease(semaphore_id);
   }
@@ -124,6 +124,13 @@ void osRtxTick_Handler (void) {
   os_thread_t *thread;
 
   OS_Tick_AcknowledgeIRQ();
+
+  // Tick is disabled while the Kernel is suspended (tick taken before it was disabled)
+  if (osRtxInfo.kernel.state == osRtxKernelSuspended) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return;
+  }
+
   osRtxInfo.kernel.tick++;
 
   // Process Timers
@@ -215,3 +222,118 @@ void osRtxPostProcess (os_object_t *object) {
     (void)osRtxErrorNotify(osRtxErrorISRQueueOverflow, object);
   }
 }
+
+
+//  ==== Timing Wheel functions ====
+
+// Each Level of a Timing Wheel resolves 5 bits of time. An entry is kept on
+// the Level of the highest 5-bit digit in which its expiry Time differs from
+// the Wheel Time, in the Slot given by that digit of the expiry Time. When
+// the Wheel Time reaches the start of a higher Level Slot its entries are
+// cascaded to lower Levels, entries in the current Level 0 Slot expire.
+// Entries beyond the range of the top Level are cascaded again on wrap.
+// An expiry Time which wrapped below the Wheel Time can land in a passed
+// Slot and be taken before it is due; such entries are linked again.
+
+/// Get Timing Wheel Slot for specified expiry Time.
+/// \param[in]  wheel           timing wheel.
+/// \param[in]  time            expiry time.
+/// \return slot index.
+uint32_t osRtxWheelSlot (const os_wheel_t *wheel, uint32_t time) {
+  uint32_t diff, level;
+
+  diff  = time ^ wheel->time;
+  level = 0U;
+  if (diff != 0U) {
+    level = (31U - (uint32_t)__CLZ(diff)) / 5U;
+    if (level >= osRtxWheelLevels) {
+      level = osRtxWheelLevels - 1U;
+    }
+  }
+
+  return ((level * osRtxWheelSlots) + ((time >> (level * 5U)) & (osRtxWheelSlots - 1U)));
+}
+
+/// Mark Timing Wheel Slot as used.
+/// \param[in]  wheel           timing wheel.
+/// \param[in]  slot            slot index.
+void osRtxWheelMark (os_wheel_t *wheel, uint32_t slot) {
+  wheel->map[slot / osRtxWheelSlots] |= 1U << (slot % osRtxWheelSlots);
+}
+
+/// Take all entries from a Timing Wheel Slot.
+/// \param[in]  wheel           timing wheel.
+/// \param[in]  slot            slot index.
+/// \return first entry of the Slot list or NULL.
+void *osRtxWheelTake (os_wheel_t *wheel, uint32_t slot) {
+  void *list;
+
+  list = wheel->slot[slot];
+  wheel->slot[slot] = NULL;
+  wheel->map[slot / osRtxWheelSlots] &= ~(1U << (slot % osRtxWheelSlots));
+
+  return list;
+}
+
+/// Get highest Timing Wheel Level whose Slot starts at the Wheel Time.
+/// \param[in]  wheel           timing wheel.
+/// \return level to cascade from (0 when no cascade is needed).
+uint32_t osRtxWheelCascade (const os_wheel_t *wheel) {
+  uint32_t level;
+
+  level = 0U;
+  while ((level < (osRtxWheelLevels - 1U)) &&
+         ((wheel->time & ((1U << ((level + 1U) * 5U)) - 1U)) == 0U)) {
+    level++;
+  }
+
+  return level;
+}
+
+/// Get number of Ticks until the next Timing Wheel event (expiry or cascade).
+/// \param[in]  wheel           timing wheel.
+/// \return number of ticks or osWaitForever when the Wheel is empty.
+uint32_t osRtxWheelNext (const os_wheel_t *wheel) {
+  uint32_t level, digit, map, n, ticks;
+  uint32_t next = osWaitForever;
+
+  for (level = 0U; level < osRtxWheelLevels; level++) {
+    map = wheel->map[level];
+    if (map != 0U) {
+      // Rotate the Slot following the current one to bit 0
+      digit = (wheel->time >> (level * 5U)) & (osRtxWheelSlots - 1U);
+      n     = (digit + 1U) & (osRtxWheelSlots - 1U);
+      if (n != 0U) {
+        map = (map >> n) | (map << (32U - n));
+      }
+      // Distance to the first used Slot
+      n     = 31U - (uint32_t)__CLZ(map & (0U - map));
+      ticks = ((n + 1U) << (level * 5U)) - (wheel->time & ((1U << (level * 5U)) - 1U));
+      if (ticks < next) {
+        next = ticks;
+      }
+    }
+  }
+
+  return next;
+}
+
+/// Advance Timing Wheel by specified number of Ticks.
+/// \param[in]  wheel           timing wheel.
+/// \param[in]  ticks           number of ticks.
+/// \param[in]  tick            function processing one tick of the Wheel.
+void osRtxWheelAdvance (os_wheel_t *wheel, uint32_t ticks, void (*tick)(void)) {
+  uint32_t next;
+
+  while (ticks != 0U) {
+    next = osRtxWheelNext(wheel);
+    if (next > ticks) {
+      wheel->time += ticks;
+      break;
+    }
+    // Skip Ticks without events and process the next event
+    wheel->time += next - 1U;
+    ticks       -= next;
+    tick();
+  }
+}
@@ -133,15 +133,174 @@ static uint32_t ThreadFlagsCheck (os_thread_t *thread, uint32_t flags, uint32_t
   return thread_flags;
 }
 
+#ifdef RTX_THREAD_STATS
+
+/// Record Thread Wake-up for latency statistics.
+/// \param[in]  thread          thread object.
+static void ThreadStatsWakeup (os_thread_t *thread) {
+  thread->stats.timestamp = osRtxKernelGetSysTimerCount();
+  thread->stats.wakeup    = 1U;
+}
+
+/// Account Run Time of the switched out Thread and Latency of the switched in Thread.
+/// \param[in]  thread_prev     thread object switched out or NULL.
+/// \param[in]  thread          thread object switched in.
+static void ThreadStatsSwitch (os_thread_t *thread_prev, os_thread_t *thread) {
+  uint32_t time;
+  uint32_t delta;
+  uint32_t bin;
+
+  time = osRtxKernelGetSysTimerCount();
+
+  if (thread_prev != NULL) {
+    delta = time - thread_prev->stats.timestamp;
+    thread_prev->stats.run_time += delta;
+    if (thread_prev->stats.run_time < delta) {
+      thread_prev->stats.run_time_hi++;
+    }
+  }
+
+  if (thread->stats.wakeup != 0U) {
+    thread->stats.wakeup = 0U;
+    delta = time - thread->stats.timestamp;
+    if (thread->stats.latency_max < delta) {
+      thread->stats.latency_max = delta;
+    }
+    // Histogram bins are powers of 4
+    bin = delta >> osRtxThreadStatsShift;
+    if (bin != 0U) {
+      bin = (33U - (uint32_t)__CLZ(bin)) >> 1;
+      if (bin >= osRtxThreadStatsBins) {
+        bin = osRtxThreadStatsBins - 1U;
+      }
+    }
+    thread->stats.latency[bin]++;
+  }
+
+  thread->stats.switches++;
+  thread->stats.timestamp = time;
+}
+
+#endif
+
 
 //  ==== Library functions ====
 
+/// Get the last Thread in Ready list with Priority higher or equal to specified Priority.
+/// \param[in]  priority        thread priority.
+/// \return thread object or Ready list object when no such Thread.
+static os_thread_t *osRtxThreadReadyLast (uint32_t priority) {
+  uint32_t n, map;
+
+  for (n = priority >> 5; n < 2U; n++) {
+    map = osRtxInfo.ready_index.map[n];
+    if (n == (priority >> 5)) {
+      map &= 0xFFFFFFFFU >> (priority & 0x1FU);
+    }
+    if (map != 0U) {
+      // Lowest used Priority level in range is the highest set bit
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return osRtxInfo.ready_index.tail[(n << 5) + __CLZ(map)];
+    }
+  }
+
+  return osRtxThreadObject(&osRtxInfo.thread.ready);
+}
+
+/// Register a Thread as last Thread of its Priority level in Ready list.
+/// \param[in]  thread          thread object.
+static void osRtxThreadReadyIndexSet (os_thread_t *thread) {
+  uint32_t priority = (uint32_t)thread->priority;
+
+  osRtxInfo.ready_index.tail[priority]     = thread;
+  osRtxInfo.ready_index.map[priority >> 5] |= 0x80000000U >> (priority & 0x1FU);
+}
+
+/// Unregister a Thread from Ready list index before it is removed from the list.
+/// \param[in]  thread          thread object.
+static void osRtxThreadReadyIndexClr (const os_thread_t *thread) {
+  os_thread_t *prev;
+  uint32_t     priority = (uint32_t)thread->priority;
+
+  if (osRtxInfo.ready_index.tail[priority] == thread) {
+    prev = thread->thread_prev;
+    if ((prev->id == osRtxIdThread) && (prev->priority == thread->priority)) {
+      osRtxInfo.ready_index.tail[priority] = prev;
+    } else {
+      osRtxInfo.ready_index.tail[priority] = NULL;
+      osRtxInfo.ready_index.map[priority >> 5] &= ~(0x80000000U >> (priority & 0x1FU));
+    }
+  }
+}
+
+/// Get the Wait List Priority level of a Thread.
+/// \param[in]  priority        thread priority.
+/// \return priority level (priorities up to Normal and from Realtime7 share the first and last level).
+static uint32_t osRtxThreadWaitLevel (int8_t priority) {
+  int32_t level = (int32_t)priority - (int32_t)osPriorityNormal;
+
+  if (level < 0) {
+    level = 0;
+  } else if (level > 31) {
+    level = 31;
+  } else {
+    // Priority has its own level
+  }
+
+  return (uint32_t)level;
+}
+
+/// Allocate and build the Wait List Priority Index of an Object.
+/// \param[in]  object          waitable object.
+/// \return index or NULL when no memory is available.
+static os_wait_index_t *osRtxThreadWaitIndexNew (os_wait_object_t *object) {
+  os_wait_index_t *index;
+  os_thread_t     *thread;
+  uint32_t         level;
+
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  index = osRtxMemoryAlloc(osRtxInfo.mem.common, sizeof(os_wait_index_t), 0U);
+  if (index != NULL) {
+    index->map = 0U;
+    // List is sorted: the last Thread seen on each level is its tail
+    for (thread = object->thread_list; thread != NULL; thread = thread->thread_next) {
+      level = osRtxThreadWaitLevel(thread->priority);
+      index->tail[level] = thread;
+      index->map |= 0x80000000U >> level;
+    }
+    object->wait_index = index;
+  }
+
+  return index;
+}
+
+/// Unregister a Thread from Wait List index before it is removed from the list.
+/// \param[in]  index           wait list index.
+/// \param[in]  thread          thread object.
+static void osRtxThreadWaitIndexClr (os_wait_index_t *index, const os_thread_t *thread) {
+  os_thread_t *prev;
+  uint32_t     level = osRtxThreadWaitLevel(thread->priority);
+
+  if (index->tail[level] == thread) {
+    prev = thread->thread_prev;
+    if ((prev->id == osRtxIdThread) && (osRtxThreadWaitLevel(prev->priority) == level)) {
+      index->tail[level] = prev;
+    } else {
+      index->tail[level] = NULL;
+      index->map &= ~(0x80000000U >> level);
+    }
+  }
+}
+
 /// Put a Thread into specified Object list sorted by Priority (Highest at Head).
 /// \param[in]  object          generic object.
 /// \param[in]  thread          thread object.
 void osRtxThreadListPut (os_object_t *object, os_thread_t *thread) {
-  os_thread_t *prev, *next;
-  int32_t      priority;
+  os_wait_object_t *wait;
+  os_wait_index_t  *index;
+  os_thread_t      *prev, *next;
+  int32_t           priority;
+  uint32_t          level, map;
 
   if (thread == NULL) {
     //lint -e{904} "Return statement before end of function" [MISRA Note 1]
@@ -150,11 +309,46 @@ void osRtxThreadListPut (os_object_t *object, os_thread_t *thread) {
 
   priority = thread->priority;
 
-  prev = osRtxThreadObject(object);
-  next = prev->thread_next;
-  while ((next != NULL) && (next->priority >= priority)) {
-    prev = next;
-    next = next->thread_next;
+  if (object == &osRtxInfo.thread.ready) {
+    // Ready list: insert behind the last Thread of the same or higher Priority
+    prev = osRtxThreadReadyLast((uint32_t)priority);
+    next = prev->thread_next;
+    osRtxThreadReadyIndexSet(thread);
+  } else {
+    // Wait list: index it once a second Thread is waiting
+    wait  = osRtxWaitObject(object);
+    index = wait->wait_index;
+    if ((index == NULL) && (wait->thread_list != NULL)) {
+      index = osRtxThreadWaitIndexNew(wait);
+    }
+    if (index != NULL) {
+      // Insert behind the last Thread of the lowest used Priority level at or above the Thread level
+      level = osRtxThreadWaitLevel(thread->priority);
+      map   = index->map & (0xFFFFFFFFU >> level);
+      if (map != 0U) {
+        prev = index->tail[__CLZ(map)];
+        // First and last level hold several priorities: keep them sorted
+        while ((prev->id == osRtxIdThread) && (prev->priority < priority)) {
+          prev = prev->thread_prev;
+        }
+      } else {
+        prev = osRtxThreadObject(object);
+      }
+      next = prev->thread_next;
+      // Register Thread as last Thread of its Priority level
+      if (((index->map & (0x80000000U >> level)) == 0U) || (index->tail[level] == prev)) {
+        index->tail[level] = thread;
+        index->map |= 0x80000000U >> level;
+      }
+    } else {
+      // No index (single waiter or no memory): walk the list
+      prev = osRtxThreadObject(object);
+      next = prev->thread_next;
+      while ((next != NULL) && (next->priority >= priority)) {
+        prev = next;
+        next = next->thread_next;
+      }
+    }
   }
   thread->thread_prev = prev;
   thread->thread_next = next;
@@ -168,10 +362,19 @@ void osRtxThreadListPut (os_object_t *object, os_thread_t *thread) {
 /// \param[in]  object          generic object.
 /// \return thread object. 
 os_thread_t *osRtxThreadListGet (os_object_t *object) {
-  os_thread_t *thread;
+  os_wait_index_t *index;
+  os_thread_t     *thread;
 
   thread = object->thread_list;
   if (thread != NULL) {
+    if (object == &osRtxInfo.thread.ready) {
+      osRtxThreadReadyIndexClr(thread);
+    } else {
+      index = osRtxWaitObject(object)->wait_index;
+      if (index != NULL) {
+        osRtxThreadWaitIndexClr(index, thread);
+      }
+    }
     object->thread_list = thread->thread_next;
     if (thread->thread_next != NULL) {
       thread->thread_next->thread_prev = osRtxThreadObject(object);
@@ -182,14 +385,6 @@ os_thread_t *osRtxThreadListGet (os_object_t *object) {
   return thread;
 }
 
-#if (!defined(EVR_RTX_DISABLE) && \
-    (((OS_EVR_EVFLAGS   != 0) && !defined(EVR_RTX_EVENT_FLAGS_WAIT_TIMEOUT_DISABLE))  || \
-     ((OS_EVR_MUTEX     != 0) && !defined(EVR_RTX_MUTEX_ACQUIRE_TIMEOUT_DISABLE))     || \
-     ((OS_EVR_SEMAPHORE != 0) && !defined(EVR_RTX_SEMAPHORE_ACQUIRE_TIMEOUT_DISABLE)) || \
-     ((OS_EVR_MEMPOOL   != 0) && !defined(EVR_RTX_MEMORY_POOL_ALLOC_TIMEOUT_DISABLE)) || \
-     ((OS_EVR_MSGQUEUE  != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_GET_TIMEOUT_DISABLE)) || \
-     ((OS_EVR_MSGQUEUE  != 0) && !defined(EVR_RTX_MESSAGE_QUEUE_PUT_TIMEOUT_DISABLE))))
-
 /// Retrieve Thread list root.
 /// \param[in]  thread          thread object.
 static void *osRtxThreadListRoot (os_thread_t *thread) {
@@ -202,32 +397,56 @@ static void *osRtxThreadListRoot (os_thread_t *thread) {
   return thread0;
 }
 
-#endif
-
-/// Re-sort a Thread in linked Object list by Priority (Highest at Head).
+/// Change Thread Priority and re-sort it in linked Object list (Highest at Head).
 /// \param[in]  thread          thread object.
-void osRtxThreadListSort (os_thread_t *thread) {
+/// \param[in]  priority        new thread priority.
+void osRtxThreadListSort (os_thread_t *thread, int8_t priority) {
   os_object_t *object;
   os_thread_t *thread0;
 
   // Search for object
-  thread0 = thread;
-  while ((thread0 != NULL) && (thread0->id == osRtxIdThread)) {
-    thread0 = thread0->thread_prev;
+  if (thread->state == osRtxThreadReady) {
+    object = &osRtxInfo.thread.ready;
+  } else {
+    thread0 = thread;
+    while ((thread0 != NULL) && (thread0->id == osRtxIdThread)) {
+      thread0 = thread0->thread_prev;
+    }
+    object = osRtxObject(thread0);
   }
-  object = osRtxObject(thread0);
 
   if (object != NULL) {
     osRtxThreadListRemove(thread);
+    thread->priority = priority;
     osRtxThreadListPut(object, thread);
+  } else {
+    thread->priority = priority;
   }
 }
 
 /// Remove a Thread from linked Object list.
 /// \param[in]  thread          thread object.
 void osRtxThreadListRemove (os_thread_t *thread) {
+  os_object_t     *object;
+  os_wait_index_t *index;
+  os_thread_t     *next;
 
   if (thread->thread_prev != NULL) {
+    osRtxThreadReadyIndexClr(thread);
+    if (thread->state != osRtxThreadReady) {
+      // Only the last Thread of a Priority level is indexed: search for object then
+      next = thread->thread_next;
+      if ((next == NULL) ||
+          (osRtxThreadWaitLevel(next->priority) != osRtxThreadWaitLevel(thread->priority))) {
+        object = osRtxObject(osRtxThreadListRoot(thread));
+        if (object != &osRtxInfo.thread.ready) {
+          index = osRtxWaitObject(object)->wait_index;
+          if (index != NULL) {
+            osRtxThreadWaitIndexClr(index, thread);
+          }
+        }
+      }
+    }
     thread->thread_prev->thread_next = thread->thread_next;
     if (thread->thread_next != NULL) {
       thread->thread_next->thread_prev = thread->thread_prev;
@@ -236,6 +455,17 @@ void osRtxThreadListRemove (os_thread_t *thread) {
   }
 }
 
+/// Free the Wait List index of an Object that is deleted.
+/// \param[in]  object          waitable object.
+void osRtxThreadListFree (os_object_t *object) {
+  os_wait_object_t *wait = osRtxWaitObject(object);
+
+  if (wait->wait_index != NULL) {
+    (void)osRtxMemoryFree(osRtxInfo.mem.common, wait->wait_index);
+    wait->wait_index = NULL;
+  }
+}
+
 /// Unlink a Thread from specified linked list.
 /// \param[in]  thread          thread object.
 static void osRtxThreadListUnlink (os_thread_t **thread_list, os_thread_t *thread) {
@@ -259,96 +489,106 @@ void osRtxThreadReadyPut (os_thread_t *thread) {
   osRtxThreadListPut(&osRtxInfo.thread.ready, thread);
 }
 
-/// Insert a Thread into the Delay list sorted by Delay (Lowest at Head).
+/// Link a Thread into the Delay Timing Wheel Slot of its expiry Time.
+/// \param[in]  thread          thread object.
+static void osRtxThreadDelayLink (os_thread_t *thread) {
+  os_thread_t *next;
+  uint32_t     slot;
+
+  slot = osRtxWheelSlot(&osRtxInfo.delay_wheel, thread->delay);
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  next = osRtxInfo.delay_wheel.slot[slot];
+  thread->delay_prev = NULL;
+  thread->delay_next = next;
+  if (next != NULL) {
+    next->delay_prev = thread;
+  } else {
+    osRtxWheelMark(&osRtxInfo.delay_wheel, slot);
+  }
+  osRtxInfo.delay_wheel.slot[slot] = thread;
+}
+
+/// Insert a Thread into the Delay Timing Wheel or the Wait list.
 /// \param[in]  thread          thread object.
 /// \param[in]  delay           delay value.
 static void osRtxThreadDelayInsert (os_thread_t *thread, uint32_t delay) {
-  os_thread_t *prev, *next;
+  os_thread_t *next;
 
   if (delay == osWaitForever) {
-    prev = NULL;
     next = osRtxInfo.thread.wait_list;
-    while (next != NULL)  {
-      prev = next;
-      next = next->delay_next;
-    }
     thread->delay = delay;
-    thread->delay_prev = prev;
-    thread->delay_next = NULL;
-    if (prev != NULL) {
-      prev->delay_next = thread;
-    } else {
-      osRtxInfo.thread.wait_list = thread;
-    }
-  } else {
-    prev = NULL;
-    next = osRtxInfo.thread.delay_list;
-    while ((next != NULL) && (next->delay <= delay)) {
-      delay -= next->delay;
-      prev = next;
-      next = next->delay_next;
-    }
-    thread->delay = delay;
-    thread->delay_prev = prev;
+    thread->delay_prev = NULL;
     thread->delay_next = next;
-    if (prev != NULL) {
-      prev->delay_next = thread;
-    } else {
-      osRtxInfo.thread.delay_list = thread;
-    }
     if (next != NULL) {
-      next->delay -= delay;
       next->delay_prev = thread;
     }
+    osRtxInfo.thread.wait_list = thread;
+  } else {
+    // Delay is kept as absolute expiry Time of the Wheel
+    thread->delay = osRtxInfo.delay_wheel.time + delay;
+    osRtxThreadDelayLink(thread);
   }
 }
 
-/// Remove a Thread from the Delay list.
+/// Remove a Thread from the Delay Timing Wheel or the Wait list.
 /// \param[in]  thread          thread object.
 static void osRtxThreadDelayRemove (os_thread_t *thread) {
+  uint32_t slot;
 
-  if (thread->delay == osWaitForever) {
-    if ((thread->delay_prev != NULL) || (osRtxInfo.thread.wait_list == thread)) {
-      if (thread->delay_next != NULL) {
-        thread->delay_next->delay_prev = thread->delay_prev;
-      }
-      if (thread->delay_prev != NULL) {
-        thread->delay_prev->delay_next = thread->delay_next;
-        thread->delay_prev = NULL;
-      } else {
-        osRtxInfo.thread.wait_list = thread->delay_next;
-      }
-    }
+  if (thread->delay_prev != NULL) {
+    thread->delay_prev->delay_next = thread->delay_next;
+    thread->delay_prev = NULL;
+  } else if (osRtxInfo.thread.wait_list == thread) {
+    osRtxInfo.thread.wait_list = thread->delay_next;
   } else {
-    if ((thread->delay_prev != NULL) || (osRtxInfo.thread.delay_list == thread)) {
-      if (thread->delay_next != NULL) {
-        thread->delay_next->delay += thread->delay;
-        thread->delay_next->delay_prev = thread->delay_prev;
-      }
-      if (thread->delay_prev != NULL) {
-        thread->delay_prev->delay_next = thread->delay_next;
-        thread->delay_prev = NULL;
-      } else {
-        osRtxInfo.thread.delay_list = thread->delay_next;
-      }
+    slot = osRtxWheelSlot(&osRtxInfo.delay_wheel, thread->delay);
+    if (osRtxInfo.delay_wheel.slot[slot] != thread) {
+      // Thread is not delayed
+      //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+      return;
+    }
+    osRtxInfo.delay_wheel.slot[slot] = thread->delay_next;
+    if (thread->delay_next == NULL) {
+      (void)osRtxWheelTake(&osRtxInfo.delay_wheel, slot);
     }
   }
+  if (thread->delay_next != NULL) {
+    thread->delay_next->delay_prev = thread->delay_prev;
+  }
 }
 
 /// Process Thread Delay Tick (executed each System Tick).
 void osRtxThreadDelayTick (void) {
-  os_thread_t *thread;
-
-  thread = osRtxInfo.thread.delay_list;
-  if (thread == NULL) {
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return;
+  os_thread_t *thread, *next;
+  uint32_t     level, slot;
+
+  osRtxInfo.delay_wheel.time++;
+
+  // Cascade Threads from higher Levels
+  for (level = osRtxWheelCascade(&osRtxInfo.delay_wheel); level != 0U; level--) {
+    slot   = (level * osRtxWheelSlots) +
+             ((osRtxInfo.delay_wheel.time >> (level * 5U)) & (osRtxWheelSlots - 1U));
+    //lint -e{9079} "conversion from pointer to void to pointer to other type"
+    thread = osRtxWheelTake(&osRtxInfo.delay_wheel, slot);
+    while (thread != NULL) {
+      next = thread->delay_next;
+      osRtxThreadDelayLink(thread);
+      thread = next;
+    }
   }
 
-  thread->delay--;
-
-  if (thread->delay == 0U) {
-    do {
+  // Wake up Threads which expire now
+  slot   = osRtxInfo.delay_wheel.time & (osRtxWheelSlots - 1U);
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  thread = osRtxWheelTake(&osRtxInfo.delay_wheel, slot);
+  while (thread != NULL) {
+    next = thread->delay_next;
+    if (thread->delay != osRtxInfo.delay_wheel.time) {
+      // Expiry Time wrapped into a passed Slot (delay close to 2^32), link it again
+      osRtxThreadDelayLink(thread);
+    } else {
+      thread->delay_prev = NULL;
+      thread->delay_next = NULL;
       switch (thread->state) {
         case osRtxThreadWaitingDelay:
           EvrRtxThreadDelayCompleted();
@@ -369,9 +609,11 @@ void osRtxThreadDelayTick (void) {
           EvrRtxMemoryPoolAllocTimeout((osMemoryPoolId_t)osRtxThreadListRoot(thread));
           break;
         case osRtxThreadWaitingMessageGet:
+        case osRtxThreadWaitingMessageReceive:
           EvrRtxMessageQueueGetTimeout((osMessageQueueId_t)osRtxThreadListRoot(thread));
           break;
         case osRtxThreadWaitingMessagePut:
+        case osRtxThreadWaitingMessageAlloc:
           EvrRtxMessageQueuePutTimeout((osMessageQueueId_t)osRtxThreadListRoot(thread));
           break;
         default:
@@ -379,14 +621,13 @@ void osRtxThreadDelayTick (void) {
           break;
       }
       EvrRtxThreadUnblocked(thread, (osRtxThreadRegPtr(thread))[0]);
+#ifdef RTX_THREAD_STATS
+      ThreadStatsWakeup(thread);
+#endif
       osRtxThreadListRemove(thread);
       osRtxThreadReadyPut(thread);
-      thread = thread->delay_next;
-    } while ((thread != NULL) && (thread->delay == 0U));
-    if (thread != NULL) {
-      thread->delay_prev = NULL;
     }
-    osRtxInfo.thread.delay_list = thread;
+    thread = next;
   }
 }
 
@@ -409,13 +650,13 @@ static void osRtxThreadBlock (os_thread_t *thread) {
 
   priority = thread->priority;
 
-  prev = osRtxThreadObject(&osRtxInfo.thread.ready);
+  // Insert ahead of the Threads with the same Priority
+  prev = osRtxThreadReadyLast((uint32_t)priority + 1U);
   next = prev->thread_next;
-
-  while ((next != NULL) && (next->priority > priority)) {
-    prev = next;
-    next = next->thread_next;
+  if (osRtxInfo.ready_index.tail[priority] == NULL) {
+    osRtxThreadReadyIndexSet(thread);
   }
+
   thread->thread_prev = prev;
   thread->thread_next = next;
   prev->thread_next = thread;
@@ -430,6 +671,9 @@ static void osRtxThreadBlock (os_thread_t *thread) {
 /// \param[in]  thread          thread object.
 void osRtxThreadSwitch (os_thread_t *thread) {
 
+#ifdef RTX_THREAD_STATS
+  ThreadStatsSwitch(osRtxInfo.thread.run.next, thread);
+#endif
   thread->state = osRtxThreadRunning;
   osRtxInfo.thread.run.next = thread;
   osRtxThreadStackCheck();
@@ -478,6 +722,9 @@ void osRtxThreadWaitExit (os_thread_t *thread, uint32_t ret_val, bool_t dispatch
   uint32_t *reg;
 
   EvrRtxThreadUnblocked(thread, ret_val);
+#ifdef RTX_THREAD_STATS
+  ThreadStatsWakeup(thread);
+#endif
 
   reg = osRtxThreadRegPtr(thread);
   reg[0] = ret_val;
@@ -789,6 +1036,9 @@ static osThreadId_t svcRtxThreadNew (osThreadFunc_t func, void *argument, const
   #ifdef RTX_TF_M_EXTENSION
     thread->tz_module     = tz_module;
   #endif
+  #endif
+  #ifdef RTX_THREAD_STATS
+    memset(&thread->stats, 0, sizeof(thread->stats));
   #endif
 
     // Initialize stack
@@ -930,6 +1180,46 @@ static uint32_t svcRtxThreadGetStackSpace (osThreadId_t thread_id) {
   return space;
 }
 
+#ifdef RTX_THREAD_STATS
+/// Get a snapshot of the Statistics of a Thread.
+/// \note API identical to osRtxThreadGetStats
+static osStatus_t svcRtxThreadGetStats (osThreadId_t thread_id, osRtxThreadStats_t *stats) {
+  os_thread_t *thread = osRtxThreadId(thread_id);
+  uint32_t     run_time;
+  uint32_t     run_time_hi;
+  uint32_t     delta;
+  uint32_t     n;
+
+  // Check parameters
+  if ((thread == NULL) || (thread->id != osRtxIdThread) || (stats == NULL)) {
+    EvrRtxThreadError(thread, (int32_t)osErrorParameter);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  run_time    = thread->stats.run_time;
+  run_time_hi = thread->stats.run_time_hi;
+
+  // Include the current time slice of the running Thread
+  if (thread->state == osRtxThreadRunning) {
+    delta     = osRtxKernelGetSysTimerCount() - thread->stats.timestamp;
+    run_time += delta;
+    if (run_time < delta) {
+      run_time_hi++;
+    }
+  }
+
+  stats->run_time    = ((uint64_t)run_time_hi << 32) | run_time;
+  stats->switches    = thread->stats.switches;
+  stats->latency_max = thread->stats.latency_max;
+  for (n = 0U; n < osRtxThreadStatsBins; n++) {
+    stats->latency[n] = thread->stats.latency[n];
+  }
+
+  return osOK;
+}
+#endif
+
 /// Change priority of a thread.
 /// \note API identical to osThreadSetPriority
 static osStatus_t svcRtxThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
@@ -951,9 +1241,8 @@ static osStatus_t svcRtxThreadSetPriority (osThreadId_t thread_id, osPriority_t
   }
 
   if (thread->priority   != (int8_t)priority) {
-    thread->priority      = (int8_t)priority;
     thread->priority_base = (int8_t)priority;
-    osRtxThreadListSort(thread);
+    osRtxThreadListSort(thread, (int8_t)priority);
     osRtxThreadDispatch(NULL);
   }
 
@@ -1087,6 +1376,9 @@ static osStatus_t svcRtxThreadResume (osThreadId_t thread_id) {
   }
 
   EvrRtxThreadResumed(thread);
+#ifdef RTX_THREAD_STATS
+  ThreadStatsWakeup(thread);
+#endif
 
   // Wakeup Thread
   osRtxThreadListRemove(thread);
@@ -1343,6 +1635,7 @@ static osStatus_t svcRtxThreadTerminate (osThreadId_t thread_id) {
 static uint32_t svcRtxThreadGetCount (void) {
   const os_thread_t *thread;
         uint32_t     count;
+        uint32_t     slot;
 
   // Running Thread
   count = 1U;
@@ -1353,10 +1646,13 @@ static uint32_t svcRtxThreadGetCount (void) {
     count++;
   }
 
-  // Delay List
-  for (thread = osRtxInfo.thread.delay_list;
-       thread != NULL; thread = thread->delay_next) {
-    count++;
+  // Delay Timing Wheel
+  for (slot = 0U; slot < (osRtxWheelLevels * osRtxWheelSlots); slot++) {
+    //lint -e{9079} "conversion from pointer to void to pointer to other type"
+    for (thread = osRtxInfo.delay_wheel.slot[slot];
+         thread != NULL; thread = thread->delay_next) {
+      count++;
+    }
   }
 
   // Wait List
@@ -1375,6 +1671,7 @@ static uint32_t svcRtxThreadGetCount (void) {
 static uint32_t svcRtxThreadEnumerate (osThreadId_t *thread_array, uint32_t array_items) {
   os_thread_t *thread;
   uint32_t     count;
+  uint32_t     slot;
 
   // Check parameters
   if ((thread_array == NULL) || (array_items == 0U)) {
@@ -1396,12 +1693,15 @@ static uint32_t svcRtxThreadEnumerate (osThreadId_t *thread_array, uint32_t arra
      count++;
   }
 
-  // Delay List
-  for (thread = osRtxInfo.thread.delay_list;
-       (thread != NULL) && (count < array_items); thread = thread->delay_next) {
-    *thread_array = thread;
-     thread_array++;
-     count++;
+  // Delay Timing Wheel
+  for (slot = 0U; slot < (osRtxWheelLevels * osRtxWheelSlots); slot++) {
+    //lint -e{9079} "conversion from pointer to void to pointer to other type"
+    for (thread = osRtxInfo.delay_wheel.slot[slot];
+         (thread != NULL) && (count < array_items); thread = thread->delay_next) {
+      *thread_array = thread;
+       thread_array++;
+       count++;
+    }
   }
 
   // Wait List
@@ -1561,6 +1861,9 @@ SVC0_0 (ThreadGetId,         osThreadId_t)
 SVC0_1 (ThreadGetState,      osThreadState_t, osThreadId_t)
 SVC0_1 (ThreadGetStackSize,  uint32_t, osThreadId_t)
 SVC0_1 (ThreadGetStackSpace, uint32_t, osThreadId_t)
+#ifdef RTX_THREAD_STATS
+SVC0_2 (ThreadGetStats,      osStatus_t,      osThreadId_t, osRtxThreadStats_t *)
+#endif
 SVC0_2 (ThreadSetPriority,   osStatus_t,      osThreadId_t, osPriority_t)
 SVC0_1 (ThreadGetPriority,   osPriority_t,    osThreadId_t)
 SVC0_0 (ThreadYield,         osStatus_t)
@@ -1728,6 +2031,20 @@ uint32_t osThreadGetStackSpace (osThreadId_t thread_id) {
   return stack_space;
 }
 
+#ifdef RTX_THREAD_STATS
+/// Get a snapshot of the Statistics of a Thread.
+osStatus_t osRtxThreadGetStats (osThreadId_t thread_id, osRtxThreadStats_t *stats) {
+  osStatus_t status;
+
+  if (IsIrqMode() || IsIrqMasked()) {
+    status = svcRtxThreadGetStats(thread_id, stats);
+  } else {
+    status =  __svcThreadGetStats(thread_id, stats);
+  }
+  return status;
+}
+#endif
+
 /// Change priority of a thread.
 osStatus_t osThreadSetPriority (osThreadId_t thread_id, osPriority_t priority) {
   osStatus_t status;
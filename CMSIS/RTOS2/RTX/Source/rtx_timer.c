@@ -36,56 +36,52 @@ __attribute__((section(".data.os.timer.obj"))) =
 
 //  ==== Helper functions ====
 
-/// Insert Timer into the Timer List sorted by Time.
+/// Link Timer into the Timer Timing Wheel Slot of its expiry Time.
 /// \param[in]  timer           timer object.
-/// \param[in]  tick            timer tick.
-static void TimerInsert (os_timer_t *timer, uint32_t tick) {
-  os_timer_t *prev, *next;
-
-  prev = NULL;
-  next = osRtxInfo.timer.list;
-  while ((next != NULL) && (next->tick <= tick)) {
-    tick -= next->tick;
-    prev  = next;
-    next  = next->next;
-  }
-  timer->tick = tick;
-  timer->prev = prev;
+static void TimerLink (os_timer_t *timer) {
+  os_timer_t *next;
+  uint32_t    slot;
+
+  slot = osRtxWheelSlot(&osRtxInfo.timer_wheel, timer->tick);
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  next = osRtxInfo.timer_wheel.slot[slot];
+  timer->prev = NULL;
   timer->next = next;
   if (next != NULL) {
-    next->tick -= timer->tick;
-    next->prev  = timer;
-  }
-  if (prev != NULL) {
-    prev->next = timer;
+    next->prev = timer;
   } else {
-    osRtxInfo.timer.list = timer;
+    osRtxWheelMark(&osRtxInfo.timer_wheel, slot);
   }
+  osRtxInfo.timer_wheel.slot[slot] = timer;
 }
 
-/// Remove Timer from the Timer List.
+/// Insert Timer into the Timer Timing Wheel.
 /// \param[in]  timer           timer object.
-static void TimerRemove (const os_timer_t *timer) {
+/// \param[in]  tick            timer tick.
+static void TimerInsert (os_timer_t *timer, uint32_t tick) {
 
-  if (timer->next != NULL) {
-    timer->next->tick += timer->tick;
-    timer->next->prev  = timer->prev;
-  }
-  if (timer->prev != NULL) {
-    timer->prev->next  = timer->next;
-  } else {
-    osRtxInfo.timer.list = timer->next;
-  }
+  // Tick is kept as absolute expiry Time of the Wheel
+  timer->tick = osRtxInfo.timer_wheel.time + tick;
+  TimerLink(timer);
 }
 
-/// Unlink Timer from the Timer List Head.
+/// Remove Timer from the Timer Timing Wheel.
 /// \param[in]  timer           timer object.
-static void TimerUnlink (const os_timer_t *timer) {
+static void TimerRemove (const os_timer_t *timer) {
+  uint32_t slot;
 
   if (timer->next != NULL) {
     timer->next->prev = timer->prev;
   }
-  osRtxInfo.timer.list = timer->next;
+  if (timer->prev != NULL) {
+    timer->prev->next = timer->next;
+  } else {
+    slot = osRtxWheelSlot(&osRtxInfo.timer_wheel, timer->tick);
+    osRtxInfo.timer_wheel.slot[slot] = timer->next;
+    if (timer->next == NULL) {
+      (void)osRtxWheelTake(&osRtxInfo.timer_wheel, slot);
+    }
+  }
 }
 
 
@@ -93,28 +89,46 @@ static void TimerUnlink (const os_timer_t *timer) {
 
 /// Timer Tick (called each SysTick).
 static void osRtxTimerTick (void) {
-  os_timer_t *timer;
+  os_timer_t *timer, *next;
   osStatus_t  status;
-
-  timer = osRtxInfo.timer.list;
-  if (timer == NULL) {
-    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
-    return;
+  uint32_t    level, slot;
+
+  osRtxInfo.timer_wheel.time++;
+
+  // Cascade Timers from higher Levels
+  for (level = osRtxWheelCascade(&osRtxInfo.timer_wheel); level != 0U; level--) {
+    slot  = (level * osRtxWheelSlots) +
+            ((osRtxInfo.timer_wheel.time >> (level * 5U)) & (osRtxWheelSlots - 1U));
+    //lint -e{9079} "conversion from pointer to void to pointer to other type"
+    timer = osRtxWheelTake(&osRtxInfo.timer_wheel, slot);
+    while (timer != NULL) {
+      next = timer->next;
+      TimerLink(timer);
+      timer = next;
+    }
   }
 
-  timer->tick--;
-  while ((timer != NULL) && (timer->tick == 0U)) {
-    TimerUnlink(timer);
-    status = osMessageQueuePut(osRtxInfo.timer.mq, &timer->finfo, 0U, 0U);
-    if (status != osOK) {
-      (void)osRtxErrorNotify(osRtxErrorTimerQueueOverflow, timer);
-    }
-    if (timer->type == osRtxTimerPeriodic) {
-      TimerInsert(timer, timer->load);
+  // Execute Timers which expire now
+  slot  = osRtxInfo.timer_wheel.time & (osRtxWheelSlots - 1U);
+  //lint -e{9079} "conversion from pointer to void to pointer to other type"
+  timer = osRtxWheelTake(&osRtxInfo.timer_wheel, slot);
+  while (timer != NULL) {
+    next = timer->next;
+    if (timer->tick != osRtxInfo.timer_wheel.time) {
+      // Expiry Time wrapped into a passed Slot (tick close to 2^32), link it again
+      TimerLink(timer);
     } else {
-      timer->state = osRtxTimerStopped;
+      status = osMessageQueuePut(osRtxInfo.timer.mq, &timer->finfo, 0U, 0U);
+      if (status != osOK) {
+        (void)osRtxErrorNotify(osRtxErrorTimerQueueOverflow, timer);
+      }
+      if (timer->type == osRtxTimerPeriodic) {
+        TimerInsert(timer, timer->load);
+      } else {
+        timer->state = osRtxTimerStopped;
+      }
     }
-    timer = osRtxInfo.timer.list;
+    timer = next;
   }
 }
 
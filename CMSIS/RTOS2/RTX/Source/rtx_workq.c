@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2013-2018 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Work Queue functions
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtx_lib.h"
+
+
+//  Submitted Work Items are pushed onto the pending list (last submitted
+//  first) with compare and swap, so that ISRs and Threads submit without a
+//  lock. A worker Thread moves the whole pending list in submission order to
+//  the queue when the queue is empty. The queue is shared by the worker
+//  Threads under a Mutex. The Semaphore counts the pending Work Items.
+
+
+//  ==== Helper functions ====
+
+/// Compare and Swap (32-bit).
+/// \param[in]  mem             memory address.
+/// \param[in]  old             expected value.
+/// \param[in]  val             new value.
+/// \return previous value (new value written when equal to expected value).
+static uint32_t WorkCas (uint32_t *mem, uint32_t old, uint32_t val) {
+#if (EXCLUSIVE_ACCESS == 0)
+  uint32_t primask = __get_PRIMASK();
+  uint32_t ret;
+
+  __disable_irq();
+
+  ret = *mem;
+  if (ret == old) {
+    *mem = val;
+  }
+
+  if (primask == 0U) {
+    __enable_irq();
+  }
+
+  return ret;
+#else
+  return atomic_cas32(mem, old, val);
+#endif
+}
+
+/// Change Work Item State.
+/// \param[in]  work            work item object.
+/// \param[in]  state           expected state.
+/// \param[in]  state_new       new state.
+/// \return true - changed, false - state was not the expected state.
+static bool_t WorkSetState (osRtxWork_t *work, uint32_t state, uint32_t state_new) {
+  return (WorkCas(&work->state, state, state_new) == state);
+}
+
+/// Push Work Item onto the pending list of a Work Queue and count it.
+/// \param[in]  wq              work queue object.
+/// \param[in]  work            work item object.
+static void WorkQueuePush (osRtxWorkQueue_t *wq, osRtxWork_t *work) {
+  osRtxWork_t *pending;
+
+  do {
+    //lint -e{9079} -e{9087} "volatile read of list head written by other submitters"
+    pending    = *((osRtxWork_t * volatile *)&wq->pending);
+    work->next = pending;
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+  } while (WorkCas((uint32_t *)&wq->pending, (uint32_t)pending, (uint32_t)work) != (uint32_t)pending);
+
+  (void)osSemaphoreRelease(wq->semaphore);
+}
+
+/// Take all Work Items from the pending list of a Work Queue.
+/// \param[in]  wq              work queue object.
+/// \return Work Items in submission order or NULL.
+static osRtxWork_t *WorkQueueTake (osRtxWorkQueue_t *wq) {
+  osRtxWork_t *pending;
+  osRtxWork_t *work;
+  osRtxWork_t *list;
+
+  do {
+    //lint -e{9079} -e{9087} "volatile read of list head written by submitters"
+    pending = *((osRtxWork_t * volatile *)&wq->pending);
+  //lint -e{923} -e{9078} "cast from pointer to unsigned int"
+  } while (WorkCas((uint32_t *)&wq->pending, (uint32_t)pending, 0U) != (uint32_t)pending);
+
+  // Reverse into submission order
+  list = NULL;
+  while (pending != NULL) {
+    work       = pending;
+    pending    = work->next;
+    work->next = list;
+    list       = work;
+  }
+
+  return list;
+}
+
+/// Delay Timer callback submitting a delayed Work Item.
+/// \param[in]  argument        work item object.
+static void WorkTimerCallback (void *argument) {
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  osRtxWork_t *work = argument;
+
+  // Work Item is Delayed or canceled after the Delay expired (the state may
+  // change in between, so both are tried until one succeeds)
+  for (;;) {
+    if (WorkSetState(work, osRtxWorkDelayed, osRtxWorkQueued)) {
+      WorkQueuePush(work->work_queue, work);
+      break;
+    }
+    if (WorkSetState(work, osRtxWorkDelayCanceled, osRtxWorkIdle)) {
+      break;
+    }
+  }
+}
+
+
+//  ==== Public API ====
+
+/// Initialize a Work Queue.
+osStatus_t osRtxWorkQueueInit (osRtxWorkQueue_t *wq) {
+  osSemaphoreAttr_t semaphore_attr;
+  osMutexAttr_t     mutex_attr;
+
+  // Check parameters
+  if (wq == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  wq->pending = NULL;
+  wq->head    = NULL;
+
+  memset(&semaphore_attr, 0, sizeof(semaphore_attr));
+  semaphore_attr.cb_mem  = &wq->semaphore_cb;
+  semaphore_attr.cb_size = sizeof(wq->semaphore_cb);
+  wq->semaphore = osSemaphoreNew(osRtxSemaphoreTokenLimit, 0U, &semaphore_attr);
+  if (wq->semaphore == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+
+  memset(&mutex_attr, 0, sizeof(mutex_attr));
+  mutex_attr.cb_mem  = &wq->mutex_cb;
+  mutex_attr.cb_size = sizeof(wq->mutex_cb);
+  wq->mutex = osMutexNew(&mutex_attr);
+  if (wq->mutex == NULL) {
+    (void)osSemaphoreDelete(wq->semaphore);
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+
+  return osOK;
+}
+
+/// Worker Thread function executing the Work Items of a Work Queue.
+__NO_RETURN void osRtxWorkQueueThread (void *argument) {
+  //lint -e{9079} "conversion from pointer to void to pointer to other type" [MISRA Note 5]
+  osRtxWorkQueue_t *wq = argument;
+  osRtxWork_t      *work;
+
+  for (;;) {
+    if (osSemaphoreAcquire(wq->semaphore, osWaitForever) != osOK) {
+      continue;
+    }
+
+    // Get next Work Item (counted by the Semaphore)
+    (void)osMutexAcquire(wq->mutex, osWaitForever);
+    if (wq->head == NULL) {
+      wq->head = WorkQueueTake(wq);
+    }
+    work = wq->head;
+    wq->head = work->next;
+    (void)osMutexRelease(wq->mutex);
+
+    // Execute Work Item unless canceled (may be submitted again by the function).
+    // Cancel and Submit switch between Queued and Canceled in between, so both
+    // are tried until one succeeds.
+    for (;;) {
+      if (WorkSetState(work, osRtxWorkQueued, osRtxWorkIdle)) {
+        work->func(work->arg);
+        break;
+      }
+      if (WorkSetState(work, osRtxWorkCanceled, osRtxWorkIdle)) {
+        break;
+      }
+    }
+  }
+}
+
+/// Initialize a Work Item.
+osStatus_t osRtxWorkInit (osRtxWork_t *work, osRtxWorkFunc_t func, void *argument) {
+  osTimerAttr_t timer_attr;
+
+  // Check parameters
+  if ((work == NULL) || (func == NULL)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  work->next       = NULL;
+  work->state      = osRtxWorkIdle;
+  work->func       = func;
+  work->arg        = argument;
+  work->work_queue = NULL;
+
+  memset(&timer_attr, 0, sizeof(timer_attr));
+  timer_attr.cb_mem  = &work->timer_cb;
+  timer_attr.cb_size = sizeof(work->timer_cb);
+  work->timer = osTimerNew(WorkTimerCallback, osTimerOnce, work, &timer_attr);
+  if (work->timer == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorResource;
+  }
+
+  return osOK;
+}
+
+/// Submit a Work Item to a Work Queue.
+osStatus_t osRtxWorkSubmit (osRtxWorkQueue_t *wq, osRtxWork_t *work, uint32_t delay) {
+  osStatus_t status;
+
+  // Check parameters
+  if ((wq == NULL) || (work == NULL)) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  if (delay == 0U) {
+    if (WorkSetState(work, osRtxWorkIdle, osRtxWorkQueued)) {
+      WorkQueuePush(wq, work);
+      status = osOK;
+    } else if (WorkSetState(work, osRtxWorkCanceled, osRtxWorkQueued)) {
+      // Canceled Work Item is still in the Work Queue
+      status = osOK;
+    } else if ((work->work_queue == wq) &&
+               WorkSetState(work, osRtxWorkDelayCanceled, osRtxWorkDelayed)) {
+      // Delay Timer callback is still pending and queues the Work Item
+      status = osOK;
+    } else {
+      status = osErrorResource;
+    }
+  } else {
+    if (IsIrqMode() || IsIrqMasked()) {
+      status = osErrorISR;
+    } else if (WorkSetState(work, osRtxWorkIdle, osRtxWorkDelayed)) {
+      work->work_queue = wq;
+      status = osTimerStart(work->timer, delay);
+      if (status != osOK) {
+        work->state = osRtxWorkIdle;
+      }
+    } else {
+      status = osErrorResource;
+    }
+  }
+
+  return status;
+}
+
+/// Cancel a pending Work Item.
+osStatus_t osRtxWorkCancel (osRtxWork_t *work) {
+  osStatus_t status;
+  uint32_t   state;
+
+  // Check parameters
+  if (work == NULL) {
+    //lint -e{904} "Return statement before end of function" [MISRA Note 1]
+    return osErrorParameter;
+  }
+
+  status = osErrorResource;
+  do {
+    //lint -e{9079} -e{9087} "volatile read of state changed by submitters and workers"
+    state = *((volatile uint32_t *)&work->state);
+    if (state == osRtxWorkDelayed) {
+      if (IsIrqMode() || IsIrqMasked()) {
+        status = osErrorISR;
+        break;
+      }
+      if (osTimerStop(work->timer) == osOK) {
+        // Delay Timer stopped before expiry (no callback pending). A concurrent
+        // Cancel may have seen the stopped Timer as expired.
+        while (!WorkSetState(work, osRtxWorkDelayed,       osRtxWorkIdle) &&
+               !WorkSetState(work, osRtxWorkDelayCanceled, osRtxWorkIdle)) {}
+        status = osOK;
+      } else if (WorkSetState(work, osRtxWorkDelayed, osRtxWorkDelayCanceled)) {
+        // Delay expired: the pending callback makes the Work Item Idle, so
+        // that it is not queued early after a new delayed submission
+        status = osOK;
+      } else {
+        // State changed: try again
+      }
+    } else if (state == osRtxWorkQueued) {
+      if (WorkSetState(work, osRtxWorkQueued, osRtxWorkCanceled)) {
+        status = osOK;
+      }
+    } else {
+      // Work Item is not pending
+      break;
+    }
+  } while (status != osOK);
+
+  return status;
+}
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2013-2018 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * Project:     CMSIS-RTOS RTX
+ * Title:       Binary Trace decoder (host)
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//  Trace dump: osRtxTrace header (magic, size, level, freq, idle, index,
+//  timestamp) followed by the record buffer. The records are located at the
+//  end of the dump so that the record pointer of the header may be included.
+
+#define TRACE_MAGIC             0x54585452U     // osRtxTraceMagic
+#define TRACE_HEADER_SIZE       28U             // Header words before record pointer
+#define TRACE_ID_SYNC           0x3FFU          // osRtxTraceIdSync
+#define TRACE_TS_MASK           0x003FFFFFU     // Timestamp bits in a record
+#define TRACE_TS_HALF           0x00200000U
+
+// Event IDs: component number (low 4 bits) <9:6>, message number <5:0>
+#define ID(comp, msg)           ((((comp) & 0x0FU) << 6) | (msg))
+
+#define ID_THREAD_UNBLOCKED     ID(0xF2U, 0x17U)
+#define ID_THREAD_SWITCHED      ID(0xF2U, 0x19U)
+#define ID_THREAD_DELAY_DONE    ID(0xF2U, 0x2BU)
+
+#define MAX_THREADS             64U
+
+/// Wait object kinds
+enum {
+  WAIT_NONE = 0,
+  WAIT_THREAD_FLAGS,
+  WAIT_EVENT_FLAGS,
+  WAIT_MUTEX,
+  WAIT_SEMAPHORE,
+  WAIT_MEMORY_POOL,
+  WAIT_MSGQUEUE_GET,
+  WAIT_MSGQUEUE_PUT,
+  WAIT_OTHER,
+  WAIT_KINDS
+};
+
+static const char *wait_name[WAIT_KINDS] = {
+  "none", "thread_flags", "event_flags", "mutex", "semaphore",
+  "memory_pool", "msgqueue_get", "msgqueue_put", "delay_timeout"
+};
+
+/// Pending and Timeout events of wait objects
+static const struct {
+  uint32_t pending;
+  uint32_t timeout;
+  uint32_t kind;
+} wait_event[] = {
+  { ID(0xF2U, 0x25U), ID(0xF2U, 0x26U), WAIT_THREAD_FLAGS },
+  { ID(0xF4U, 0x0CU), ID(0xF4U, 0x0DU), WAIT_EVENT_FLAGS  },
+  { ID(0xF5U, 0x07U), ID(0xF5U, 0x08U), WAIT_MUTEX        },
+  { ID(0xF6U, 0x07U), ID(0xF6U, 0x08U), WAIT_SEMAPHORE    },
+  { ID(0xF7U, 0x07U), ID(0xF7U, 0x08U), WAIT_MEMORY_POOL  },
+  { ID(0xF8U, 0x0DU), ID(0xF8U, 0x0EU), WAIT_MSGQUEUE_GET },
+  { ID(0xF8U, 0x07U), ID(0xF8U, 0x08U), WAIT_MSGQUEUE_PUT }
+};
+
+/// Thread statistics
+typedef struct {
+  uint32_t id;                  // Thread ID
+  uint64_t run;                 // Running time
+  uint32_t switches;            // Number of switches to thread
+  uint32_t wait;                // Pending wait kind
+  uint32_t woken;               // Wake-up kind (0 when not woken)
+  uint64_t wake_time;           // Wake-up time
+  uint64_t slice;               // Start of running slice
+} thread_stat_t;
+
+/// Latency statistics
+typedef struct {
+  uint32_t count;
+  uint64_t sum;
+  uint64_t min;
+  uint64_t max;
+} latency_t;
+
+static thread_stat_t thread_stat[MAX_THREADS];
+static uint32_t      thread_count;
+static latency_t     latency[WAIT_KINDS];
+
+static uint32_t hdr_freq;
+static uint32_t hdr_idle;
+static int      show_timeline;
+
+
+/// Get statistics of a Thread (created on first use).
+static thread_stat_t *ThreadStat (uint32_t id) {
+  uint32_t n;
+
+  for (n = 0U; n < thread_count; n++) {
+    if (thread_stat[n].id == id) {
+      return &thread_stat[n];
+    }
+  }
+  if (thread_count == MAX_THREADS) {
+    return NULL;
+  }
+  thread_stat[thread_count].id = id;
+  return &thread_stat[thread_count++];
+}
+
+/// Convert timestamp counts to microseconds.
+static double Usec (uint64_t t) {
+  if (hdr_freq == 0U) {
+    return 0.0;
+  }
+  return ((double)t * 1e6) / (double)hdr_freq;
+}
+
+/// Print thread label.
+static const char *ThreadName (uint32_t id) {
+  static char buf[16];
+
+  if ((id == hdr_idle) && (id != 0U)) {
+    return "idle";
+  }
+  snprintf(buf, sizeof(buf), "0x%08X", id);
+  return buf;
+}
+
+/// Decode trace records and accumulate statistics.
+static void Decode (const uint32_t *rec, uint32_t size, uint32_t index) {
+  thread_stat_t *running = NULL;
+  thread_stat_t *ts;
+  uint64_t time = 0U, start = 0U, last = 0U;
+  uint32_t first, n, i, id, val, low, delta;
+  uint32_t synced = 0U;
+  uint32_t timeout = 0U;
+  uint32_t records = 0U;
+
+  first = (index > size) ? (index - size) : 0U;
+
+  for (n = first; n != index; n++) {
+    i   = (n & (size - 1U)) * 2U;
+    id  = rec[i] & 0x3FFU;
+    val = rec[i + 1U];
+    low = rec[i] >> 10;
+
+    if (id == TRACE_ID_SYNC) {
+      // Sync record: full 32-bit timestamp (extended to 64-bit)
+      if (synced == 0U) {
+        time   = val;
+        start  = time;
+        synced = 1U;
+      } else {
+        time += (uint32_t)(val - (uint32_t)time);
+      }
+      continue;
+    }
+    if (synced == 0U) {
+      continue;
+    }
+
+    // Records carry the low timestamp bits; small steps back are preemptions
+    delta = (low - (uint32_t)time) & TRACE_TS_MASK;
+    if (delta < TRACE_TS_HALF) {
+      time += delta;
+    } else {
+      time -= TRACE_TS_MASK + 1U - delta;
+    }
+    records++;
+    last = time;
+
+    if (id == ID_THREAD_SWITCHED) {
+      if (running != NULL) {
+        running->run += time - running->slice;
+      }
+      ts = ThreadStat(val);
+      if (ts == NULL) {
+        running = NULL;
+        continue;
+      }
+      if (ts->woken != WAIT_NONE) {
+        latency_t *l = &latency[ts->woken];
+        uint64_t   d = time - ts->wake_time;
+        if ((l->count == 0U) || (d < l->min)) {
+          l->min = d;
+        }
+        if (d > l->max) {
+          l->max = d;
+        }
+        l->sum += d;
+        l->count++;
+        ts->woken = WAIT_NONE;
+      }
+      ts->switches++;
+      ts->slice = time;
+      running = ts;
+      if (show_timeline != 0) {
+        printf("%14.3f us  switch  %s\n", Usec(time - start), ThreadName(val));
+      }
+      continue;
+    }
+
+    if (id == ID_THREAD_UNBLOCKED) {
+      // Timeout event precedes the unblocking by the kernel tick
+      ts = ThreadStat(val);
+      if (ts != NULL) {
+        ts->woken     = ((ts->wait != WAIT_NONE) && (timeout == 0U)) ? ts->wait : WAIT_OTHER;
+        ts->wait      = WAIT_NONE;
+        ts->wake_time = time;
+      }
+      timeout = 0U;
+      if (show_timeline != 0) {
+        printf("%14.3f us  wake    %s\n", Usec(time - start), ThreadName(val));
+      }
+      continue;
+    }
+
+    for (i = 0U; i < (sizeof(wait_event) / sizeof(wait_event[0])); i++) {
+      if ((id == wait_event[i].pending) && (running != NULL)) {
+        running->wait = wait_event[i].kind;
+        if (show_timeline != 0) {
+          printf("%14.3f us  wait    %s %s 0x%08X\n", Usec(time - start),
+                 ThreadName(running->id), wait_name[wait_event[i].kind], val);
+        }
+      }
+      if (id == wait_event[i].timeout) {
+        timeout = 1U;
+      }
+    }
+    if (id == ID_THREAD_DELAY_DONE) {
+      timeout = 1U;
+    }
+  }
+
+  if (running != NULL) {
+    running->run += last - running->slice;
+  }
+
+  printf("Records:   %u (%u lost)\n", records, first);
+  printf("Duration:  %.3f us (%llu counts at %u Hz)\n",
+         Usec(last - start), (unsigned long long)(last - start), hdr_freq);
+
+  if (last > start) {
+    uint64_t busy = 0U;
+
+    printf("\n%-12s %10s %14s %8s\n", "thread", "switches", "run [us]", "cpu [%]");
+    for (n = 0U; n < thread_count; n++) {
+      ts = &thread_stat[n];
+      printf("%-12s %10u %14.3f %8.2f\n", ThreadName(ts->id), ts->switches,
+             Usec(ts->run), (100.0 * (double)ts->run) / (double)(last - start));
+      if (ts->id != hdr_idle) {
+        busy += ts->run;
+      }
+    }
+    if (hdr_idle != 0U) {
+      printf("\nCPU load:  %.2f %%\n", (100.0 * (double)busy) / (double)(last - start));
+    }
+  }
+
+  printf("\n%-14s %8s %12s %12s %12s\n", "wake_latency", "count", "min [us]", "avg [us]", "max [us]");
+  for (n = WAIT_THREAD_FLAGS; n < WAIT_KINDS; n++) {
+    if (latency[n].count != 0U) {
+      printf("%-14s %8u %12.3f %12.3f %12.3f\n", wait_name[n], latency[n].count,
+             Usec(latency[n].min), Usec(latency[n].sum / latency[n].count), Usec(latency[n].max));
+    }
+  }
+}
+
+static void Usage (void) {
+  fprintf(stderr, "usage: trace_decode [-t] [-f freq] dump.bin\n"
+                  "  -t       print thread timeline\n"
+                  "  -f freq  timestamp frequency in Hz (overrides dump)\n");
+  exit(2);
+}
+
+int main (int argc, char *argv[]) {
+  const char *file = NULL;
+  uint32_t   *buf;
+  uint32_t    hdr[TRACE_HEADER_SIZE / 4U];
+  uint32_t    freq = 0U;
+  long        len;
+  FILE       *f;
+  int         n;
+
+  for (n = 1; n < argc; n++) {
+    if (strcmp(argv[n], "-t") == 0) {
+      show_timeline = 1;
+    } else if ((strcmp(argv[n], "-f") == 0) && ((n + 1) < argc)) {
+      freq = (uint32_t)strtoul(argv[++n], NULL, 0);
+    } else if ((argv[n][0] != '-') && (file == NULL)) {
+      file = argv[n];
+    } else {
+      Usage();
+    }
+  }
+  if (file == NULL) {
+    Usage();
+  }
+
+  f = fopen(file, "rb");
+  if (f == NULL) {
+    perror(file);
+    return 1;
+  }
+  if (fread(hdr, 1U, sizeof(hdr), f) != sizeof(hdr)) {
+    fprintf(stderr, "%s: truncated trace header\n", file);
+    return 1;
+  }
+  if ((hdr[0] != TRACE_MAGIC) || (hdr[1] < 64U) || ((hdr[1] & (hdr[1] - 1U)) != 0U)) {
+    fprintf(stderr, "%s: not an RTX binary trace dump\n", file);
+    return 1;
+  }
+  fseek(f, 0L, SEEK_END);
+  len = ftell(f);
+  if (len < (long)(sizeof(hdr) + (hdr[1] * 8U))) {
+    fprintf(stderr, "%s: truncated trace records\n", file);
+    return 1;
+  }
+  buf = malloc(hdr[1] * 8U);
+  fseek(f, len - (long)(hdr[1] * 8U), SEEK_SET);
+  if ((buf == NULL) || (fread(buf, 8U, hdr[1], f) != hdr[1])) {
+    fprintf(stderr, "%s: read error\n", file);
+    return 1;
+  }
+  fclose(f);
+
+  hdr_freq = (freq != 0U) ? freq : hdr[3];
+  hdr_idle = hdr[4];
+
+  Decode(buf, hdr[1], hdr[5]);
+
+  free(buf);
+  return 0;
+}
@@ -1,8 +1,8 @@
 /**************************************************************************//**
  * @file     os_systick.c
  * @brief    CMSIS OS Tick SysTick implementation
- * @version  V1.0.1
- * @date     24. November 2017
+ * @version  V1.1.0
+ * @date     18. October 2026
  ******************************************************************************/
 /*
  * Copyright (c) 2017-2017 ARM Limited. All rights reserved.
@@ -34,7 +34,14 @@
 #define SYSTICK_IRQ_PRIORITY    0xFFU
 #endif
 
-static uint8_t PendST;
+// Minimum counts of the partial tick programmed by OS_Tick_Resume
+#define SYSTICK_RESUME_MIN      64U
+
+static uint8_t  PendST;
+static uint8_t  Masked;         // Tick counting with the interrupt masked (OS_Tick_Disable, OS_Tick_Resume)
+static uint32_t Load;           // Reload value of a periodic tick
+static uint32_t SleepTicks;     // Ticks programmed by OS_Tick_Suspend
+static uint32_t SleepFirst;     // Counts of the first tick programmed by OS_Tick_Suspend
 
 // Setup OS Tick.
 __WEAK int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
@@ -71,7 +78,9 @@ __WEAK int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
   SysTick->LOAD =  load;
   SysTick->VAL  =  0U;
 
-  PendST = 0U;
+  PendST  = 0U;
+  Masked  = 0U;
+  Load    = load;
 
   return (0);
 }
@@ -84,13 +93,26 @@ __WEAK void OS_Tick_Enable (void) {
     SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
   }
 
-  SysTick->CTRL |=  SysTick_CTRL_ENABLE_Msk;
+  if (Masked != 0U) {
+    // Counter kept running since OS_Tick_Disable or OS_Tick_Resume: enable
+    // the interrupt and raise a tick that has expired in the meantime
+    Masked = 0U;
+    SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U) {
+      SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+    }
+  } else {
+    SysTick->CTRL |=  SysTick_CTRL_ENABLE_Msk;
+  }
 }
 
 /// Disable OS Tick.
 __WEAK void OS_Tick_Disable (void) {
 
-  SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+  // Mask the interrupt only: the counter keeps running so that the time
+  // until OS_Tick_Suspend or OS_Tick_Enable is not lost
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+  Masked = 1U;
 
   if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U) {
     SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
@@ -115,18 +137,122 @@ __WEAK uint32_t OS_Tick_GetClock (void) {
 
 // Get OS Tick interval.
 __WEAK uint32_t OS_Tick_GetInterval (void) {
-  return (SysTick->LOAD + 1U);
+  return (Load + 1U);
 }
 
 // Get OS Tick count value.
 __WEAK uint32_t OS_Tick_GetCount (void) {
-  uint32_t load = SysTick->LOAD;
-  return  (load - SysTick->VAL);
+  uint32_t val = SysTick->VAL;
+
+  // Counts beyond the reload value belong to a tick counted early by OS_Tick_Resume
+  if (val > Load) {
+    val = Load;
+  }
+  return  (Load - val);
 }
 
 // Get OS Tick overflow status.
 __WEAK uint32_t OS_Tick_GetOverflow (void) {
-  return ((SysTick->CTRL >> 16) & 1U);
+  uint32_t overflow = (SysTick->CTRL >> 16) & 1U;
+
+  // Reading CTRL clears COUNTFLAG: keep a tick expired while the interrupt
+  // is masked for OS_Tick_Enable
+  if (Masked != 0U) {
+    if (overflow != 0U) {
+      PendST = 1U;
+    }
+    overflow = PendST;
+  }
+  return (overflow);
+}
+
+// Suspend periodic OS Tick for a number of ticks.
+__WEAK uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  uint32_t count, max;
+
+  // Counts remaining in the current tick, read before COUNTFLAG so that
+  // a tick expiring in between is not missed
+  count = SysTick->VAL;
+  if ((SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk) != 0U) {
+    PendST = 1U;
+  }
+
+  if ((PendST != 0U) || (ticks == 0U)) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  if (count == 0U) {
+    count = Load + 1U;
+  }
+
+  // Limit to the 24-bit counter range
+  max = ((0x00FFFFFFU - count) / (Load + 1U)) + 1U;
+  if (ticks > max) {
+    ticks = max;
+  }
+
+  SleepTicks = ticks;
+  SleepFirst = count;
+  count += (ticks - 1U) * (Load + 1U);
+
+  SysTick->LOAD  =  count - 1U;
+  SysTick->VAL   =  0U;
+  SysTick->CTRL  =  SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+  Masked = 0U;
+
+  return (ticks);
+}
+
+// Resume periodic OS Tick.
+__WEAK uint32_t OS_Tick_Resume (void) {
+  uint32_t ctrl, val, count, ticks, reload;
+
+  ctrl = SysTick->CTRL;
+  SysTick->CTRL = ctrl & ~SysTick_CTRL_ENABLE_Msk;
+  val  = SysTick->VAL;
+
+  if (((ctrl & SysTick_CTRL_COUNTFLAG_Msk) != 0U) ||
+      ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)) {
+    // Programmed ticks elapsed: counter has been reloaded
+    SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+    count  = SysTick->LOAD - val;
+    ticks  = SleepTicks + (count / (Load + 1U));
+    reload = (Load + 1U) - (count % (Load + 1U));
+  } else {
+    // Woken up earlier by another interrupt
+    count = (val != 0U) ? (SysTick->LOAD - val) : 0U;
+    if (count < SleepFirst) {
+      ticks  = 0U;
+      reload = SleepFirst - count;
+    } else {
+      count -= SleepFirst;
+      ticks  = 1U + (count / (Load + 1U));
+      reload = (Load + 1U) - (count % (Load + 1U));
+    }
+  }
+
+  // A partial tick too short to be programmed is counted now and
+  // its remaining counts are added to the next tick
+  if (reload < SYSTICK_RESUME_MIN) {
+    ticks++;
+    reload += Load + 1U;
+    if (reload > 0x01000000U) {
+      reload = 0x01000000U;
+    }
+  }
+
+  // Continue the current tick without interrupt until OS_Tick_Enable:
+  // the counter loads the remaining counts on the next clock after VAL is
+  // cleared, the periodic reload value is written only once it has done so
+  SysTick->LOAD = reload - 1U;
+  SysTick->VAL  = 0U;
+  SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+  while (SysTick->VAL == 0U) {}
+  SysTick->LOAD = Load;
+  Masked = 1U;
+
+  return (ticks);
 }
 
 #endif  // SysTick
@@ -1,8 +1,8 @@
 /**************************************************************************//**
  * @file     os_tick_gtim.c
  * @brief    CMSIS OS Tick implementation for Generic Timer
- * @version  V1.0.1
- * @date     24. November 2017
+ * @version  V1.0.2
+ * @date     18. October 2026
  ******************************************************************************/
 /*
  * Copyright (c) 2017 ARM Limited. All rights reserved.
@@ -185,3 +185,14 @@ uint32_t OS_Tick_GetOverflow (void) {
   cntp_ctl.w = PL1_GetControl();
   return (cntp_ctl.b.ISTATUS);
 }
+
+// Suspend periodic OS Tick (single tick interrupt not supported: tick stays periodic).
+uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  (void)ticks;
+  return (0U);
+}
+
+// Resume periodic OS Tick.
+uint32_t OS_Tick_Resume (void) {
+  return (0U);
+}
@@ -0,0 +1,218 @@
+/**************************************************************************//**
+ * @file     os_tick_posix.c
+ * @brief    CMSIS OS Tick implementation for POSIX hosts (timer signal)
+ * @version  V1.1.0
+ * @date     18. October 2026
+ ******************************************************************************/
+/*
+ * Copyright (c) 2017-2017 ARM Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "os_tick.h"
+
+#if defined(RTX_POSIX)
+
+#include <signal.h>
+#include <stddef.h>
+#include <time.h>
+#include "cmsis_compiler.h"
+
+#ifndef OS_TICK_SIGNAL
+#define OS_TICK_SIGNAL          SIGALRM
+#endif
+
+// The tick timer counts nanoseconds of CLOCK_MONOTONIC. A tick period starts
+// every Interval nanoseconds after the timer has been enabled, the timer
+// signal raises the tick handler like the SysTick exception. Ticks expiring
+// while the previous one is still pending are merged, as on SysTick.
+// As the SysTick counter, the tick period keeps running while the timer is
+// disabled: a tick that expired while disabled, or expired but has not been
+// acknowledged when the timer is disabled, is raised on enable.
+
+static IRQHandler_t TickHandler;
+static timer_t      TickTimer;
+static uint32_t     TickTimerValid;
+static uint64_t     Interval;
+static uint64_t     Start;
+static uint64_t     Period;
+static uint8_t      PendST;
+static uint8_t      Masked;
+
+// Get current time in nanoseconds.
+static uint64_t TickTime (void) {
+  struct timespec ts;
+
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec);
+}
+
+// Timer signal handler.
+static void TickSignal (int sig) {
+  (void)sig;
+
+  if (TickHandler != NULL) {
+    TickHandler();
+  }
+}
+
+// Program the timer expiry and period (0 - disarm, single expiry).
+static void TickTimerSet (uint64_t ns, uint64_t period) {
+  struct itimerspec its;
+
+  its.it_value.tv_sec     = (time_t)(ns / 1000000000U);
+  its.it_value.tv_nsec    = (long)(ns % 1000000000U);
+  its.it_interval.tv_sec  = (time_t)(period / 1000000000U);
+  its.it_interval.tv_nsec = (long)(period % 1000000000U);
+  (void)timer_settime(TickTimer, 0, &its, NULL);
+}
+
+// Setup OS Tick.
+__WEAK int32_t OS_Tick_Setup (uint32_t freq, IRQHandler_t handler) {
+  struct sigaction  sa;
+  struct sigevent   sev;
+
+  if ((freq == 0U) || (freq > 1000000000U)) {
+    //lint -e{904} "Return statement before end of function"
+    return (-1);
+  }
+
+  Interval    = 1000000000U / freq;
+  TickHandler = handler;
+
+  sa.sa_handler = TickSignal;
+  sa.sa_flags   = SA_RESTART;
+  (void)sigemptyset(&sa.sa_mask);
+  if (sigaction(OS_TICK_SIGNAL, &sa, NULL) != 0) {
+    //lint -e{904} "Return statement before end of function"
+    return (-1);
+  }
+
+  if (TickTimerValid == 0U) {
+    sev.sigev_notify = SIGEV_SIGNAL;
+    sev.sigev_signo  = OS_TICK_SIGNAL;
+    sev.sigev_value.sival_ptr = NULL;
+    if (timer_create(CLOCK_MONOTONIC, &sev, &TickTimer) != 0) {
+      //lint -e{904} "Return statement before end of function"
+      return (-1);
+    }
+    TickTimerValid = 1U;
+  }
+
+  return (0);
+}
+
+/// Enable OS Tick.
+__WEAK void OS_Tick_Enable (void) {
+  uint64_t time = TickTime();
+
+  if (Masked != 0U) {
+    // Tick period kept running since OS_Tick_Disable or OS_Tick_Resume
+    Masked = 0U;
+    if ((time - Start) >= Interval) {
+      Start += ((time - Start) / Interval) * Interval;
+      PendST = 1U;
+    }
+  } else {
+    Start = time;
+  }
+  Period = 0U;
+  TickTimerSet((Start + Interval) - time, Interval);
+
+  if (PendST != 0U) {
+    PendST = 0U;
+    (void)raise(OS_TICK_SIGNAL);
+  }
+}
+
+/// Disable OS Tick.
+__WEAK void OS_Tick_Disable (void) {
+  uint64_t ticks;
+
+  TickTimerSet(0U, 0U);
+
+  // Continue from the start of the current tick period
+  ticks = (TickTime() - Start) / Interval;
+  if (ticks > Period) {
+    PendST = 1U;
+  }
+  Start += ticks * Interval;
+  Period = 0U;
+  Masked = 1U;
+}
+
+// Acknowledge OS Tick IRQ.
+__WEAK void OS_Tick_AcknowledgeIRQ (void) {
+  Period = (TickTime() - Start) / Interval;
+}
+
+// Get OS Tick IRQ number.
+__WEAK int32_t  OS_Tick_GetIRQn (void) {
+  return ((int32_t)OS_TICK_SIGNAL);
+}
+
+// Get OS Tick clock.
+__WEAK uint32_t OS_Tick_GetClock (void) {
+  return (1000000000U);
+}
+
+// Get OS Tick interval.
+__WEAK uint32_t OS_Tick_GetInterval (void) {
+  return ((uint32_t)Interval);
+}
+
+// Get OS Tick count value.
+__WEAK uint32_t OS_Tick_GetCount (void) {
+  return ((uint32_t)((TickTime() - Start) % Interval));
+}
+
+// Get OS Tick overflow status.
+__WEAK uint32_t OS_Tick_GetOverflow (void) {
+  return (((PendST != 0U) || (((TickTime() - Start) / Interval) > Period)) ? 1U : 0U);
+}
+
+// Suspend periodic OS Tick for a number of ticks.
+__WEAK uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  uint64_t time, expiry;
+
+  if ((PendST != 0U) || (ticks == 0U)) {
+    //lint -e{904} "Return statement before end of function"
+    return (0U);
+  }
+
+  // Tick period keeps running from OS_Tick_Disable
+  time   = TickTime();
+  expiry = Start + ((uint64_t)ticks * Interval);
+  TickTimerSet((expiry > time) ? (expiry - time) : 1U, 0U);
+
+  return (ticks);
+}
+
+// Resume periodic OS Tick.
+__WEAK uint32_t OS_Tick_Resume (void) {
+  uint64_t ticks;
+
+  TickTimerSet(0U, 0U);
+
+  ticks   = (TickTime() - Start) / Interval;
+  Start  += ticks * Interval;
+  PendST  = 0U;
+  Masked  = 1U;
+
+  return ((uint32_t)ticks);
+}
+
+#endif  // RTX_POSIX
@@ -1,8 +1,8 @@
 /**************************************************************************//**
  * @file     os_tick_ptim.c
  * @brief    CMSIS OS Tick implementation for Private Timer
- * @version  V1.0.2
- * @date     02. March 2018
+ * @version  V1.0.3
+ * @date     18. October 2026
  ******************************************************************************/
 /*
  * Copyright (c) 2017-2018 Arm Limited. All rights reserved.
@@ -162,4 +162,15 @@ uint32_t OS_Tick_GetOverflow (void) {
   return (PTIM->ISR & 1);
 }
 
+// Suspend periodic OS Tick (single tick interrupt not supported: tick stays periodic).
+uint32_t OS_Tick_Suspend (uint32_t ticks) {
+  (void)ticks;
+  return (0U);
+}
+
+// Resume periodic OS Tick.
+uint32_t OS_Tick_Resume (void) {
+  return (0U);
+}
+
 #endif  // PTIM